@@ -0,0 +1,233 @@
+// Full-document parse throughput. Parses each input file N times and reports
+// MB/s, tokens/s, nodes/s and p50/p99 latency per file, on stdout as a table
+// and in bench_output.txt as one JSON object per line.
+//
+//   bench [-n iterations] [-w warmup] [-o output] [--phases] [file.vue ...]
+//
+// --phases parses with tree_sitter_vue3_instrumented() and adds the time spent
+// in each lexer and scanner callback to every record.
+
+#include <string.h>
+#include <tree_sitter/api.h>
+
+#include "bench.h"
+#include "instrumented.h"
+#include "scanner_stats.h"
+
+#define DEFAULT_OUTPUT "../bench_output.txt"
+
+typedef struct {
+  const char *path;
+  size_t bytes;
+  unsigned iterations;
+  uint64_t nodes;
+  uint64_t tokens;
+  bool has_error;
+  uint64_t total_ns;
+  uint64_t p50_ns;
+  uint64_t p99_ns;
+  TSVue3Stats phases;
+} FileResult;
+
+static double per_second(double count, uint64_t ns) {
+  return ns ? count * 1e9 / (double)ns : 0.0;
+}
+
+// Leaves the time of each parse in `samples`, which holds `iterations`
+// entries, so the caller can pool them across files.
+static bool bench_file(TSParser *parser, const char *path, unsigned warmup, unsigned iterations, bool phases,
+                       uint64_t *samples, FileResult *result) {
+  size_t length = 0;
+  char *source = bench_read_file(path, &length);
+  if (!source) {
+    fprintf(stderr, "could not read %s\n", path);
+    return false;
+  }
+
+  memset(result, 0, sizeof(*result));
+  result->path = path;
+  result->bytes = length;
+  result->iterations = iterations;
+
+  for (unsigned i = 0; i < warmup; i++) {
+    ts_tree_delete(ts_parser_parse_string(parser, NULL, source, (uint32_t)length));
+  }
+
+  if (phases) tree_sitter_vue3_instrumented_reset();
+  for (unsigned i = 0; i < iterations; i++) {
+    uint64_t start = bench_now_ns();
+    TSTree *tree = ts_parser_parse_string(parser, NULL, source, (uint32_t)length);
+    samples[i] = bench_now_ns() - start;
+    result->total_ns += samples[i];
+    if (!tree) {
+      fprintf(stderr, "could not parse %s\n", path);
+      free(source);
+      return false;
+    }
+
+    if (i + 1 == iterations) {
+      bench_count_nodes(tree, &result->nodes, &result->tokens);
+      result->has_error = ts_node_has_error(ts_tree_root_node(tree));
+    }
+    ts_tree_delete(tree);
+  }
+  if (phases) tree_sitter_vue3_instrumented_stats(&result->phases);
+
+  result->p50_ns = bench_percentile(samples, iterations, 50);
+  result->p99_ns = bench_percentile(samples, iterations, 99);
+
+  free(source);
+  return true;
+}
+
+static void print_result(const FileResult *result) {
+  double mean_ns = (double)result->total_ns / result->iterations;
+  printf("%-40s %9zu %9.2f %12.0f %12.0f %10.1f %10.1f%s\n", result->path, result->bytes,
+         per_second((double)result->bytes / 1e6, (uint64_t)mean_ns),
+         per_second((double)result->tokens, (uint64_t)mean_ns),
+         per_second((double)result->nodes, (uint64_t)mean_ns),
+         result->p50_ns / 1e3, result->p99_ns / 1e3, result->has_error ? "  (has errors)" : "");
+}
+
+static void write_result(FILE *output, const FileResult *result, bool phases, double ticks_per_second) {
+  double mean_ns = (double)result->total_ns / result->iterations;
+  fputs("{\"file\":", output);
+  bench_json_string(output, result->path);
+  fprintf(output,
+          ",\"bytes\":%zu,\"iterations\":%u,\"tokens\":%llu,\"nodes\":%llu,\"has_error\":%s"
+          ",\"mean_ns\":%.0f,\"p50_ns\":%llu,\"p99_ns\":%llu"
+          ",\"mb_per_s\":%.3f,\"tokens_per_s\":%.0f,\"nodes_per_s\":%.0f",
+          result->bytes, result->iterations, (unsigned long long)result->tokens,
+          (unsigned long long)result->nodes, result->has_error ? "true" : "false", mean_ns,
+          (unsigned long long)result->p50_ns, (unsigned long long)result->p99_ns,
+          per_second((double)result->bytes / 1e6, (uint64_t)mean_ns),
+          per_second((double)result->tokens, (uint64_t)mean_ns),
+          per_second((double)result->nodes, (uint64_t)mean_ns));
+
+  if (phases) {
+    fputs(",\"phases\":{", output);
+    for (unsigned i = 0; i < TS_VUE3_PHASE_COUNT; i++) {
+      const TSVue3PhaseStats *phase = &result->phases.phases[i];
+      fprintf(output, "%s\"%s\":{\"calls\":%llu,\"ns\":%.0f}", i ? "," : "",
+              tree_sitter_vue3_phase_name((TSVue3Phase)i), (unsigned long long)phase->calls,
+              (double)phase->ticks * 1e9 / ticks_per_second);
+    }
+    fputc('}', output);
+  }
+  fputs("}\n", output);
+}
+
+static void write_scanner_stats(FILE *output) {
+  static TSVue3ScannerStats stats;
+  if (!tree_sitter_vue3_scanner_stats(&stats)) return;
+
+  fprintf(output, "{\"scanner_stats\":{\"scanners\":%llu,\"scan_calls\":%llu,\"max_tag_stack_depth\":%llu"
+          ",\"serialize_calls\":%llu,\"serialized_bytes\":%llu,\"max_serialized_bytes\":%llu,\"branches\":{",
+          (unsigned long long)stats.scanners, (unsigned long long)stats.scan_calls,
+          (unsigned long long)stats.max_tag_stack_depth, (unsigned long long)stats.serialize_calls,
+          (unsigned long long)stats.serialized_bytes, (unsigned long long)stats.max_serialized_bytes);
+  for (unsigned i = 0; i < TS_VUE3_SCAN_BRANCH_COUNT; i++) {
+    const TSVue3ScanBranchStats *branch = &stats.branches[i];
+    fprintf(output, "%s\"%s\":{\"calls\":%llu,\"accepted\":%llu,\"chars_advanced\":%llu,\"rescans\":%llu}",
+            i ? "," : "", tree_sitter_vue3_scan_branch_name((TSVue3ScanBranch)i),
+            (unsigned long long)branch->calls, (unsigned long long)branch->accepted,
+            (unsigned long long)branch->chars_advanced, (unsigned long long)branch->rescans);
+  }
+  fputs("},\"valid_symbols\":{", output);
+  bool first = true;
+  for (unsigned i = 0; i < TS_VUE3_VALID_SYMBOL_COMBINATIONS; i++) {
+    if (!stats.valid_symbols[i]) continue;
+    fprintf(output, "%s\"0x%03x\":%llu", first ? "" : ",", i, (unsigned long long)stats.valid_symbols[i]);
+    first = false;
+  }
+  fputs("}}}\n", output);
+}
+
+int main(int argc, char **argv) {
+  unsigned iterations = 100;
+  unsigned warmup = 5;
+  const char *output_path = DEFAULT_OUTPUT;
+  bool phases = false;
+  const char **paths = (const char **)calloc((size_t)argc + 1, sizeof(char *));
+  size_t path_count = 0;
+  if (!paths) return 1;
+
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "-n") == 0 && i + 1 < argc) {
+      iterations = (unsigned)strtoul(argv[++i], NULL, 10);
+    } else if (strcmp(argv[i], "-w") == 0 && i + 1 < argc) {
+      warmup = (unsigned)strtoul(argv[++i], NULL, 10);
+    } else if (strcmp(argv[i], "-o") == 0 && i + 1 < argc) {
+      output_path = argv[++i];
+    } else if (strcmp(argv[i], "--phases") == 0) {
+      phases = true;
+    } else {
+      paths[path_count++] = argv[i];
+    }
+  }
+  if (iterations == 0) iterations = 1;
+  if (path_count == 0) {
+    paths[path_count++] = BENCH_DEFAULT_INPUT;
+  }
+
+  FILE *output = fopen(output_path, "w");
+  if (!output) {
+    fprintf(stderr, "could not open %s\n", output_path);
+    free(paths);
+    return 1;
+  }
+
+  TSParser *parser = ts_parser_new();
+  ts_parser_set_language(parser, phases ? tree_sitter_vue3_instrumented() : tree_sitter_vue3());
+  double ticks_per_second = phases ? tree_sitter_vue3_instrumented_ticks_per_second() : 1e9;
+
+  printf("%-40s %9s %9s %12s %12s %10s %10s\n", "file", "bytes", "MB/s", "tokens/s", "nodes/s", "p50_us", "p99_us");
+
+  int status = 0;
+  FileResult total = {"TOTAL", 0, iterations, 0, 0, false, 0, 0, 0, {{{0, 0}}}};
+  // The TOTAL percentiles come from every parse of every file that was
+  // benchmarked, not from the per-file percentiles.
+  uint64_t *samples = (uint64_t *)malloc(path_count * iterations * sizeof(uint64_t));
+  size_t file_count = 0;
+  if (!samples) {
+    fprintf(stderr, "out of memory\n");
+    status = 1;
+    path_count = 0;
+  }
+  for (size_t i = 0; i < path_count; i++) {
+    FileResult result;
+    if (!bench_file(parser, paths[i], warmup, iterations, phases, &samples[file_count * iterations], &result)) {
+      status = 1;
+      continue;
+    }
+    file_count++;
+    print_result(&result);
+    write_result(output, &result, phases, ticks_per_second);
+
+    total.bytes += result.bytes;
+    total.nodes += result.nodes;
+    total.tokens += result.tokens;
+    total.total_ns += result.total_ns;
+    total.has_error = total.has_error || result.has_error;
+    for (unsigned j = 0; j < TS_VUE3_PHASE_COUNT; j++) {
+      total.phases.phases[j].calls += result.phases.phases[j].calls;
+      total.phases.phases[j].ticks += result.phases.phases[j].ticks;
+    }
+  }
+
+  if (file_count > 1) {
+    // total_ns covers file_count parses per iteration, so the rates in the
+    // row are for the whole set.
+    total.p50_ns = bench_percentile(samples, file_count * iterations, 50);
+    total.p99_ns = bench_percentile(samples, file_count * iterations, 99);
+    print_result(&total);
+    write_result(output, &total, phases, ticks_per_second);
+  }
+  write_scanner_stats(output);
+
+  free(samples);
+  ts_parser_delete(parser);
+  fclose(output);
+  free(paths);
+  return status;
+}
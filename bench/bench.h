@@ -0,0 +1,212 @@
+#ifndef TREE_SITTER_VUE3_BENCH_H_
+#define TREE_SITTER_VUE3_BENCH_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define BENCH_DEFAULT_INPUT "../test/app.vue"
+
+static inline uint64_t bench_now_ns(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+}
+
+// Reads a whole file into a NUL-terminated heap buffer. Returns NULL on error.
+static inline char *bench_read_file(const char *path, size_t *length) {
+  FILE *file = fopen(path, "rb");
+  if (!file) return NULL;
+
+  char *data = NULL;
+  size_t size = 0;
+  size_t capacity = 0;
+  for (;;) {
+    if (size + 4096 + 1 > capacity) {
+      size_t new_capacity = capacity ? capacity * 2 : 8192;
+      char *new_data = (char *)realloc(data, new_capacity);
+      if (!new_data) {
+        free(data);
+        fclose(file);
+        return NULL;
+      }
+      data = new_data;
+      capacity = new_capacity;
+    }
+    size_t count = fread(&data[size], 1, capacity - size - 1, file);
+    size += count;
+    if (count == 0) break;
+  }
+
+  bool failed = ferror(file);
+  fclose(file);
+  if (failed) {
+    free(data);
+    return NULL;
+  }
+
+  data[size] = '\0';
+  if (length) {
+    *length = size;
+  }
+  return data;
+}
+
+// Concatenates `copies` copies of `source` so that small fixtures can be
+// scaled up to a measurable size. Returns NULL on allocation failure.
+static inline char *bench_repeat(const char *source, size_t length, size_t copies, size_t *result_length) {
+  if (copies == 0) copies = 1;
+  char *data = (char *)malloc(length * copies + 1);
+  if (!data) return NULL;
+  for (size_t i = 0; i < copies; i++) {
+    memcpy(&data[i * length], source, length);
+  }
+  data[length * copies] = '\0';
+  if (result_length) {
+    *result_length = length * copies;
+  }
+  return data;
+}
+
+typedef struct {
+  const char *name;
+  size_t name_length;
+  const char *input;
+  size_t input_length;
+} BenchCorpusCase;
+
+static inline bool bench_line_is_rule(const char *line, const char *end, char c) {
+  size_t count = 0;
+  while (line < end && *line == c) {
+    line++;
+    count++;
+  }
+  return count >= 3;
+}
+
+// Splits a tree-sitter corpus file (`===` header, input, `---`, expected
+// tree) into its inputs. The cases point into `corpus`. Returns the number of
+// cases found, which may exceed `max_cases`.
+static inline size_t bench_corpus_cases(const char *corpus, size_t length, BenchCorpusCase *cases, size_t max_cases) {
+  const char *end = corpus + length;
+  const char *line = corpus;
+  size_t count = 0;
+
+  while (line < end) {
+    const char *line_end = (const char *)memchr(line, '\n', (size_t)(end - line));
+    if (!line_end) line_end = end;
+    if (!bench_line_is_rule(line, line_end, '=')) {
+      line = line_end + 1;
+      continue;
+    }
+
+    const char *name = line_end + 1;
+    if (name >= end) break;
+    const char *name_end = (const char *)memchr(name, '\n', (size_t)(end - name));
+    if (!name_end) break;
+    const char *closing = name_end + 1;
+    const char *closing_end = (const char *)memchr(closing, '\n', (size_t)(end - closing));
+    if (!closing_end || !bench_line_is_rule(closing, closing_end, '=')) {
+      line = name;
+      continue;
+    }
+
+    const char *input = closing_end + 1;
+    const char *cursor = input;
+    const char *input_end = end;
+    while (cursor < end) {
+      const char *cursor_end = (const char *)memchr(cursor, '\n', (size_t)(end - cursor));
+      if (!cursor_end) cursor_end = end;
+      if (bench_line_is_rule(cursor, cursor_end, '-')) {
+        input_end = cursor;
+        break;
+      }
+      cursor = cursor_end + 1;
+    }
+    if (input_end > input && input_end[-1] == '\n') input_end--;
+
+    if (count < max_cases) {
+      cases[count].name = name;
+      cases[count].name_length = (size_t)(name_end - name);
+      cases[count].input = input;
+      cases[count].input_length = (size_t)(input_end - input);
+    }
+    count++;
+    line = input_end < end ? input_end + 1 : end;
+  }
+
+  return count;
+}
+
+static inline int bench_compare_u64(const void *a, const void *b) {
+  uint64_t left = *(const uint64_t *)a;
+  uint64_t right = *(const uint64_t *)b;
+  return left < right ? -1 : left > right ? 1 : 0;
+}
+
+// Sorts `samples` in place and returns the nearest-rank percentile `p`
+// (0 < p <= 100).
+static inline uint64_t bench_percentile(uint64_t *samples, size_t count, double p) {
+  if (count == 0) return 0;
+  qsort(samples, count, sizeof(uint64_t), bench_compare_u64);
+  size_t rank = (size_t)(p / 100.0 * (double)count + 0.999999);
+  if (rank < 1) rank = 1;
+  if (rank > count) rank = count;
+  return samples[rank - 1];
+}
+
+// Writes `value` as a JSON string literal.
+static inline void bench_json_string(FILE *file, const char *value) {
+  fputc('"', file);
+  for (const unsigned char *c = (const unsigned char *)value; *c; c++) {
+    if (*c == '"' || *c == '\\') {
+      fprintf(file, "\\%c", *c);
+    } else if (*c < 0x20) {
+      fprintf(file, "\\u%04x", *c);
+    } else {
+      fputc(*c, file);
+    }
+  }
+  fputc('"', file);
+}
+
+#ifdef TREE_SITTER_API_H_
+
+const TSLanguage *tree_sitter_vue3(void);
+
+// Counts every node of `tree` and the leaves among them, which are the
+// tokens the parser consumed.
+static inline void bench_count_nodes(const TSTree *tree, uint64_t *node_count, uint64_t *token_count) {
+  uint64_t nodes = 0;
+  uint64_t tokens = 0;
+  TSTreeCursor cursor = ts_tree_cursor_new(ts_tree_root_node(tree));
+  for (;;) {
+    nodes++;
+    if (ts_tree_cursor_goto_first_child(&cursor)) continue;
+    tokens++;
+    while (!ts_tree_cursor_goto_next_sibling(&cursor)) {
+      if (!ts_tree_cursor_goto_parent(&cursor)) {
+        ts_tree_cursor_delete(&cursor);
+        *node_count = nodes;
+        *token_count = tokens;
+        return;
+      }
+    }
+  }
+}
+
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
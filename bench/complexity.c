@@ -0,0 +1,181 @@
+// Complexity regression test. Each risky construct is parsed at sizes n, 2n, 4n
+// and 8n and the growth from one size to the next is checked. Two measures are
+// used: the work count of work_counter.h (lexer and scanner advances plus the
+// tag stack entries the scanner compares), which is deterministic and catches
+// any rescan or stack search, and the best-of-N parse time, which also catches
+// superlinear work in the parser itself. Linear growth doubles both at each
+// step, quadratic growth quadruples them. The test fails when any step grows
+// the work by more than 2.5x, or when the time grows by more than 3.0x per
+// step on average (the mean over all three steps, so one noisy timing does not
+// fail the run).
+//
+//   complexity [-n base_repetitions] [-r runs] [-w work_limit] [-t time_limit] [construct ...]
+
+#include <math.h>
+#include <string.h>
+#include <tree_sitter/api.h>
+
+#include "bench.h"
+#include "work_counter.h"
+
+#define STEPS 4
+#define DEFAULT_BASE 2000
+#define DEFAULT_RUNS 7
+#define DEFAULT_WORK_LIMIT 2.5
+#define DEFAULT_TIME_LIMIT 3.0
+
+typedef struct {
+  const char *name;
+  const char *prefix;
+  // Repeated once per unit of size.
+  const char *open;
+  const char *middle;
+  // Repeated as often as `open`, after it, for nesting.
+  const char *close;
+  const char *suffix;
+} Construct;
+
+static const Construct CONSTRUCTS[] = {
+  {"deep_nesting", "<template>\n", "<div>", "x", "</div>", "\n</template>\n"},
+  {"wide_siblings", "<template>\n<div>\n", "<span class=\"a\">x</span>\n", "", "", "</div>\n</template>\n"},
+  {"long_raw_text", "<script>\n", "const a = b < c ? '</div>' : \"</scr\";\n", "", "", "</script>\n"},
+  {"long_comment", "<template>\n<!-- ", "- commented <div> out -> ", "", "", " -->\n</template>\n"},
+  {"stray_end_tags", "<template>\n<div>\n", "</span>\n", "", "", "</div>\n</template>\n"},
+  // Every stray end tag is looked up in a stack n tags deep.
+  {"deep_stray_end_tags", "<template>\n", "<div>", "\n", "</p>", "\n</template>\n"},
+  {"interpolations", "<template>\n<p>\n", "{{ item.a + b }} text ", "", "", "\n</p>\n</template>\n"},
+};
+
+static char *build(const Construct *construct, size_t units, size_t *length) {
+  size_t prefix_length = strlen(construct->prefix);
+  size_t open_length = strlen(construct->open);
+  size_t middle_length = strlen(construct->middle);
+  size_t close_length = strlen(construct->close);
+  size_t suffix_length = strlen(construct->suffix);
+  size_t size = prefix_length + units * (open_length + close_length) + middle_length + suffix_length;
+  char *data = (char *)malloc(size + 1);
+  if (!data) return NULL;
+
+  char *cursor = data;
+  memcpy(cursor, construct->prefix, prefix_length);
+  cursor += prefix_length;
+  for (size_t i = 0; i < units; i++, cursor += open_length) {
+    memcpy(cursor, construct->open, open_length);
+  }
+  memcpy(cursor, construct->middle, middle_length);
+  cursor += middle_length;
+  for (size_t i = 0; i < units; i++, cursor += close_length) {
+    memcpy(cursor, construct->close, close_length);
+  }
+  memcpy(cursor, construct->suffix, suffix_length);
+  cursor += suffix_length;
+  *cursor = '\0';
+  *length = size;
+  return data;
+}
+
+// Parses `source` `runs` times and returns the fastest time; `work` gets the
+// (identical) work count of one parse.
+static uint64_t parse(TSParser *parser, const char *source, size_t length, unsigned runs, uint64_t *work) {
+  uint64_t best = UINT64_MAX;
+  for (unsigned i = 0; i < runs; i++) {
+    work_counter_reset();
+    uint64_t start = bench_now_ns();
+    TSTree *tree = ts_parser_parse_string(parser, NULL, source, (uint32_t)length);
+    uint64_t elapsed = bench_now_ns() - start;
+    ts_tree_delete(tree);
+    if (elapsed < best) best = elapsed;
+    *work = work_counter_total();
+  }
+  return best;
+}
+
+int main(int argc, char **argv) {
+  size_t base = DEFAULT_BASE;
+  unsigned runs = DEFAULT_RUNS;
+  double work_limit = DEFAULT_WORK_LIMIT;
+  double time_limit = DEFAULT_TIME_LIMIT;
+  const char **selected = (const char **)calloc((size_t)argc + 1, sizeof(char *));
+  size_t selected_count = 0;
+  if (!selected) return 1;
+
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "-n") == 0 && i + 1 < argc) {
+      base = (size_t)strtoull(argv[++i], NULL, 10);
+    } else if (strcmp(argv[i], "-r") == 0 && i + 1 < argc) {
+      runs = (unsigned)strtoul(argv[++i], NULL, 10);
+    } else if (strcmp(argv[i], "-w") == 0 && i + 1 < argc) {
+      work_limit = strtod(argv[++i], NULL);
+    } else if (strcmp(argv[i], "-t") == 0 && i + 1 < argc) {
+      time_limit = strtod(argv[++i], NULL);
+    } else {
+      selected[selected_count++] = argv[i];
+    }
+  }
+  if (base == 0) base = 1;
+  if (runs == 0) runs = 1;
+
+  TSParser *parser = ts_parser_new();
+  ts_parser_set_language(parser, work_counter_language());
+
+  printf("%-20s %6s %10s %12s %10s %8s %8s\n", "construct", "size", "bytes", "work", "best_us", "work_x",
+         "time_x");
+
+  int failures = 0;
+  for (size_t c = 0; c < sizeof(CONSTRUCTS) / sizeof(CONSTRUCTS[0]); c++) {
+    const Construct *construct = &CONSTRUCTS[c];
+    bool wanted = selected_count == 0;
+    for (size_t i = 0; i < selected_count; i++) {
+      if (strcmp(selected[i], construct->name) == 0) wanted = true;
+    }
+    if (!wanted) continue;
+
+    uint64_t previous_work = 0;
+    uint64_t previous_ns = 0;
+    uint64_t first_ns = 0;
+    bool failed = false;
+    for (unsigned step = 0; step < STEPS; step++) {
+      size_t length = 0;
+      char *source = build(construct, base << step, &length);
+      if (!source) {
+        fprintf(stderr, "%s: out of memory\n", construct->name);
+        failed = true;
+        break;
+      }
+
+      uint64_t work = 0;
+      uint64_t ns = parse(parser, source, length, runs, &work);
+      free(source);
+
+      double work_growth = step ? (double)work / (double)(previous_work ? previous_work : 1) : 0;
+      double time_growth = step ? (double)ns / (double)(previous_ns ? previous_ns : 1) : 0;
+      bool over = step && work_growth > work_limit;
+      printf("%-20s %5ux %10zu %12llu %10.1f", construct->name, 1u << step, length,
+             (unsigned long long)work, ns / 1e3);
+      if (step) {
+        printf(" %8.2f %8.2f%s\n", work_growth, time_growth, over ? "  SUPERLINEAR" : "");
+      } else {
+        printf(" %8s %8s\n", "-", "-");
+      }
+      failed = failed || over;
+      if (step == 0) first_ns = ns;
+      previous_work = work;
+      previous_ns = ns;
+    }
+
+    double mean_time_growth = pow((double)previous_ns / (double)(first_ns ? first_ns : 1), 1.0 / (STEPS - 1));
+    if (mean_time_growth > time_limit) {
+      printf("%-20s mean time growth %.2fx per step  SUPERLINEAR\n", construct->name, mean_time_growth);
+      failed = true;
+    }
+    if (failed) failures++;
+  }
+
+  ts_parser_delete(parser);
+  free(selected);
+  if (failures) {
+    fprintf(stderr, "%d construct%s scaled worse than linearly\n", failures, failures == 1 ? "" : "s");
+    return 1;
+  }
+  return 0;
+}
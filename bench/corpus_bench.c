@@ -0,0 +1,268 @@
+// Throughput and memory over bench-corpus/, the corpus of production-shaped
+// components written by script/generate-bench-corpus.js. Every file listed in
+// the manifest is parsed -n times (default 10) for its median time, and once
+// more with a fresh parser under a counting allocator for its peak memory and
+// the bytes its tree retains. The results are summed per category and per
+// feature tag from the manifest, so a regression in, say, SVG-heavy or
+// i18n components shows up on its own line instead of being averaged away.
+// Results go to stdout as a table and to corpus_output.txt as one JSON object
+// per category and feature.
+//
+//   corpus_bench [-n runs] [-m manifest.json] [-o output] [category|feature ...]
+//
+// Naming categories or features parses only the files that have one of them.
+
+#include <string.h>
+#include <tree_sitter/api.h>
+
+#include "bench.h"
+#include "counting_allocator.h"
+
+#define DEFAULT_MANIFEST "../bench-corpus/manifest.json"
+#define DEFAULT_OUTPUT "../corpus_output.txt"
+#define DEFAULT_RUNS 10
+#define MAX_FEATURES 16
+#define MAX_GROUPS 128
+
+typedef struct {
+  char file[256];
+  char category[64];
+  char features[MAX_FEATURES][64];
+  size_t feature_count;
+} ManifestEntry;
+
+typedef struct {
+  char name[80];
+  size_t files;
+  size_t bytes;
+  uint64_t median_ns;
+  size_t peak_bytes;
+  size_t max_peak_bytes;
+  size_t tree_bytes;
+  size_t errors;
+  // Median parse time per KB of every file in the group, for percentiles.
+  uint64_t *ns_per_kb;
+  size_t ns_per_kb_capacity;
+} Group;
+
+static Group groups[MAX_GROUPS];
+static size_t group_count;
+
+// Copies the JSON string value of `key` in `line` into `value`. Manifest
+// values never contain escapes.
+static const char *manifest_string(const char *line, const char *key, char *value, size_t size) {
+  const char *start = strstr(line, key);
+  if (!start) return NULL;
+  start += strlen(key);
+  const char *end = strchr(start, '"');
+  if (!end || (size_t)(end - start) >= size) return NULL;
+  memcpy(value, start, (size_t)(end - start));
+  value[end - start] = '\0';
+  return end + 1;
+}
+
+static bool manifest_entry(const char *line, ManifestEntry *entry) {
+  memset(entry, 0, sizeof(*entry));
+  if (!manifest_string(line, "\"file\":\"", entry->file, sizeof(entry->file))) return false;
+  if (!manifest_string(line, "\"category\":\"", entry->category, sizeof(entry->category))) return false;
+  const char *cursor = strstr(line, "\"features\":[");
+  const char *end = cursor ? strchr(cursor, ']') : NULL;
+  if (!cursor) return true;
+  cursor += strlen("\"features\":[");
+  while (entry->feature_count < MAX_FEATURES && cursor < end) {
+    cursor = manifest_string(cursor, "\"", entry->features[entry->feature_count], 64);
+    if (!cursor || cursor > end) break;
+    entry->feature_count++;
+  }
+  return true;
+}
+
+static Group *group_named(const char *kind, const char *name) {
+  char full_name[sizeof(groups[0].name)];
+  snprintf(full_name, sizeof(full_name), "%s:%s", kind, name);
+  for (size_t i = 0; i < group_count; i++) {
+    if (strcmp(groups[i].name, full_name) == 0) return &groups[i];
+  }
+  if (group_count == MAX_GROUPS) return NULL;
+  Group *group = &groups[group_count++];
+  memcpy(group->name, full_name, sizeof(full_name));
+  return group;
+}
+
+typedef struct {
+  size_t bytes;
+  uint64_t median_ns;
+  size_t peak_bytes;
+  size_t tree_bytes;
+  bool has_error;
+} FileResult;
+
+static void add_to_group(Group *group, const FileResult *result) {
+  if (!group) return;
+  if (group->files == group->ns_per_kb_capacity) {
+    size_t capacity = group->ns_per_kb_capacity ? group->ns_per_kb_capacity * 2 : 64;
+    uint64_t *samples = (uint64_t *)realloc(group->ns_per_kb, capacity * sizeof(uint64_t));
+    if (!samples) return;
+    group->ns_per_kb = samples;
+    group->ns_per_kb_capacity = capacity;
+  }
+  group->ns_per_kb[group->files++] = result->median_ns * 1024 / (result->bytes ? result->bytes : 1);
+  group->bytes += result->bytes;
+  group->median_ns += result->median_ns;
+  group->peak_bytes += result->peak_bytes;
+  if (result->peak_bytes > group->max_peak_bytes) group->max_peak_bytes = result->peak_bytes;
+  group->tree_bytes += result->tree_bytes;
+  if (result->has_error) group->errors++;
+}
+
+static bool measure(TSParser *parser, const char *source, size_t length, unsigned runs, uint64_t *samples,
+                    FileResult *result) {
+  memset(result, 0, sizeof(*result));
+  result->bytes = length;
+  for (unsigned i = 0; i < runs; i++) {
+    uint64_t start = bench_now_ns();
+    TSTree *tree = ts_parser_parse_string(parser, NULL, source, (uint32_t)length);
+    samples[i] = bench_now_ns() - start;
+    if (!tree) return false;
+    ts_tree_delete(tree);
+  }
+  result->median_ns = bench_percentile(samples, runs, 50);
+
+  // The memory parse uses a fresh parser, so that its own buffers count
+  // towards the peak the way they do for an editor opening the file.
+  size_t baseline = counters.current;
+  counting_allocator_reset_peak();
+  TSParser *fresh = ts_parser_new();
+  ts_parser_set_language(fresh, tree_sitter_vue3());
+  TSTree *tree = ts_parser_parse_string(fresh, NULL, source, (uint32_t)length);
+  result->peak_bytes = counters.peak - baseline;
+  ts_parser_delete(fresh);
+  if (!tree) return false;
+  result->tree_bytes = counters.current - baseline;
+  result->has_error = ts_node_has_error(ts_tree_root_node(tree));
+  ts_tree_delete(tree);
+  return true;
+}
+
+static double per_kb(double value, size_t bytes) {
+  return bytes ? value * 1024.0 / (double)bytes : 0.0;
+}
+
+static void report(FILE *output, Group *group) {
+  double seconds = (double)group->median_ns / 1e9;
+  double mb_per_s = seconds > 0 ? (double)group->bytes / (1024.0 * 1024.0) / seconds : 0.0;
+  uint64_t p50 = bench_percentile(group->ns_per_kb, group->files, 50);
+  uint64_t p90 = bench_percentile(group->ns_per_kb, group->files, 90);
+  double peak_per_kb = per_kb((double)group->peak_bytes, group->bytes);
+  double tree_per_kb = per_kb((double)group->tree_bytes, group->bytes);
+
+  printf("%-28s %6zu %10zu %9.2f %9.1f %9.1f %9.0f %9.0f %10zu %6zu\n", group->name, group->files, group->bytes,
+         mb_per_s, p50 / 1e3, p90 / 1e3, peak_per_kb, tree_per_kb, group->max_peak_bytes, group->errors);
+
+  fputs("{\"group\":", output);
+  bench_json_string(output, group->name);
+  fprintf(output,
+          ",\"files\":%zu,\"bytes\":%zu,\"mb_per_s\":%.3f,\"us_per_kb\":{\"p50\":%.2f,\"p90\":%.2f}"
+          ",\"peak_bytes_per_kb\":%.1f,\"tree_bytes_per_kb\":%.1f,\"max_peak_bytes\":%zu,\"errors\":%zu}\n",
+          group->files, group->bytes, mb_per_s, p50 / 1e3, p90 / 1e3, peak_per_kb, tree_per_kb,
+          group->max_peak_bytes, group->errors);
+}
+
+static bool wanted(const ManifestEntry *entry, const char **selected, size_t selected_count) {
+  if (selected_count == 0) return true;
+  for (size_t i = 0; i < selected_count; i++) {
+    if (strcmp(selected[i], entry->category) == 0) return true;
+    for (size_t f = 0; f < entry->feature_count; f++) {
+      if (strcmp(selected[i], entry->features[f]) == 0) return true;
+    }
+  }
+  return false;
+}
+
+int main(int argc, char **argv) {
+  counting_allocator_install();
+
+  const char *manifest_path = DEFAULT_MANIFEST;
+  const char *output_path = DEFAULT_OUTPUT;
+  unsigned runs = DEFAULT_RUNS;
+  const char **selected = (const char **)calloc((size_t)argc + 1, sizeof(char *));
+  size_t selected_count = 0;
+  if (!selected) return 1;
+
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "-n") == 0 && i + 1 < argc) {
+      runs = (unsigned)strtoul(argv[++i], NULL, 10);
+    } else if (strcmp(argv[i], "-m") == 0 && i + 1 < argc) {
+      manifest_path = argv[++i];
+    } else if (strcmp(argv[i], "-o") == 0 && i + 1 < argc) {
+      output_path = argv[++i];
+    } else {
+      selected[selected_count++] = argv[i];
+    }
+  }
+  if (runs == 0) runs = 1;
+
+  size_t manifest_length = 0;
+  char *manifest = bench_read_file(manifest_path, &manifest_length);
+  if (!manifest) {
+    fprintf(stderr, "could not read %s; run `npm run bench-corpus` to generate it\n", manifest_path);
+    return 1;
+  }
+
+  // Files are named relative to the manifest.
+  const char *slash = strrchr(manifest_path, '/');
+  int directory_length = slash ? (int)(slash - manifest_path) : 1;
+  const char *directory = slash ? manifest_path : ".";
+
+  uint64_t *samples = (uint64_t *)malloc(runs * sizeof(uint64_t));
+  TSParser *parser = ts_parser_new();
+  ts_parser_set_language(parser, tree_sitter_vue3());
+  Group *total = group_named("all", "corpus");
+  int status = 0;
+
+  for (char *line = manifest, *next; line && *line; line = next) {
+    next = strchr(line, '\n');
+    if (next) *next++ = '\0';
+    ManifestEntry entry;
+    if (!manifest_entry(line, &entry) || !wanted(&entry, selected, selected_count)) continue;
+
+    char path[512];
+    snprintf(path, sizeof(path), "%.*s/%s", directory_length, directory, entry.file);
+    size_t length = 0;
+    char *source = bench_read_file(path, &length);
+    FileResult result;
+    if (!source || !measure(parser, source, length, runs, samples, &result)) {
+      fprintf(stderr, "could not %s %s\n", source ? "parse" : "read", path);
+      free(source);
+      status = 1;
+      continue;
+    }
+    free(source);
+
+    add_to_group(total, &result);
+    add_to_group(group_named("category", entry.category), &result);
+    for (size_t f = 0; f < entry.feature_count; f++) {
+      add_to_group(group_named("feature", entry.features[f]), &result);
+    }
+  }
+
+  FILE *output = fopen(output_path, "w");
+  if (!output) {
+    fprintf(stderr, "could not open %s\n", output_path);
+    status = 1;
+  } else {
+    printf("%-28s %6s %10s %9s %9s %9s %9s %9s %10s %6s\n", "group", "files", "bytes", "MB/s", "p50us/KB",
+           "p90us/KB", "peak/KB", "tree/KB", "max_peak", "errors");
+    for (size_t i = 0; i < group_count; i++) {
+      if (groups[i].files) report(output, &groups[i]);
+    }
+    fclose(output);
+  }
+
+  for (size_t i = 0; i < group_count; i++) free(groups[i].ns_per_kb);
+  ts_parser_delete(parser);
+  free(samples);
+  free(manifest);
+  free(selected);
+  return status;
+}
@@ -0,0 +1,73 @@
+#ifndef TREE_SITTER_VUE3_COUNTING_ALLOCATOR_H_
+#define TREE_SITTER_VUE3_COUNTING_ALLOCATOR_H_
+
+// An allocator for ts_set_allocator that tracks the bytes libtree-sitter has
+// allocated, their peak and the number of allocations. Install it with
+// counting_allocator_install() before creating any parser or tree.
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <tree_sitter/api.h>
+
+typedef struct {
+  size_t current;
+  size_t peak;
+  uint64_t allocations;
+} AllocationCounters;
+
+// Blocks carry their size in a header so that free and realloc can keep
+// `current` exact.
+typedef union {
+  size_t size;
+  max_align_t align;
+} BlockHeader;
+
+static AllocationCounters counters;
+
+static inline void *counted(BlockHeader *header, size_t size) {
+  if (!header) return NULL;
+  header->size = size;
+  counters.current += size;
+  counters.allocations++;
+  if (counters.current > counters.peak) counters.peak = counters.current;
+  return header + 1;
+}
+
+static inline void *counting_malloc(size_t size) {
+  return counted((BlockHeader *)malloc(sizeof(BlockHeader) + size), size);
+}
+
+static inline void *counting_calloc(size_t count, size_t size) {
+  if (size && count > (SIZE_MAX - sizeof(BlockHeader)) / size) return NULL;
+  return counted((BlockHeader *)calloc(1, sizeof(BlockHeader) + count * size), count * size);
+}
+
+static inline void *counting_realloc(void *pointer, size_t size) {
+  if (!pointer) return counting_malloc(size);
+  BlockHeader *header = (BlockHeader *)pointer - 1;
+  size_t old_size = header->size;
+  header = (BlockHeader *)realloc(header, sizeof(BlockHeader) + size);
+  if (!header) return NULL;
+  counters.current -= old_size;
+  counters.allocations--;
+  return counted(header, size);
+}
+
+static inline void counting_free(void *pointer) {
+  if (!pointer) return;
+  BlockHeader *header = (BlockHeader *)pointer - 1;
+  counters.current -= header->size;
+  free(header);
+}
+
+static inline void counting_allocator_install(void) {
+  ts_set_allocator(counting_malloc, counting_calloc, counting_realloc, counting_free);
+}
+
+// Starts a new peak measurement from the current allocation level.
+static inline void counting_allocator_reset_peak(void) {
+  counters.peak = counters.current;
+}
+
+#endif  // TREE_SITTER_VUE3_COUNTING_ALLOCATOR_H_
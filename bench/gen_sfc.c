@@ -0,0 +1,34 @@
+// Writes a synthetic Vue SFC to stdout.
+//
+//   gen_sfc [name=value ...]
+//
+// Names: seed, depth, fanout, attributes, directives, interpolation, script,
+// style, components, malformed. See SfcOptions in sfc_gen.h.
+
+#include <stdio.h>
+#include <string.h>
+
+#include "sfc_gen.h"
+
+int main(int argc, char **argv) {
+  SfcOptions options = SFC_DEFAULT_OPTIONS;
+  for (int i = 1; i < argc; i++) {
+    char *separator = strchr(argv[i], '=');
+    if (!separator) {
+      fprintf(stderr, "expected name=value, got %s\n", argv[i]);
+      return 1;
+    }
+    *separator = '\0';
+    if (!sfc_set_option(&options, argv[i], separator + 1)) {
+      fprintf(stderr, "unknown option %s\n", argv[i]);
+      return 1;
+    }
+  }
+
+  size_t length = 0;
+  char *source = sfc_generate(&options, &length);
+  if (!source) return 1;
+  fwrite(source, 1, length, stdout);
+  free(source);
+  return 0;
+}
@@ -0,0 +1,438 @@
+// Keystroke-replay incremental parsing. Each document is parsed once, then an
+// edit trace is replayed one keystroke at a time: the edit is applied with
+// ts_tree_edit and the document is reparsed against the old tree. Reports
+// per-keystroke latency percentiles, changed-range sizes and bytes re-lexed,
+// on stdout as a table and in incremental_output.txt as one JSON object per
+// line.
+//
+//   incremental [-o output] [-t trace.txt] [-g name=value,...] [file.vue ...]
+//
+// Without -t three traces are synthesized per document: typing inside the
+// first interpolation, adding an attribute to a start tag and backspacing
+// through an end tag. A recorded trace has one edit per line:
+//
+//   <start byte> <deleted bytes> <inserted text>
+//
+// where the inserted text may use \n, \t and \\ escapes. Each -g adds a
+// component generated by sfc_gen.h with the given options. With no inputs,
+// test/app.vue and a generated depth=5 component are used.
+//
+// Bytes re-lexed are the sizes of the tokens the parser had to lex again
+// rather than reuse, taken from the parser's log in a second, untimed reparse.
+
+#include <string.h>
+#include <tree_sitter/api.h>
+
+#include "bench.h"
+#include "sfc_gen.h"
+
+#define DEFAULT_OUTPUT "../incremental_output.txt"
+#define DEFAULT_GENERATED "depth=5"
+
+typedef struct {
+  uint32_t start;
+  uint32_t deleted;
+  const char *inserted;
+  uint32_t inserted_length;
+} Edit;
+
+typedef struct {
+  Edit *edits;
+  size_t count;
+  size_t capacity;
+  char *storage;
+} Trace;
+
+typedef struct {
+  char *data;
+  size_t length;
+  size_t capacity;
+} Document;
+
+typedef struct {
+  uint64_t tokens;
+  uint64_t bytes;
+} LexLog;
+
+typedef struct {
+  const char *document;
+  const char *trace;
+  size_t bytes;
+  size_t keystrokes;
+  uint64_t p50_ns;
+  uint64_t p90_ns;
+  uint64_t p99_ns;
+  uint64_t max_ns;
+  uint64_t total_ns;
+  uint64_t changed_ranges;
+  uint64_t changed_bytes;
+  uint64_t max_changed_bytes;
+  uint64_t relexed_tokens;
+  uint64_t relexed_bytes;
+  bool has_error;
+} TraceResult;
+
+static bool trace_push(Trace *trace, uint32_t start, uint32_t deleted, const char *inserted, uint32_t inserted_length) {
+  if (trace->count == trace->capacity) {
+    size_t capacity = trace->capacity ? trace->capacity * 2 : 64;
+    Edit *edits = (Edit *)realloc(trace->edits, capacity * sizeof(Edit));
+    if (!edits) return false;
+    trace->edits = edits;
+    trace->capacity = capacity;
+  }
+  trace->edits[trace->count++] = (Edit){start, deleted, inserted, inserted_length};
+  return true;
+}
+
+static void trace_clear(Trace *trace) {
+  free(trace->edits);
+  free(trace->storage);
+  memset(trace, 0, sizeof(*trace));
+}
+
+// Parses a recorded trace. The inserted strings are unescaped in place and
+// point into `trace->storage`.
+static bool trace_load(Trace *trace, const char *path) {
+  size_t length = 0;
+  char *data = bench_read_file(path, &length);
+  if (!data) return false;
+  trace->storage = data;
+
+  char *line = data;
+  while (line < data + length) {
+    char *end = (char *)memchr(line, '\n', (size_t)(data + length - line));
+    if (!end) end = data + length;
+    *end = '\0';
+
+    char *cursor = line;
+    unsigned long start = strtoul(cursor, &cursor, 10);
+    unsigned long deleted = strtoul(cursor, &cursor, 10);
+    if (cursor != line && *line != '#') {
+      if (*cursor == ' ') cursor++;
+      char *inserted = cursor;
+      char *out = cursor;
+      for (char *in = cursor; *in; in++) {
+        if (*in == '\\' && in[1]) {
+          in++;
+          *out++ = *in == 'n' ? '\n' : *in == 't' ? '\t' : *in;
+        } else {
+          *out++ = *in;
+        }
+      }
+      if (!trace_push(trace, (uint32_t)start, (uint32_t)deleted, inserted, (uint32_t)(out - inserted))) return false;
+    }
+    line = end + 1;
+  }
+  return true;
+}
+
+static const char *find_from(const Document *document, size_t from, const char *needle) {
+  size_t needle_length = strlen(needle);
+  for (size_t i = from; i + needle_length <= document->length; i++) {
+    if (memcmp(&document->data[i], needle, needle_length) == 0) return &document->data[i];
+  }
+  return NULL;
+}
+
+// Types " + count" one character at a time after the first `{{`.
+static bool synthesize_interpolation(const Document *document, Trace *trace) {
+  static const char typed[] = " + count";
+  const char *open = find_from(document, 0, "{{");
+  if (!open) return false;
+  uint32_t position = (uint32_t)(open - document->data) + 2;
+  for (uint32_t i = 0; i < sizeof(typed) - 1; i++) {
+    if (!trace_push(trace, position + i, 0, &typed[i], 1)) return false;
+  }
+  return true;
+}
+
+// Types ` data-new="1"` after the name of the first start tag in the second
+// half of the document.
+static bool synthesize_attribute(const Document *document, Trace *trace) {
+  static const char typed[] = " data-new=\"1\"";
+  for (size_t i = document->length / 2; i + 1 < document->length; i++) {
+    if (document->data[i] != '<' || !((document->data[i + 1] | 0x20) >= 'a' && (document->data[i + 1] | 0x20) <= 'z')) {
+      continue;
+    }
+    size_t end = i + 1;
+    while (end < document->length && !strchr(" \t\n/>", document->data[end])) end++;
+    for (uint32_t j = 0; j < sizeof(typed) - 1; j++) {
+      if (!trace_push(trace, (uint32_t)end + j, 0, &typed[j], 1)) return false;
+    }
+    return true;
+  }
+  return false;
+}
+
+// Backspaces through the first end tag in the second half of the document.
+static bool synthesize_delete_tag(const Document *document, Trace *trace) {
+  const char *open = find_from(document, document->length / 2, "</");
+  if (!open) open = find_from(document, 0, "</");
+  if (!open) return false;
+  const char *close = (const char *)memchr(open, '>', (size_t)(document->data + document->length - open));
+  if (!close) return false;
+  for (uint32_t end = (uint32_t)(close - document->data) + 1; end > (uint32_t)(open - document->data); end--) {
+    if (!trace_push(trace, end - 1, 1, "", 0)) return false;
+  }
+  return true;
+}
+
+static TSPoint point_at(const Document *document, size_t byte) {
+  TSPoint point = {0, 0};
+  for (size_t i = 0; i < byte && i < document->length; i++) {
+    if (document->data[i] == '\n') {
+      point.row++;
+      point.column = 0;
+    } else {
+      point.column++;
+    }
+  }
+  return point;
+}
+
+// Applies `edit` to the text and fills in the matching TSInputEdit. Edits past
+// the end of the document are rejected.
+static bool document_apply(Document *document, const Edit *edit, TSInputEdit *input_edit) {
+  if ((size_t)edit->start + edit->deleted > document->length) return false;
+
+  size_t length = document->length - edit->deleted + edit->inserted_length;
+  if (length + 1 > document->capacity) {
+    size_t capacity = document->capacity ? document->capacity : 4096;
+    while (capacity < length + 1) capacity *= 2;
+    char *data = (char *)realloc(document->data, capacity);
+    if (!data) return false;
+    document->data = data;
+    document->capacity = capacity;
+  }
+
+  input_edit->start_byte = edit->start;
+  input_edit->old_end_byte = edit->start + edit->deleted;
+  input_edit->new_end_byte = edit->start + edit->inserted_length;
+  input_edit->start_point = point_at(document, input_edit->start_byte);
+  input_edit->old_end_point = point_at(document, input_edit->old_end_byte);
+
+  char *tail = &document->data[edit->start + edit->deleted];
+  memmove(&document->data[edit->start + edit->inserted_length], tail,
+          document->length - edit->start - edit->deleted);
+  memcpy(&document->data[edit->start], edit->inserted, edit->inserted_length);
+  document->length = length;
+  document->data[length] = '\0';
+
+  input_edit->new_end_point = point_at(document, input_edit->new_end_byte);
+  return true;
+}
+
+// Sums the tokens the parser lexes, from its `lexed_lookahead sym:..., size:N`
+// messages.
+static void log_lexed(void *payload, TSLogType type, const char *message) {
+  (void)type;
+  LexLog *log = (LexLog *)payload;
+  if (strncmp(message, "lexed_lookahead", 15) != 0) return;
+  const char *size = strstr(message, ", size:");
+  if (!size) return;
+  log->tokens++;
+  log->bytes += strtoull(size + 7, NULL, 10);
+}
+
+static bool replay(TSParser *parser, const char *name, const char *source, size_t length, const char *trace_name,
+                   const Trace *trace, TraceResult *result) {
+  Document document = {NULL, 0, 0};
+  document.data = (char *)malloc(length + 1);
+  uint64_t *samples = (uint64_t *)malloc((trace->count ? trace->count : 1) * sizeof(uint64_t));
+  if (!document.data || !samples) {
+    free(document.data);
+    free(samples);
+    return false;
+  }
+  memcpy(document.data, source, length);
+  document.data[length] = '\0';
+  document.length = length;
+  document.capacity = length + 1;
+
+  memset(result, 0, sizeof(*result));
+  result->document = name;
+  result->trace = trace_name;
+  result->bytes = length;
+
+  TSTree *tree = ts_parser_parse_string(parser, NULL, document.data, (uint32_t)document.length);
+  for (size_t i = 0; i < trace->count; i++) {
+    TSInputEdit input_edit;
+    if (!document_apply(&document, &trace->edits[i], &input_edit)) continue;
+    ts_tree_edit(tree, &input_edit);
+    TSTree *old_tree = ts_tree_copy(tree);
+
+    uint64_t start = bench_now_ns();
+    TSTree *new_tree = ts_parser_parse_string(parser, tree, document.data, (uint32_t)document.length);
+    uint64_t elapsed = bench_now_ns() - start;
+    samples[result->keystrokes++] = elapsed;
+    result->total_ns += elapsed;
+    if (elapsed > result->max_ns) result->max_ns = elapsed;
+
+    uint32_t range_count = 0;
+    TSRange *ranges = ts_tree_get_changed_ranges(tree, new_tree, &range_count);
+    uint64_t changed_bytes = 0;
+    for (uint32_t j = 0; j < range_count; j++) {
+      changed_bytes += ranges[j].end_byte - ranges[j].start_byte;
+    }
+    free(ranges);
+    result->changed_ranges += range_count;
+    result->changed_bytes += changed_bytes;
+    if (changed_bytes > result->max_changed_bytes) result->max_changed_bytes = changed_bytes;
+
+    LexLog log = {0, 0};
+    ts_parser_set_logger(parser, (TSLogger){&log, log_lexed});
+    ts_tree_delete(ts_parser_parse_string(parser, old_tree, document.data, (uint32_t)document.length));
+    ts_parser_set_logger(parser, (TSLogger){NULL, NULL});
+    result->relexed_tokens += log.tokens;
+    result->relexed_bytes += log.bytes;
+
+    ts_tree_delete(old_tree);
+    ts_tree_delete(tree);
+    tree = new_tree;
+  }
+  result->has_error = ts_node_has_error(ts_tree_root_node(tree));
+  ts_tree_delete(tree);
+
+  if (result->keystrokes) {
+    result->p50_ns = bench_percentile(samples, result->keystrokes, 50);
+    result->p90_ns = bench_percentile(samples, result->keystrokes, 90);
+    result->p99_ns = bench_percentile(samples, result->keystrokes, 99);
+  }
+  free(samples);
+  free(document.data);
+  return true;
+}
+
+static void print_result(const TraceResult *result) {
+  double keystrokes = result->keystrokes ? (double)result->keystrokes : 1.0;
+  printf("%-28s %-14s %9zu %6zu %9.1f %9.1f %9.1f %9.1f %10.0f %10.0f%s\n", result->document, result->trace,
+         result->bytes, result->keystrokes, result->p50_ns / 1e3, result->p90_ns / 1e3, result->p99_ns / 1e3,
+         result->max_ns / 1e3, result->changed_bytes / keystrokes, result->relexed_bytes / keystrokes,
+         result->has_error ? "  (has errors)" : "");
+}
+
+static void write_result(FILE *output, const TraceResult *result) {
+  double keystrokes = result->keystrokes ? (double)result->keystrokes : 1.0;
+  fputs("{\"document\":", output);
+  bench_json_string(output, result->document);
+  fputs(",\"trace\":", output);
+  bench_json_string(output, result->trace);
+  fprintf(output,
+          ",\"bytes\":%zu,\"keystrokes\":%zu,\"has_error\":%s"
+          ",\"mean_ns\":%.0f,\"p50_ns\":%llu,\"p90_ns\":%llu,\"p99_ns\":%llu,\"max_ns\":%llu"
+          ",\"changed_ranges\":%llu,\"changed_bytes\":%llu,\"max_changed_bytes\":%llu"
+          ",\"relexed_tokens\":%llu,\"relexed_bytes\":%llu,\"relexed_bytes_per_keystroke\":%.1f}\n",
+          result->bytes, result->keystrokes, result->has_error ? "true" : "false",
+          (double)result->total_ns / keystrokes, (unsigned long long)result->p50_ns,
+          (unsigned long long)result->p90_ns, (unsigned long long)result->p99_ns,
+          (unsigned long long)result->max_ns, (unsigned long long)result->changed_ranges,
+          (unsigned long long)result->changed_bytes, (unsigned long long)result->max_changed_bytes,
+          (unsigned long long)result->relexed_tokens, (unsigned long long)result->relexed_bytes,
+          result->relexed_bytes / keystrokes);
+}
+
+static char *generate(const char *spec, size_t *length) {
+  SfcOptions options = SFC_DEFAULT_OPTIONS;
+  if (!sfc_parse_options(&options, spec)) {
+    fprintf(stderr, "unknown generator option in %s\n", spec);
+  }
+  return sfc_generate(&options, length);
+}
+
+int main(int argc, char **argv) {
+  const char *output_path = DEFAULT_OUTPUT;
+  const char *trace_path = NULL;
+  const char **inputs = (const char **)calloc((size_t)argc + 2, sizeof(char *));
+  bool *generated = (bool *)calloc((size_t)argc + 2, sizeof(bool));
+  size_t input_count = 0;
+  if (!inputs || !generated) return 1;
+
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "-o") == 0 && i + 1 < argc) {
+      output_path = argv[++i];
+    } else if (strcmp(argv[i], "-t") == 0 && i + 1 < argc) {
+      trace_path = argv[++i];
+    } else if (strcmp(argv[i], "-g") == 0 && i + 1 < argc) {
+      generated[input_count] = true;
+      inputs[input_count++] = argv[++i];
+    } else {
+      inputs[input_count++] = argv[i];
+    }
+  }
+  if (input_count == 0) {
+    inputs[input_count++] = BENCH_DEFAULT_INPUT;
+    generated[input_count] = true;
+    inputs[input_count++] = DEFAULT_GENERATED;
+  }
+
+  Trace recorded = {NULL, 0, 0, NULL};
+  if (trace_path && !trace_load(&recorded, trace_path)) {
+    fprintf(stderr, "could not read %s\n", trace_path);
+    return 1;
+  }
+
+  FILE *output = fopen(output_path, "w");
+  if (!output) {
+    fprintf(stderr, "could not open %s\n", output_path);
+    return 1;
+  }
+
+  TSParser *parser = ts_parser_new();
+  ts_parser_set_language(parser, tree_sitter_vue3());
+
+  printf("%-28s %-14s %9s %6s %9s %9s %9s %9s %10s %10s\n", "document", "trace", "bytes", "keys", "p50_us",
+         "p90_us", "p99_us", "max_us", "changed/k", "relexed/k");
+
+  int status = 0;
+  for (size_t i = 0; i < input_count; i++) {
+    size_t length = 0;
+    char *source = generated[i] ? generate(inputs[i], &length) : bench_read_file(inputs[i], &length);
+    if (!source) {
+      fprintf(stderr, "could not read %s\n", inputs[i]);
+      status = 1;
+      continue;
+    }
+
+    Document document = {source, length, length + 1};
+    static const struct {
+      const char *name;
+      bool (*synthesize)(const Document *, Trace *);
+    } SYNTHESIZED[] = {
+      {"interpolation", synthesize_interpolation},
+      {"attribute", synthesize_attribute},
+      {"delete-tag", synthesize_delete_tag},
+    };
+
+    size_t trace_count = trace_path ? 1 : sizeof(SYNTHESIZED) / sizeof(SYNTHESIZED[0]);
+    for (size_t j = 0; j < trace_count; j++) {
+      Trace synthesized = {NULL, 0, 0, NULL};
+      const Trace *trace = &recorded;
+      const char *trace_name = trace_path;
+      if (!trace_path) {
+        trace_name = SYNTHESIZED[j].name;
+        if (!SYNTHESIZED[j].synthesize(&document, &synthesized)) {
+          trace_clear(&synthesized);
+          continue;
+        }
+        trace = &synthesized;
+      }
+
+      TraceResult result;
+      if (replay(parser, inputs[i], source, length, trace_name, trace, &result)) {
+        print_result(&result);
+        write_result(output, &result);
+      } else {
+        status = 1;
+      }
+      trace_clear(&synthesized);
+    }
+    free(source);
+  }
+
+  trace_clear(&recorded);
+  ts_parser_delete(parser);
+  fclose(output);
+  free(generated);
+  free(inputs);
+  return status;
+}
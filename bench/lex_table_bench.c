@@ -0,0 +1,135 @@
+// Times the table-driven lexer against the generated `ts_lex` on attribute-
+// and directive-heavy templates. For each lex state the parse table uses, the
+// input is tokenized from start to end in that state, restarting after each
+// token (or after one character when nothing matches).
+
+#include <string.h>
+
+#include "../src/parser_table_lexer.c"
+#include "bench.h"
+#include "mock_lexer.h"
+
+typedef bool (*LexFunction)(TSLexer *, TSStateId);
+
+static const char *const TEMPLATE_ELEMENTS[] = {
+  "<my-row v-for=\"(item, index) in items\" :key=\"item.id\" :class=\"{ active: index === selected }\""
+  " @click.stop=\"select(index)\" data-index=\"1\">{{ item.label }}</my-row>\n",
+  "<input v-model.trim.lazy=\"form.name\" type=\"text\" :disabled='!editable' @keyup.enter=\"submit\""
+  " v-bind:[dynamicAttr]=\"value\" required />\n",
+  "<template #header=\"{ title }\"><h2 v-if=\"title\" v-html=\"title\" class=header></h2>"
+  "<p v-else-if=\"loading\" v-show=\"!done\">{{ t('loading') }}</p><p v-else>-</p></template>\n",
+  "<el-table-column v-slot:default=\"scope\" prop=\"name\" label=\"Name\" width=180 sortable"
+  " v-on:sort-change.native=\"onSort\" v-custom.a.b=\"x\" />\n",
+};
+
+static const size_t TEMPLATE_ELEMENT_COUNT = sizeof(TEMPLATE_ELEMENTS) / sizeof(TEMPLATE_ELEMENTS[0]);
+
+static char *build_template(size_t target_length, size_t *length) {
+  size_t capacity = target_length + 1024;
+  char *data = (char *)malloc(capacity);
+  if (!data) return NULL;
+
+  size_t size = 0;
+  size_t prefix = strlen("<template>\n");
+  memcpy(data, "<template>\n", prefix);
+  size += prefix;
+  for (size_t i = 0; size < target_length; i++) {
+    const char *element = TEMPLATE_ELEMENTS[i % TEMPLATE_ELEMENT_COUNT];
+    size_t element_length = strlen(element);
+    if (size + element_length + 16 > capacity) break;
+    memcpy(&data[size], element, element_length);
+    size += element_length;
+  }
+  memcpy(&data[size], "</template>\n", 12);
+  size += 12;
+  data[size] = '\0';
+  *length = size;
+  return data;
+}
+
+static uint64_t walk(LexFunction lex, MockLexer *lexer, TSStateId state, uint64_t *token_count) {
+  uint64_t tokens = 0;
+  size_t position = 0;
+  while (position < lexer->length) {
+    mock_lexer_reset(lexer, position);
+    size_t next = position + 1;
+    if (lex(&lexer->lexer, state) && lexer->token_end > position) {
+      tokens++;
+      next = lexer->token_end;
+    }
+    while (next < lexer->length && ((uint8_t)lexer->input[next] & 0xC0) == 0x80) {
+      next++;
+    }
+    position = next;
+  }
+  *token_count = tokens;
+  return tokens;
+}
+
+static double time_walk(LexFunction lex, MockLexer *lexer, TSStateId state, unsigned iterations, uint64_t *token_count) {
+  uint64_t start = bench_now_ns();
+  for (unsigned i = 0; i < iterations; i++) {
+    walk(lex, lexer, state, token_count);
+  }
+  return (double)(bench_now_ns() - start) / iterations;
+}
+
+int main(int argc, char **argv) {
+  unsigned iterations = 20;
+  size_t length = 0;
+  char *input = NULL;
+  const char *label = "generated template";
+
+  if (argc > 1) {
+    label = argv[1];
+    input = bench_read_file(argv[1], &length);
+    if (!input) {
+      fprintf(stderr, "could not read %s\n", argv[1]);
+      return 1;
+    }
+  } else {
+    input = build_template(256 * 1024, &length);
+    if (!input) return 1;
+  }
+  if (argc > 2) {
+    iterations = (unsigned)strtoul(argv[2], NULL, 10);
+    if (iterations == 0) iterations = 1;
+  }
+
+  bool lex_states[LEX_TABLE_STATE_COUNT] = {false};
+  for (unsigned i = 0; i < STATE_COUNT; i++) {
+    if (ts_lex_modes[i].lex_state < LEX_TABLE_STATE_COUNT) {
+      lex_states[ts_lex_modes[i].lex_state] = true;
+    }
+  }
+
+  MockLexer lexer;
+  mock_lexer_init(&lexer, input, length);
+
+  printf("# %s: %zu bytes, %u iterations, %d states, %d byte classes\n",
+         label, length, iterations, LEX_TABLE_STATE_COUNT, LEX_TABLE_CLASS_COUNT);
+  printf("%-9s %10s %12s %12s %8s\n", "lex_state", "tokens", "goto_ns/B", "table_ns/B", "speedup");
+
+  double goto_total = 0, table_total = 0;
+  for (TSStateId state = 0; state < LEX_TABLE_STATE_COUNT; state++) {
+    if (!lex_states[state]) continue;
+    uint64_t goto_tokens = 0, table_tokens = 0;
+    double goto_ns = time_walk(ts_lex_goto, &lexer, state, iterations, &goto_tokens);
+    double table_ns = time_walk(ts_lex, &lexer, state, iterations, &table_tokens);
+    if (goto_tokens != table_tokens) {
+      fprintf(stderr, "lex state %u: %llu goto tokens but %llu table tokens\n", state,
+              (unsigned long long)goto_tokens, (unsigned long long)table_tokens);
+      free(input);
+      return 1;
+    }
+    goto_total += goto_ns;
+    table_total += table_ns;
+    printf("%-9u %10llu %12.3f %12.3f %7.2fx\n", state, (unsigned long long)goto_tokens,
+           goto_ns / length, table_ns / length, goto_ns / table_ns);
+  }
+  printf("%-9s %10s %12.3f %12.3f %7.2fx\n", "all", "", goto_total / length, table_total / length,
+         goto_total / table_total);
+
+  free(input);
+  return 0;
+}
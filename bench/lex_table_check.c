@@ -0,0 +1,131 @@
+// Checks that the table-driven lexer in src/parser_table_lexer.c produces the
+// same tokens as the generated `ts_lex` from every offset of every input, in
+// every lex state the parse table uses.
+
+#include <string.h>
+
+#include "../src/parser_table_lexer.c"
+#include "bench.h"
+#include "mock_lexer.h"
+
+#define MAX_CORPUS_CASES 256
+
+// Inputs that the corpus does not cover: every ASCII byte, odd nesting of
+// directive syntax, and non-ASCII text that forces the fallback path.
+static const char *const EXTRA_INPUTS[] = {
+  "<div v-on:click.stop.prevent=\"go\" :[key]=\"v\" @submit #default v-slot:item=\"{ a }\"></div>",
+  "<p a=b c='d' e=\"f\" g = 'h' v- v-: v-. :[]= [x] .m=\"\"/>",
+  "{{ a }}{{b}}}}{{ {{ }} <!-- c --> </ p > < / >",
+  "<span title='\xe4\xbd\xa0\xe5\xa5\xbd' v-\xc3\xa9t\xc3\xa9=\"\xf0\x9f\x98\x80\">\xe2\x82\xac</span>",
+  "\t\r\n \x01\x7f<\x0b\x0c>",
+};
+
+static const size_t EXTRA_INPUT_COUNT = sizeof(EXTRA_INPUTS) / sizeof(EXTRA_INPUTS[0]);
+
+static unsigned long long checked_count = 0;
+static unsigned long long mismatch_count = 0;
+
+static bool lex_states[LEX_TABLE_STATE_COUNT];
+
+static void collect_lex_states(void) {
+  for (unsigned i = 0; i < STATE_COUNT; i++) {
+    TSStateId lex_state = ts_lex_modes[i].lex_state;
+    if (lex_state < LEX_TABLE_STATE_COUNT) {
+      lex_states[lex_state] = true;
+    }
+  }
+}
+
+static void check_input(const char *label, const char *input, size_t length) {
+  MockLexer expected, actual;
+  mock_lexer_init(&expected, input, length);
+  mock_lexer_init(&actual, input, length);
+
+  for (size_t offset = 0; offset <= length; offset++) {
+    if (offset < length && ((uint8_t)input[offset] & 0xC0) == 0x80) continue;
+
+    for (TSStateId state = 0; state < LEX_TABLE_STATE_COUNT; state++) {
+      if (!lex_states[state]) continue;
+
+      mock_lexer_reset(&expected, offset);
+      mock_lexer_reset(&actual, offset);
+      bool expected_result = ts_lex_goto(&expected.lexer, state);
+      bool actual_result = ts_lex(&actual.lexer, state);
+      checked_count++;
+
+      if (
+        expected_result != actual_result ||
+        (expected_result && expected.lexer.result_symbol != actual.lexer.result_symbol) ||
+        expected.token_start != actual.token_start ||
+        expected.token_end != actual.token_end ||
+        expected.position != actual.position
+      ) {
+        mismatch_count++;
+        if (mismatch_count <= 20) {
+          fprintf(
+            stderr,
+            "%s: offset %zu, lex state %u: goto (%d, %s, %zu..%zu, at %zu) != table (%d, %s, %zu..%zu, at %zu)\n",
+            label, offset, state,
+            expected_result, ts_symbol_names[expected.lexer.result_symbol],
+            expected.token_start, expected.token_end, expected.position,
+            actual_result, ts_symbol_names[actual.lexer.result_symbol],
+            actual.token_start, actual.token_end, actual.position
+          );
+        }
+      }
+    }
+  }
+}
+
+static bool check_file(const char *path) {
+  size_t length = 0;
+  char *data = bench_read_file(path, &length);
+  if (!data) {
+    fprintf(stderr, "could not read %s\n", path);
+    return false;
+  }
+
+  size_t path_length = strlen(path);
+  if (path_length > 4 && strcmp(&path[path_length - 4], ".txt") == 0) {
+    BenchCorpusCase cases[MAX_CORPUS_CASES];
+    size_t count = bench_corpus_cases(data, length, cases, MAX_CORPUS_CASES);
+    if (count > MAX_CORPUS_CASES) count = MAX_CORPUS_CASES;
+    for (size_t i = 0; i < count; i++) {
+      check_input(path, cases[i].input, cases[i].input_length);
+    }
+    printf("%s: %zu cases\n", path, count);
+  } else {
+    check_input(path, data, length);
+    printf("%s: %zu bytes\n", path, length);
+  }
+
+  free(data);
+  return true;
+}
+
+int main(int argc, char **argv) {
+  collect_lex_states();
+
+  bool ok = true;
+  if (argc > 1) {
+    for (int i = 1; i < argc; i++) {
+      ok = check_file(argv[i]) && ok;
+    }
+  } else {
+    ok = check_file("../corpus/main.txt") && ok;
+    ok = check_file(BENCH_DEFAULT_INPUT) && ok;
+  }
+
+  for (size_t i = 0; i < EXTRA_INPUT_COUNT; i++) {
+    check_input("extra", EXTRA_INPUTS[i], strlen(EXTRA_INPUTS[i]));
+  }
+
+  char all_ascii[128];
+  for (int c = 0; c < 128; c++) {
+    all_ascii[c] = (char)c;
+  }
+  check_input("ascii", all_ascii, sizeof(all_ascii));
+
+  printf("%llu lexer runs compared, %llu mismatches\n", checked_count, mismatch_count);
+  return ok && mismatch_count == 0 ? 0 : 1;
+}
@@ -0,0 +1,259 @@
+// Memory footprint of each parse. libtree-sitter allocates through a counting
+// ts_set_allocator, so every input gets its peak heap use while parsing (a
+// fresh parser included) and the bytes its tree retains after the parser is
+// gone. Node counts by type come from walking the tree. The external scanner
+// uses plain malloc, so its TagStack capacity and serialized state sizes are
+// read from the scanner itself. Everything is also normalized per input KB.
+// Results go to stdout as a table and to memory_output.txt as one JSON object
+// per line.
+//
+//   memory [-o output] [-r copies] [-g name=value,...] [file.vue ...]
+//
+// With no inputs, test/app.vue, test/app.vue repeated -r times (default 100)
+// and generated components of depth 3 to 6 are measured.
+//
+// This file includes src/scanner.c and is linked without scanner.o, so that it
+// can look inside the Scanner the parser creates.
+
+#include <string.h>
+#include <tree_sitter/api.h>
+
+#include "../src/scanner.c"
+#include "bench.h"
+#include "counting_allocator.h"
+#include "sfc_gen.h"
+
+#define DEFAULT_OUTPUT "../memory_output.txt"
+#define DEFAULT_COPIES 100
+
+static const char *const DEFAULT_GENERATED[] = {"depth=3", "depth=4", "depth=5", "depth=6"};
+
+// The language with its scanner callbacks wrapped, so that the benchmark can
+// find the parser's Scanner and see every serialized state.
+static TSLanguage language;
+static Scanner *live_scanner;
+static uint64_t serialize_calls;
+static uint64_t serialized_bytes;
+static unsigned max_serialized_bytes;
+
+static void *memory_scanner_create(void) {
+  live_scanner = (Scanner *)tree_sitter_vue3_external_scanner_create();
+  return live_scanner;
+}
+
+static void memory_scanner_destroy(void *payload) {
+  if (payload == live_scanner) live_scanner = NULL;
+  tree_sitter_vue3_external_scanner_destroy(payload);
+}
+
+static unsigned memory_scanner_serialize(void *payload, char *buffer) {
+  unsigned length = tree_sitter_vue3_external_scanner_serialize(payload, buffer);
+  serialize_calls++;
+  serialized_bytes += length;
+  if (length > max_serialized_bytes) max_serialized_bytes = length;
+  return length;
+}
+
+typedef struct {
+  const char *name;
+  size_t bytes;
+  size_t peak_bytes;
+  size_t tree_bytes;
+  uint64_t allocations;
+  size_t leaked_bytes;
+  size_t tag_stack_capacity;
+  size_t tag_stack_bytes;
+  uint64_t serialize_calls;
+  uint64_t serialized_bytes;
+  unsigned max_serialized_bytes;
+  uint64_t nodes;
+  uint64_t *node_types;
+  bool has_error;
+} MemoryResult;
+
+static void count_node_types(const TSTree *tree, uint64_t *node_types, uint64_t *node_count) {
+  TSTreeCursor cursor = ts_tree_cursor_new(ts_tree_root_node(tree));
+  for (;;) {
+    node_types[ts_node_symbol(ts_tree_cursor_current_node(&cursor))]++;
+    (*node_count)++;
+    if (ts_tree_cursor_goto_first_child(&cursor)) continue;
+    while (!ts_tree_cursor_goto_next_sibling(&cursor)) {
+      if (!ts_tree_cursor_goto_parent(&cursor)) {
+        ts_tree_cursor_delete(&cursor);
+        return;
+      }
+    }
+  }
+}
+
+static bool measure(const char *name, const char *source, size_t length, MemoryResult *result) {
+  uint32_t symbol_count = ts_language_symbol_count(&language);
+  memset(result, 0, sizeof(*result));
+  result->name = name;
+  result->bytes = length;
+  result->node_types = (uint64_t *)calloc(symbol_count, sizeof(uint64_t));
+  if (!result->node_types) return false;
+
+  serialize_calls = 0;
+  serialized_bytes = 0;
+  max_serialized_bytes = 0;
+  size_t baseline = counters.current;
+  uint64_t allocations = counters.allocations;
+  counting_allocator_reset_peak();
+
+  TSParser *parser = ts_parser_new();
+  ts_parser_set_language(parser, &language);
+  TSTree *tree = ts_parser_parse_string(parser, NULL, source, (uint32_t)length);
+  result->peak_bytes = counters.peak - baseline;
+  result->allocations = counters.allocations - allocations;
+  if (live_scanner) {
+    result->tag_stack_capacity = live_scanner->tags.capacity;
+    result->tag_stack_bytes = sizeof(Scanner) + live_scanner->tags.capacity * sizeof(Tag);
+  }
+  result->serialize_calls = serialize_calls;
+  result->serialized_bytes = serialized_bytes;
+  result->max_serialized_bytes = max_serialized_bytes;
+  ts_parser_delete(parser);
+
+  result->tree_bytes = counters.current - baseline;
+  count_node_types(tree, result->node_types, &result->nodes);
+  result->has_error = ts_node_has_error(ts_tree_root_node(tree));
+  ts_tree_delete(tree);
+  result->leaked_bytes = counters.current - baseline;
+  return true;
+}
+
+static double per_kb(double value, size_t bytes) {
+  return bytes ? value * 1024.0 / (double)bytes : 0.0;
+}
+
+static void print_result(const MemoryResult *result) {
+  printf("%-24s %9zu %8llu %10zu %10zu %8zu %6u %9.0f %9.0f %8.1f%s\n", result->name, result->bytes,
+         (unsigned long long)result->nodes, result->peak_bytes, result->tree_bytes, result->tag_stack_bytes,
+         result->max_serialized_bytes, per_kb((double)result->peak_bytes, result->bytes),
+         per_kb((double)result->tree_bytes, result->bytes), per_kb((double)result->nodes, result->bytes),
+         result->has_error ? "  (has errors)" : "");
+  if (result->leaked_bytes) {
+    fprintf(stderr, "%s: %zu bytes still allocated after deleting the tree\n", result->name, result->leaked_bytes);
+  }
+}
+
+static void write_result(FILE *output, const MemoryResult *result) {
+  fputs("{\"input\":", output);
+  bench_json_string(output, result->name);
+  fprintf(output,
+          ",\"bytes\":%zu,\"nodes\":%llu,\"has_error\":%s,\"allocations\":%llu"
+          ",\"peak_bytes\":%zu,\"tree_bytes\":%zu,\"leaked_bytes\":%zu"
+          ",\"tag_stack_capacity\":%zu,\"scanner_bytes\":%zu"
+          ",\"serialize_calls\":%llu,\"serialized_bytes\":%llu,\"max_serialized_bytes\":%u"
+          ",\"per_kb\":{\"peak_bytes\":%.1f,\"tree_bytes\":%.1f,\"nodes\":%.2f,\"serialized_bytes\":%.1f}"
+          ",\"node_types\":{",
+          result->bytes, (unsigned long long)result->nodes, result->has_error ? "true" : "false",
+          (unsigned long long)result->allocations, result->peak_bytes, result->tree_bytes, result->leaked_bytes,
+          result->tag_stack_capacity, result->tag_stack_bytes, (unsigned long long)result->serialize_calls,
+          (unsigned long long)result->serialized_bytes, result->max_serialized_bytes,
+          per_kb((double)result->peak_bytes, result->bytes), per_kb((double)result->tree_bytes, result->bytes),
+          per_kb((double)result->nodes, result->bytes), per_kb((double)result->serialized_bytes, result->bytes));
+
+  bool first = true;
+  uint32_t symbol_count = ts_language_symbol_count(&language);
+  for (TSSymbol symbol = 0; symbol < symbol_count; symbol++) {
+    if (!result->node_types[symbol]) continue;
+    if (!first) fputc(',', output);
+    bench_json_string(output, ts_language_symbol_name(&language, symbol));
+    fprintf(output, ":%llu", (unsigned long long)result->node_types[symbol]);
+    first = false;
+  }
+  fputs("}}\n", output);
+}
+
+static bool run(FILE *output, const char *name, char *source, size_t length) {
+  if (!source) {
+    fprintf(stderr, "could not read %s\n", name);
+    return false;
+  }
+  MemoryResult result;
+  bool ok = measure(name, source, length, &result);
+  if (ok) {
+    print_result(&result);
+    write_result(output, &result);
+  }
+  free(result.node_types);
+  free(source);
+  return ok;
+}
+
+static char *generate(const char *spec, size_t *length) {
+  SfcOptions options = SFC_DEFAULT_OPTIONS;
+  if (!sfc_parse_options(&options, spec)) {
+    fprintf(stderr, "unknown generator option in %s\n", spec);
+  }
+  return sfc_generate(&options, length);
+}
+
+int main(int argc, char **argv) {
+  counting_allocator_install();
+
+  language = *tree_sitter_vue3();
+  language.external_scanner.create = memory_scanner_create;
+  language.external_scanner.destroy = memory_scanner_destroy;
+  language.external_scanner.serialize = memory_scanner_serialize;
+
+  const char *output_path = DEFAULT_OUTPUT;
+  size_t copies = DEFAULT_COPIES;
+  int first_input = argc;
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "-o") == 0 && i + 1 < argc) {
+      output_path = argv[++i];
+    } else if (strcmp(argv[i], "-r") == 0 && i + 1 < argc) {
+      copies = (size_t)strtoull(argv[++i], NULL, 10);
+    } else {
+      first_input = i;
+      break;
+    }
+  }
+
+  FILE *output = fopen(output_path, "w");
+  if (!output) {
+    fprintf(stderr, "could not open %s\n", output_path);
+    return 1;
+  }
+
+  printf("%-24s %9s %8s %10s %10s %8s %6s %9s %9s %8s\n", "input", "bytes", "nodes", "peak", "tree",
+         "scanner", "state", "peak/KB", "tree/KB", "nodes/KB");
+
+  int status = 0;
+  size_t length = 0;
+  if (first_input == argc) {
+    char *source = bench_read_file(BENCH_DEFAULT_INPUT, &length);
+    if (source) {
+      size_t repeated_length = 0;
+      char *repeated = bench_repeat(source, length, copies, &repeated_length);
+      char name[64];
+      snprintf(name, sizeof(name), "app.vue x%zu", copies);
+      if (!run(output, BENCH_DEFAULT_INPUT, source, length)) status = 1;
+      if (!run(output, name, repeated, repeated_length)) status = 1;
+    } else {
+      fprintf(stderr, "could not read %s\n", BENCH_DEFAULT_INPUT);
+      status = 1;
+    }
+    for (size_t i = 0; i < sizeof(DEFAULT_GENERATED) / sizeof(DEFAULT_GENERATED[0]); i++) {
+      char *source = generate(DEFAULT_GENERATED[i], &length);
+      if (!run(output, DEFAULT_GENERATED[i], source, length)) status = 1;
+    }
+  }
+
+  for (int i = first_input; i < argc; i++) {
+    if (strcmp(argv[i], "-g") == 0 && i + 1 < argc) {
+      i++;
+      char *source = generate(argv[i], &length);
+      if (!run(output, argv[i], source, length)) status = 1;
+    } else {
+      char *source = bench_read_file(argv[i], &length);
+      if (!run(output, argv[i], source, length)) status = 1;
+    }
+  }
+
+  fclose(output);
+  return status;
+}
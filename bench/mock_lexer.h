@@ -0,0 +1,139 @@
+#ifndef TREE_SITTER_VUE3_MOCK_LEXER_H_
+#define TREE_SITTER_VUE3_MOCK_LEXER_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <tree_sitter/parser.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// A buffer-backed TSLexer for driving `ts_lex` and the external scanner
+// without libtree-sitter. It decodes UTF-8 like the real lexer, reports 0 at
+// EOF and tracks where the current token starts and where mark_end left it.
+typedef struct {
+  TSLexer lexer;
+  const char *input;
+  size_t length;
+  size_t position;
+  size_t lookahead_size;
+  size_t token_start;
+  size_t token_end;
+  bool marked_end;
+  uint64_t advance_count;
+  uint64_t skip_count;
+} MockLexer;
+
+static inline void mock_lexer_decode(MockLexer *self) {
+  if (self->position >= self->length) {
+    self->lexer.lookahead = 0;
+    self->lookahead_size = 0;
+    return;
+  }
+
+  const uint8_t *bytes = (const uint8_t *)&self->input[self->position];
+  size_t available = self->length - self->position;
+  uint8_t first = bytes[0];
+  size_t size = 1;
+  int32_t code_point = first;
+  if (first >= 0xF0 && available >= 4) {
+    size = 4;
+    code_point = first & 0x07;
+  } else if (first >= 0xE0 && available >= 3) {
+    size = 3;
+    code_point = first & 0x0F;
+  } else if (first >= 0xC0 && available >= 2) {
+    size = 2;
+    code_point = first & 0x1F;
+  } else if (first >= 0x80) {
+    code_point = -1;
+  }
+  for (size_t i = 1; i < size; i++) {
+    if ((bytes[i] & 0xC0) != 0x80) {
+      size = 1;
+      code_point = -1;
+      break;
+    }
+    code_point = (code_point << 6) | (bytes[i] & 0x3F);
+  }
+
+  self->lexer.lookahead = code_point;
+  self->lookahead_size = size;
+}
+
+static inline void mock_lexer_advance(TSLexer *lexer, bool skip) {
+  MockLexer *self = (MockLexer *)lexer;
+  if (self->position >= self->length) return;
+  self->position += self->lookahead_size;
+  if (skip) {
+    self->token_start = self->position;
+    self->skip_count++;
+  } else {
+    self->advance_count++;
+  }
+  mock_lexer_decode(self);
+}
+
+static inline void mock_lexer_mark_end(TSLexer *lexer) {
+  MockLexer *self = (MockLexer *)lexer;
+  self->token_end = self->position;
+  self->marked_end = true;
+}
+
+static inline uint32_t mock_lexer_get_column(TSLexer *lexer) {
+  MockLexer *self = (MockLexer *)lexer;
+  uint32_t column = 0;
+  for (size_t i = self->position; i > 0 && self->input[i - 1] != '\n'; i--) {
+    column++;
+  }
+  return column;
+}
+
+static inline bool mock_lexer_is_at_included_range_start(const TSLexer *lexer) {
+  (void)lexer;
+  return false;
+}
+
+static inline bool mock_lexer_eof(const TSLexer *lexer) {
+  const MockLexer *self = (const MockLexer *)lexer;
+  return self->position >= self->length;
+}
+
+// Positions the lexer at `position`, as the parser does before each token.
+static inline void mock_lexer_reset(MockLexer *self, size_t position) {
+  self->position = position < self->length ? position : self->length;
+  self->token_start = self->position;
+  self->token_end = self->position;
+  self->marked_end = false;
+  self->lexer.result_symbol = 0;
+  mock_lexer_decode(self);
+}
+
+// Where the last token ended. Like the real lexer, a token whose scanner never
+// called mark_end ends at the current position.
+static inline size_t mock_lexer_token_end(const MockLexer *self) {
+  return self->marked_end ? self->token_end : self->position;
+}
+
+static inline void mock_lexer_init(MockLexer *self, const char *input, size_t length) {
+  self->lexer.lookahead = 0;
+  self->lexer.result_symbol = 0;
+  self->lexer.advance = mock_lexer_advance;
+  self->lexer.mark_end = mock_lexer_mark_end;
+  self->lexer.get_column = mock_lexer_get_column;
+  self->lexer.is_at_included_range_start = mock_lexer_is_at_included_range_start;
+  self->lexer.eof = mock_lexer_eof;
+  self->input = input;
+  self->length = length;
+  self->advance_count = 0;
+  self->skip_count = 0;
+  mock_lexer_reset(self, 0);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
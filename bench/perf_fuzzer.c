@@ -0,0 +1,125 @@
+// libFuzzer harness that hunts for inputs which are slow to parse rather than
+// inputs which crash. The cost of a parse is the number of characters the
+// internal lexer and the external scanner advance over, plus the tag stack
+// entries the scanner compares (work_counter.h). Unlike wall time the cost is
+// deterministic. The cost per input byte is reported to libFuzzer as extra
+// coverage counters on a log scale, so an input that reaches a new cost level
+// counts as new coverage and is kept in the corpus.
+//
+// With PERF_FUZZER_MAX_WORK_PER_BYTE set, any input of at least
+// PERF_FUZZER_MIN_LENGTH bytes (default 64) that costs more than that per
+// byte traps. libFuzzer then saves it as a crash, and -minimize_crash=1
+// shrinks it while keeping it over the limit. `make fuzz-minimize` does this
+// and stores the result in perf_fixtures/.
+//
+// Built with -DPERF_FUZZER_STANDALONE, it is a plain program instead: it
+// parses each file given on the command line, prints its cost, and exits
+// non-zero if any file is over the limit (default 8 per byte, see PERF_LIMIT
+// in the Makefile). `make fuzz-check` runs it over perf_seeds/ and
+// perf_fixtures/ so that slow inputs found earlier stay fixed.
+//
+// Both builds need the scanner compiled with TREE_SITTER_VUE3_SCANNER_WORK.
+
+#include <math.h>
+#include <string.h>
+#include <tree_sitter/api.h>
+
+#include "bench.h"
+#include "work_counter.h"
+
+#define DEFAULT_MAX_WORK_PER_BYTE 8.0
+#define DEFAULT_MIN_LENGTH 64
+#define COST_LEVELS 64
+
+#if defined(__linux__) && !defined(PERF_FUZZER_STANDALONE)
+__attribute__((used, section("__libfuzzer_extra_counters")))
+#endif
+static uint8_t cost_levels[COST_LEVELS];
+
+static TSParser *parser;
+
+static void perf_fuzzer_init(void) {
+  if (parser) return;
+  parser = ts_parser_new();
+  ts_parser_set_language(parser, work_counter_language());
+}
+
+static double env_double(const char *name, double fallback) {
+  const char *value = getenv(name);
+  return value && *value ? strtod(value, NULL) : fallback;
+}
+
+// Parses `data` and returns its cost per input byte.
+static double measure(const uint8_t *data, size_t size, uint64_t *elapsed_ns) {
+  perf_fuzzer_init();
+  work_counter_reset();
+  uint64_t start = bench_now_ns();
+  TSTree *tree = ts_parser_parse_string(parser, NULL, (const char *)data, (uint32_t)size);
+  *elapsed_ns = bench_now_ns() - start;
+  ts_tree_delete(tree);
+  return (double)work_counter_total() / (double)(size ? size : 1);
+}
+
+#ifndef PERF_FUZZER_STANDALONE
+
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size) {
+  static double max_work_per_byte;
+  static double limit = -1;
+  static size_t min_length;
+  if (limit < 0) {
+    limit = env_double("PERF_FUZZER_MAX_WORK_PER_BYTE", 0);
+    min_length = (size_t)env_double("PERF_FUZZER_MIN_LENGTH", DEFAULT_MIN_LENGTH);
+  }
+  if (size > UINT32_MAX) return 0;
+
+  uint64_t elapsed_ns = 0;
+  double work_per_byte = measure(data, size, &elapsed_ns);
+
+  // Quarter steps of log2, so cost levels 1, 1.19, 1.41, 1.68, 2, ... are
+  // each a new feature.
+  int level = work_per_byte > 1 ? (int)(4 * log2(work_per_byte)) : 0;
+  if (level >= COST_LEVELS) level = COST_LEVELS - 1;
+  cost_levels[level] = 1;
+
+  if (work_per_byte > max_work_per_byte && size >= min_length) {
+    max_work_per_byte = work_per_byte;
+    fprintf(stderr, "#perf new max: %.2f work/byte, %.1f ns/byte, %zu bytes\n", work_per_byte,
+            (double)elapsed_ns / (double)size, size);
+  }
+  if (limit > 0 && work_per_byte > limit && size >= min_length) {
+    fprintf(stderr, "#perf over the limit: %.2f > %.2f work/byte\n", work_per_byte, limit);
+    __builtin_trap();
+  }
+  return 0;
+}
+
+#else
+
+int main(int argc, char **argv) {
+  double limit = env_double("PERF_FUZZER_MAX_WORK_PER_BYTE", DEFAULT_MAX_WORK_PER_BYTE);
+  int status = 0;
+
+  printf("%-48s %9s %12s %10s\n", "input", "bytes", "work/B", "ns/B");
+  for (int i = 1; i < argc; i++) {
+    size_t length = 0;
+    char *source = bench_read_file(argv[i], &length);
+    if (!source) {
+      fprintf(stderr, "could not read %s\n", argv[i]);
+      status = 1;
+      continue;
+    }
+
+    uint64_t elapsed_ns = 0;
+    double work_per_byte = measure((const uint8_t *)source, length, &elapsed_ns);
+    bool over = work_per_byte > limit;
+    printf("%-48s %9zu %12.2f %10.1f%s\n", argv[i], length, work_per_byte,
+           (double)elapsed_ns / (double)(length ? length : 1), over ? "  OVER LIMIT" : "");
+    if (over) status = 1;
+    free(source);
+  }
+
+  if (parser) ts_parser_delete(parser);
+  return status;
+}
+
+#endif
@@ -0,0 +1,343 @@
+// Query benchmark for queries/highlights.scm and queries/injections.scm. Each
+// query file is compiled once, and its compile time is reported. A
+// TSQueryCursor then walks the captures of every input the way a highlighter
+// does (ts_query_cursor_next_capture), -n times. Matches and captures come
+// from one more untimed pass over the matches. Per input, the time per run,
+// time per KB and matches per second are reported. To find the expensive
+// patterns, every pattern is also compiled as a query of its own and timed
+// over all inputs; its share is its time over the summed time of all patterns.
+// Predicates such as #match? are left to the caller by tree-sitter, so they
+// are not evaluated here either. Results go to stdout as tables and to
+// query_output.txt as one JSON object per line.
+//
+//   query_bench [-n iterations] [-o output] [-q query.scm ...] [-g name=value,...] [file.vue ...]
+//
+// -q may be repeated and replaces the default queries. Without inputs,
+// test/app.vue, every corpus/main.txt case and generated components of depth
+// 3 to 6 are used.
+
+#include <ctype.h>
+#include <string.h>
+#include <tree_sitter/api.h>
+
+#include "bench.h"
+#include "sfc_gen.h"
+
+#define DEFAULT_OUTPUT "../query_output.txt"
+#define DEFAULT_ITERATIONS 20
+#define CORPUS_PATH "../corpus/main.txt"
+#define MAX_CORPUS_CASES 256
+#define MAX_NAME 128
+#define MAX_LABEL 48
+
+static const char *const DEFAULT_QUERIES[] = {"../queries/highlights.scm", "../queries/injections.scm"};
+static const char *const DEFAULT_GENERATED[] = {"depth=3", "depth=4", "depth=5", "depth=6"};
+
+typedef struct {
+  char name[MAX_NAME];
+  char *source;
+  size_t length;
+  TSTree *tree;
+} Input;
+
+typedef struct {
+  uint64_t matches;
+  uint64_t captures;
+  uint64_t elapsed_ns;
+} QueryRun;
+
+static TSQuery *compile(const char *name, const char *source, size_t length, uint64_t *elapsed_ns) {
+  uint32_t error_offset = 0;
+  TSQueryError error_type = TSQueryErrorNone;
+  uint64_t start = bench_now_ns();
+  TSQuery *query = ts_query_new(tree_sitter_vue3(), source, (uint32_t)length, &error_offset, &error_type);
+  *elapsed_ns = bench_now_ns() - start;
+  if (!query) fprintf(stderr, "%s: query error %d at offset %u\n", name, (int)error_type, error_offset);
+  return query;
+}
+
+// Times `iterations` capture walks of `query` over `input`. Matches and
+// captures per pattern are added to `pattern_matches` and `pattern_captures`
+// when they are given.
+static void run(TSQueryCursor *cursor, const TSQuery *query, const Input *input, unsigned iterations,
+                QueryRun *result, uint64_t *pattern_matches, uint64_t *pattern_captures) {
+  TSNode root = ts_tree_root_node(input->tree);
+  TSQueryMatch match;
+  uint32_t capture_index = 0;
+  uint64_t sink = 0;
+
+  uint64_t start = bench_now_ns();
+  for (unsigned i = 0; i < iterations; i++) {
+    ts_query_cursor_exec(cursor, query, root);
+    while (ts_query_cursor_next_capture(cursor, &match, &capture_index)) {
+      sink += ts_node_start_byte(match.captures[capture_index].node);
+    }
+  }
+  result->elapsed_ns = bench_now_ns() - start;
+  (void)sink;
+
+  result->matches = 0;
+  result->captures = 0;
+  ts_query_cursor_exec(cursor, query, root);
+  while (ts_query_cursor_next_match(cursor, &match)) {
+    result->matches++;
+    result->captures += match.capture_count;
+    if (pattern_matches) pattern_matches[match.pattern_index]++;
+    if (pattern_captures) pattern_captures[match.pattern_index] += match.capture_count;
+  }
+}
+
+// The start of a pattern with its comments dropped and its whitespace
+// collapsed, to name the pattern in the report.
+static void pattern_label(const char *source, size_t length, char *label) {
+  const char *end = source + length;
+  size_t size = 0;
+  bool space = false;
+  for (; source < end && size + 1 < MAX_LABEL; source++) {
+    if (*source == ';') {
+      while (source + 1 < end && source[1] != '\n') source++;
+      continue;
+    }
+    if (isspace((unsigned char)*source)) {
+      space = size > 0;
+      continue;
+    }
+    if (space && size + 2 < MAX_LABEL && label[size - 1] != '[' && label[size - 1] != '(' && *source != ']' &&
+        *source != ')') {
+      label[size++] = ' ';
+    }
+    space = false;
+    label[size++] = *source;
+  }
+  label[size] = '\0';
+}
+
+static double per_kb(double value, size_t bytes) {
+  return bytes ? value * 1024.0 / (double)bytes : 0.0;
+}
+
+static bool add_input(Input *inputs, size_t *count, TSParser *parser, const char *name, char *source, size_t length) {
+  if (!source) {
+    fprintf(stderr, "could not read %s\n", name);
+    return false;
+  }
+  Input *input = &inputs[*count];
+  snprintf(input->name, MAX_NAME, "%s", name);
+  input->source = source;
+  input->length = length;
+  input->tree = ts_parser_parse_string(parser, NULL, source, (uint32_t)length);
+  if (!input->tree) {
+    fprintf(stderr, "could not parse %s\n", name);
+    free(source);
+    return false;
+  }
+  (*count)++;
+  return true;
+}
+
+static char *generate(const char *spec, size_t *length) {
+  SfcOptions options = SFC_DEFAULT_OPTIONS;
+  if (!sfc_parse_options(&options, spec)) {
+    fprintf(stderr, "unknown generator option in %s\n", spec);
+  }
+  return sfc_generate(&options, length);
+}
+
+static void add_default_inputs(Input *inputs, size_t *count, TSParser *parser) {
+  size_t length = 0;
+  char *app = bench_read_file(BENCH_DEFAULT_INPUT, &length);
+  add_input(inputs, count, parser, "app.vue", app, length);
+
+  char *corpus = bench_read_file(CORPUS_PATH, &length);
+  if (corpus) {
+    BenchCorpusCase cases[MAX_CORPUS_CASES];
+    size_t case_count = bench_corpus_cases(corpus, length, cases, MAX_CORPUS_CASES);
+    if (case_count > MAX_CORPUS_CASES) case_count = MAX_CORPUS_CASES;
+    for (size_t i = 0; i < case_count; i++) {
+      if (cases[i].input_length == 0) continue;
+      char name[MAX_NAME];
+      char *source = (char *)malloc(cases[i].input_length + 1);
+      if (!source) continue;
+      memcpy(source, cases[i].input, cases[i].input_length);
+      source[cases[i].input_length] = '\0';
+      snprintf(name, sizeof(name), "corpus %zu: %.*s", i + 1, (int)cases[i].name_length, cases[i].name);
+      add_input(inputs, count, parser, name, source, cases[i].input_length);
+    }
+    free(corpus);
+  } else {
+    fprintf(stderr, "could not read %s\n", CORPUS_PATH);
+  }
+
+  for (size_t i = 0; i < sizeof(DEFAULT_GENERATED) / sizeof(DEFAULT_GENERATED[0]); i++) {
+    char *source = generate(DEFAULT_GENERATED[i], &length);
+    add_input(inputs, count, parser, DEFAULT_GENERATED[i], source, length);
+  }
+}
+
+static bool bench_query(FILE *output, const char *path, const Input *inputs, size_t input_count,
+                        unsigned iterations) {
+  size_t length = 0;
+  char *source = bench_read_file(path, &length);
+  if (!source) {
+    fprintf(stderr, "could not read %s\n", path);
+    return false;
+  }
+
+  uint64_t compile_ns = 0;
+  TSQuery *query = compile(path, source, length, &compile_ns);
+  if (!query) {
+    free(source);
+    return false;
+  }
+  uint32_t pattern_count = ts_query_pattern_count(query);
+  uint64_t *pattern_matches = (uint64_t *)calloc(pattern_count, sizeof(uint64_t));
+  uint64_t *pattern_captures = (uint64_t *)calloc(pattern_count, sizeof(uint64_t));
+  uint64_t *pattern_ns = (uint64_t *)calloc(pattern_count, sizeof(uint64_t));
+  TSQueryCursor *cursor = ts_query_cursor_new();
+  bool ok = pattern_matches && pattern_captures && pattern_ns;
+
+  printf("\n# %s: %u patterns, compiled in %.1f us\n", path, pattern_count, compile_ns / 1e3);
+  fputs("{\"query\":", output);
+  bench_json_string(output, path);
+  fprintf(output, ",\"patterns\":%u,\"compile_us\":%.2f}\n", pattern_count, compile_ns / 1e3);
+
+  printf("%-40s %9s %8s %9s %10s %9s %12s\n", "input", "bytes", "matches", "captures", "us/run", "us/KB",
+         "matches/s");
+  size_t total_bytes = 0;
+  uint64_t total_ns = 0;
+  uint64_t total_matches = 0;
+  uint64_t total_captures = 0;
+  for (size_t i = 0; ok && i < input_count; i++) {
+    QueryRun result;
+    run(cursor, query, &inputs[i], iterations, &result, pattern_matches, pattern_captures);
+    double us = result.elapsed_ns / 1e3 / iterations;
+    double matches_per_s = result.elapsed_ns ? result.matches * iterations * 1e9 / (double)result.elapsed_ns : 0;
+    printf("%-40.40s %9zu %8llu %9llu %10.2f %9.2f %12.0f\n", inputs[i].name, inputs[i].length,
+           (unsigned long long)result.matches, (unsigned long long)result.captures, us,
+           per_kb(us, inputs[i].length), matches_per_s);
+
+    fputs("{\"query\":", output);
+    bench_json_string(output, path);
+    fputs(",\"input\":", output);
+    bench_json_string(output, inputs[i].name);
+    fprintf(output,
+            ",\"bytes\":%zu,\"matches\":%llu,\"captures\":%llu,\"us\":%.3f,\"us_per_kb\":%.3f"
+            ",\"matches_per_s\":%.0f}\n",
+            inputs[i].length, (unsigned long long)result.matches, (unsigned long long)result.captures, us,
+            per_kb(us, inputs[i].length), matches_per_s);
+
+    total_bytes += inputs[i].length;
+    total_ns += result.elapsed_ns / iterations;
+    total_matches += result.matches;
+    total_captures += result.captures;
+  }
+  if (ok) {
+    printf("%-40s %9zu %8llu %9llu %10.2f %9.2f %12.0f\n", "total", total_bytes, (unsigned long long)total_matches,
+           (unsigned long long)total_captures, total_ns / 1e3, per_kb(total_ns / 1e3, total_bytes),
+           total_ns ? total_matches * 1e9 / (double)total_ns : 0.0);
+  }
+
+  // Each pattern on its own, over every input.
+  uint64_t pattern_total_ns = 0;
+  for (uint32_t p = 0; ok && p < pattern_count; p++) {
+    uint32_t start = ts_query_start_byte_for_pattern(query, p);
+    uint32_t end = p + 1 < pattern_count ? ts_query_start_byte_for_pattern(query, p + 1) : (uint32_t)length;
+    uint64_t ignored = 0;
+    TSQuery *single = compile(path, source + start, end - start, &ignored);
+    if (!single) continue;
+    for (size_t i = 0; i < input_count; i++) {
+      QueryRun result;
+      run(cursor, single, &inputs[i], iterations, &result, NULL, NULL);
+      pattern_ns[p] += result.elapsed_ns / iterations;
+    }
+    pattern_total_ns += pattern_ns[p];
+    ts_query_delete(single);
+  }
+
+  printf("%-4s %-48s %8s %9s %10s %7s\n", "#", "pattern", "matches", "captures", "us", "share");
+  for (uint32_t p = 0; ok && p < pattern_count; p++) {
+    uint32_t start = ts_query_start_byte_for_pattern(query, p);
+    uint32_t end = p + 1 < pattern_count ? ts_query_start_byte_for_pattern(query, p + 1) : (uint32_t)length;
+    char label[MAX_LABEL];
+    pattern_label(source + start, end - start, label);
+    double share = pattern_total_ns ? 100.0 * (double)pattern_ns[p] / (double)pattern_total_ns : 0.0;
+    printf("%-4u %-48s %8llu %9llu %10.2f %6.1f%%\n", p, label, (unsigned long long)pattern_matches[p],
+           (unsigned long long)pattern_captures[p], pattern_ns[p] / 1e3, share);
+
+    fputs("{\"query\":", output);
+    bench_json_string(output, path);
+    fprintf(output, ",\"pattern\":%u,\"source\":", p);
+    bench_json_string(output, label);
+    fprintf(output, ",\"matches\":%llu,\"captures\":%llu,\"us\":%.3f,\"share\":%.2f}\n",
+            (unsigned long long)pattern_matches[p], (unsigned long long)pattern_captures[p], pattern_ns[p] / 1e3,
+            share);
+  }
+
+  ts_query_cursor_delete(cursor);
+  ts_query_delete(query);
+  free(pattern_matches);
+  free(pattern_captures);
+  free(pattern_ns);
+  free(source);
+  return ok;
+}
+
+int main(int argc, char **argv) {
+  unsigned iterations = DEFAULT_ITERATIONS;
+  const char *output_path = DEFAULT_OUTPUT;
+  const char **queries = (const char **)calloc((size_t)argc + 2, sizeof(char *));
+  size_t query_count = 0;
+  Input *inputs = (Input *)calloc((size_t)argc + MAX_CORPUS_CASES + 8, sizeof(Input));
+  size_t input_count = 0;
+  if (!queries || !inputs) return 1;
+
+  TSParser *parser = ts_parser_new();
+  ts_parser_set_language(parser, tree_sitter_vue3());
+
+  int status = 0;
+  size_t length = 0;
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "-n") == 0 && i + 1 < argc) {
+      iterations = (unsigned)strtoul(argv[++i], NULL, 10);
+    } else if (strcmp(argv[i], "-o") == 0 && i + 1 < argc) {
+      output_path = argv[++i];
+    } else if (strcmp(argv[i], "-q") == 0 && i + 1 < argc) {
+      queries[query_count++] = argv[++i];
+    } else if (strcmp(argv[i], "-g") == 0 && i + 1 < argc) {
+      i++;
+      char *source = generate(argv[i], &length);
+      if (!add_input(inputs, &input_count, parser, argv[i], source, length)) status = 1;
+    } else {
+      char *source = bench_read_file(argv[i], &length);
+      if (!add_input(inputs, &input_count, parser, argv[i], source, length)) status = 1;
+    }
+  }
+  if (iterations == 0) iterations = 1;
+  if (query_count == 0) {
+    for (size_t i = 0; i < sizeof(DEFAULT_QUERIES) / sizeof(DEFAULT_QUERIES[0]); i++) {
+      queries[query_count++] = DEFAULT_QUERIES[i];
+    }
+  }
+  if (input_count == 0) add_default_inputs(inputs, &input_count, parser);
+
+  FILE *output = fopen(output_path, "w");
+  if (!output) {
+    fprintf(stderr, "could not open %s\n", output_path);
+    return 1;
+  }
+
+  printf("# %zu inputs, %u iterations\n", input_count, iterations);
+  for (size_t i = 0; i < query_count; i++) {
+    if (!bench_query(output, queries[i], inputs, input_count, iterations)) status = 1;
+  }
+
+  fclose(output);
+  for (size_t i = 0; i < input_count; i++) {
+    ts_tree_delete(inputs[i].tree);
+    free(inputs[i].source);
+  }
+  ts_parser_delete(parser);
+  free(inputs);
+  free(queries);
+  return status;
+}
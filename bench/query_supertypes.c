@@ -0,0 +1,122 @@
+#include <string.h>
+#include <tree_sitter/api.h>
+
+#include "bench.h"
+
+typedef struct {
+  const char *name;
+  const char *enumerated;
+  const char *supertype;
+} PatternPair;
+
+// Each pair matches the same nodes, once by listing every alternative the way
+// queries/highlights.scm has to without supertypes, and once through
+// `_attribute` or `_node`.
+static const PatternPair PATTERN_PAIRS[] = {
+  {
+    "start_tag attributes",
+    "(start_tag [(attribute) (directive_attribute)] @attribute)",
+    "(start_tag (_attribute) @attribute)",
+  },
+  {
+    "element children",
+    "(element [(comment) (text) (interpolation) (element) (template_element)"
+    " (script_element) (style_element) (erroneous_end_tag)] @child)",
+    "(element (_node) @child)",
+  },
+  {
+    "template_element children",
+    "(template_element [(comment) (text) (interpolation) (element) (template_element)"
+    " (script_element) (style_element) (erroneous_end_tag)] @child)",
+    "(template_element (_node) @child)",
+  },
+};
+
+static const size_t PATTERN_PAIR_COUNT = sizeof(PATTERN_PAIRS) / sizeof(PATTERN_PAIRS[0]);
+
+static bool run_query(const char *source, TSNode root, unsigned iterations, uint64_t *elapsed_ns, uint64_t *match_count) {
+  uint32_t error_offset = 0;
+  TSQueryError error_type = TSQueryErrorNone;
+  TSQuery *query = ts_query_new(tree_sitter_vue3(), source, (uint32_t)strlen(source), &error_offset, &error_type);
+  if (!query) {
+    fprintf(stderr, "query error %d at offset %u: %s\n", (int)error_type, error_offset, source);
+    return false;
+  }
+
+  TSQueryCursor *cursor = ts_query_cursor_new();
+  uint64_t matches = 0;
+  uint64_t start = bench_now_ns();
+  for (unsigned i = 0; i < iterations; i++) {
+    ts_query_cursor_exec(cursor, query, root);
+    TSQueryMatch match;
+    while (ts_query_cursor_next_match(cursor, &match)) {
+      matches++;
+    }
+  }
+  *elapsed_ns = bench_now_ns() - start;
+  *match_count = matches / iterations;
+
+  ts_query_cursor_delete(cursor);
+  ts_query_delete(query);
+  return true;
+}
+
+int main(int argc, char **argv) {
+  const char *path = argc > 1 ? argv[1] : BENCH_DEFAULT_INPUT;
+  unsigned copies = argc > 2 ? (unsigned)strtoul(argv[2], NULL, 10) : 200;
+  unsigned iterations = argc > 3 ? (unsigned)strtoul(argv[3], NULL, 10) : 50;
+  if (iterations == 0) iterations = 1;
+
+  size_t file_length = 0;
+  char *file = bench_read_file(path, &file_length);
+  if (!file) {
+    fprintf(stderr, "could not read %s\n", path);
+    return 1;
+  }
+
+  size_t length = 0;
+  char *source = bench_repeat(file, file_length, copies, &length);
+  free(file);
+  if (!source) return 1;
+
+  TSParser *parser = ts_parser_new();
+  ts_parser_set_language(parser, tree_sitter_vue3());
+  TSTree *tree = ts_parser_parse_string(parser, NULL, source, (uint32_t)length);
+  if (!tree) {
+    fprintf(stderr, "could not parse %s\n", path);
+    ts_parser_delete(parser);
+    free(source);
+    return 1;
+  }
+  TSNode root = ts_tree_root_node(tree);
+
+  printf("# %s x%u (%zu bytes), %u iterations\n", path, copies, length, iterations);
+  printf("%-28s %10s %14s %14s %8s\n", "pattern", "matches", "enumerated_us", "supertype_us", "speedup");
+
+  int status = 0;
+  for (size_t i = 0; i < PATTERN_PAIR_COUNT; i++) {
+    const PatternPair *pair = &PATTERN_PAIRS[i];
+    uint64_t enumerated_ns = 0, supertype_ns = 0;
+    uint64_t enumerated_matches = 0, supertype_matches = 0;
+    if (
+      !run_query(pair->enumerated, root, iterations, &enumerated_ns, &enumerated_matches) ||
+      !run_query(pair->supertype, root, iterations, &supertype_ns, &supertype_matches)
+    ) {
+      status = 1;
+      continue;
+    }
+    if (enumerated_matches != supertype_matches) {
+      fprintf(stderr, "%s: %llu enumerated matches but %llu supertype matches\n", pair->name,
+              (unsigned long long)enumerated_matches, (unsigned long long)supertype_matches);
+      status = 1;
+    }
+    printf("%-28s %10llu %14.1f %14.1f %7.2fx\n", pair->name, (unsigned long long)supertype_matches,
+           enumerated_ns / 1e3 / iterations, supertype_ns / 1e3 / iterations,
+           supertype_ns ? (double)enumerated_ns / (double)supertype_ns : 0.0);
+  }
+
+  ts_tree_delete(tree);
+  ts_parser_delete(parser);
+  free(source);
+  return status;
+}
@@ -0,0 +1,457 @@
+// Parse benchmark with stored baselines. Measures four metrics per input: the
+// mean parse time and the throughput over several rounds, each with a 95%
+// confidence interval, the 99th percentile of the single parse times, and the
+// peak heap libtree-sitter uses while parsing. It can save the results tagged
+// with a git revision. Given a saved baseline, it reports the per-input delta
+// of each metric and exits non-zero if one of them regressed by more than that
+// metric's threshold. Mean time and throughput only count when the change is
+// also significant (Welch's t-test); p99 and memory have no interval and count
+// as they are.
+//
+//   regress [-k rounds] [-n parses_per_round] [-r revision] [-o save.jsonl]
+//           [-b baseline.jsonl] [-t mean_percent] [-x throughput_percent]
+//           [-p p99_percent] [-m memory_percent] [file.vue ...]
+//
+// Without files, test/app.vue, 64 copies of it, and every corpus/main.txt case
+// repeated to about 32 KB are measured.
+
+#include <math.h>
+#include <string.h>
+#include <time.h>
+#include <tree_sitter/api.h>
+
+#include "bench.h"
+#include "counting_allocator.h"
+
+#define DEFAULT_ROUNDS 15
+#define DEFAULT_PARSES 20
+#define DEFAULT_THRESHOLD 5.0
+#define DEFAULT_THROUGHPUT_THRESHOLD 5.0
+#define DEFAULT_P99_THRESHOLD 10.0
+#define DEFAULT_MEMORY_THRESHOLD 2.0
+#define CORPUS_PATH "../corpus/main.txt"
+#define CORPUS_TARGET_BYTES (32 * 1024)
+#define MAX_CORPUS_CASES 256
+#define MAX_NAME 128
+
+// Metrics missing from an older baseline are NAN.
+typedef struct {
+  char name[MAX_NAME];
+  size_t bytes;
+  unsigned rounds;
+  double mean_ns;
+  double stddev_ns;
+  double throughput_mbs;
+  double throughput_stddev_mbs;
+  double p99_ns;
+  double peak_bytes;
+} Measurement;
+
+typedef enum {
+  LOWER_IS_BETTER,
+  HIGHER_IS_BETTER,
+} Direction;
+
+typedef struct {
+  const char *label;
+  double scale;
+  Direction direction;
+  double threshold;
+} Metric;
+
+typedef struct {
+  char name[MAX_NAME];
+  char *source;
+  size_t length;
+} Input;
+
+// Two-sided 95% critical values of Student's t for 1 to 30 degrees of freedom.
+static const double T_95[] = {
+  12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262, 2.228, 2.201, 2.179, 2.160, 2.145, 2.131,
+  2.120,  2.110, 2.101, 2.093, 2.086, 2.080, 2.074, 2.069, 2.064, 2.060, 2.056, 2.052, 2.048, 2.045, 2.042,
+};
+
+static double t_95(double degrees_of_freedom) {
+  if (degrees_of_freedom < 1) return T_95[0];
+  if (degrees_of_freedom <= 30) return T_95[(int)degrees_of_freedom - 1];
+  if (degrees_of_freedom <= 60) return 2.000;
+  if (degrees_of_freedom <= 120) return 1.980;
+  return 1.960;
+}
+
+static double ci95(unsigned rounds, double stddev) {
+  if (rounds < 2) return 0;
+  return t_95(rounds - 1) * stddev / sqrt((double)rounds);
+}
+
+static double sample_stddev(double sum, double sum_of_squares, unsigned count) {
+  double variance = count > 1 ? (sum_of_squares - sum * sum / count) / (count - 1) : 0;
+  return variance > 0 ? sqrt(variance) : 0;
+}
+
+static int compare_doubles(const void *left, const void *right) {
+  double a = *(const double *)left;
+  double b = *(const double *)right;
+  return (a > b) - (a < b);
+}
+
+// `times` has room for rounds * parses single parse times.
+static void measure(TSParser *parser, const Input *input, unsigned rounds, unsigned parses, double *times,
+                    Measurement *result) {
+  memset(result, 0, sizeof(*result));
+  snprintf(result->name, sizeof(result->name), "%s", input->name);
+  result->bytes = input->length;
+  result->rounds = rounds;
+
+  // The warm-up parse also measures the heap, which is the same for every parse.
+  size_t baseline = counters.current;
+  counting_allocator_reset_peak();
+  ts_tree_delete(ts_parser_parse_string(parser, NULL, input->source, (uint32_t)input->length));
+  result->peak_bytes = (double)(counters.peak - baseline);
+
+  double sum = 0, sum_of_squares = 0;
+  double throughput_sum = 0, throughput_sum_of_squares = 0;
+  size_t count = 0;
+  for (unsigned round = 0; round < rounds; round++) {
+    uint64_t round_ns = 0;
+    for (unsigned i = 0; i < parses; i++) {
+      uint64_t start = bench_now_ns();
+      TSTree *tree = ts_parser_parse_string(parser, NULL, input->source, (uint32_t)input->length);
+      uint64_t elapsed = bench_now_ns() - start;
+      ts_tree_delete(tree);
+      times[count++] = (double)elapsed;
+      round_ns += elapsed;
+    }
+    double mean = (double)round_ns / parses;
+    double throughput = round_ns ? (double)input->length * parses * 1e3 / (double)round_ns : 0;
+    sum += mean;
+    sum_of_squares += mean * mean;
+    throughput_sum += throughput;
+    throughput_sum_of_squares += throughput * throughput;
+  }
+  result->mean_ns = sum / rounds;
+  result->stddev_ns = sample_stddev(sum, sum_of_squares, rounds);
+  result->throughput_mbs = throughput_sum / rounds;
+  result->throughput_stddev_mbs = sample_stddev(throughput_sum, throughput_sum_of_squares, rounds);
+
+  qsort(times, count, sizeof(double), compare_doubles);
+  size_t rank = (size_t)ceil(0.99 * (double)count);
+  result->p99_ns = times[rank ? rank - 1 : 0];
+}
+
+static void save(FILE *output, const char *revision, unsigned rounds, unsigned parses, const Measurement *results,
+                 size_t count) {
+  char date[32];
+  time_t now = time(NULL);
+  strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%SZ", gmtime(&now));
+  fputs("{\"revision\":", output);
+  bench_json_string(output, revision);
+  fprintf(output, ",\"date\":\"%s\",\"rounds\":%u,\"parses_per_round\":%u}\n", date, rounds, parses);
+  for (size_t i = 0; i < count; i++) {
+    const Measurement *result = &results[i];
+    fputs("{\"input\":", output);
+    bench_json_string(output, result->name);
+    fprintf(output,
+            ",\"bytes\":%zu,\"rounds\":%u,\"mean_ns\":%.1f,\"stddev_ns\":%.1f,\"ci95_ns\":%.1f"
+            ",\"throughput_mbs\":%.3f,\"throughput_stddev_mbs\":%.3f,\"p99_ns\":%.1f,\"peak_bytes\":%.0f}\n",
+            result->bytes, result->rounds, result->mean_ns, result->stddev_ns, ci95(result->rounds, result->stddev_ns),
+            result->throughput_mbs, result->throughput_stddev_mbs, result->p99_ns, result->peak_bytes);
+  }
+}
+
+static const char *json_number(const char *line, const char *key, double *value) {
+  const char *found = strstr(line, key);
+  if (!found) return NULL;
+  *value = strtod(found + strlen(key), NULL);
+  return found;
+}
+
+static void json_optional_number(const char *line, const char *key, double *value) {
+  if (!json_number(line, key, value)) *value = NAN;
+}
+
+// Reads the lines written by save() into a new array in `*measurements`, which
+// the caller frees. Returns the number of measurements, or -1 if the file
+// cannot be read. The revision goes to `revision`. The baseline may list more
+// or other inputs than this run; callers match them up by name.
+static long load(const char *path, Measurement **measurements, char *revision, size_t revision_size) {
+  size_t length = 0;
+  char *data = bench_read_file(path, &length);
+  if (!data) return -1;
+
+  // One measurement per line at most, whatever inputs this run measures.
+  size_t line_count = 1;
+  for (size_t i = 0; i < length; i++) {
+    if (data[i] == '\n') line_count++;
+  }
+  Measurement *results = (Measurement *)calloc(line_count, sizeof(Measurement));
+  if (!results) {
+    free(data);
+    return -1;
+  }
+  *measurements = results;
+
+  long count = 0;
+  snprintf(revision, revision_size, "unknown");
+  for (char *line = strtok(data, "\n"); line; line = strtok(NULL, "\n")) {
+    const char *value = strstr(line, "\"revision\":\"");
+    if (value) {
+      value += strlen("\"revision\":\"");
+      size_t size = strcspn(value, "\"");
+      snprintf(revision, revision_size, "%.*s", (int)size, value);
+      continue;
+    }
+
+    const char *name = strstr(line, "\"input\":\"");
+    if (!name) continue;
+    name += strlen("\"input\":\"");
+    Measurement *result = &results[count];
+    size_t size = 0;
+    for (const char *c = name; *c && *c != '"' && size + 1 < MAX_NAME; c++) {
+      if (*c == '\\' && c[1]) c++;
+      result->name[size++] = *c;
+    }
+    result->name[size] = '\0';
+
+    double bytes = 0, rounds = 0;
+    if (!json_number(line, "\"bytes\":", &bytes) || !json_number(line, "\"rounds\":", &rounds) ||
+        !json_number(line, "\"mean_ns\":", &result->mean_ns) ||
+        !json_number(line, "\"stddev_ns\":", &result->stddev_ns)) {
+      continue;
+    }
+    json_optional_number(line, "\"throughput_mbs\":", &result->throughput_mbs);
+    json_optional_number(line, "\"throughput_stddev_mbs\":", &result->throughput_stddev_mbs);
+    json_optional_number(line, "\"p99_ns\":", &result->p99_ns);
+    json_optional_number(line, "\"peak_bytes\":", &result->peak_bytes);
+    result->bytes = (size_t)bytes;
+    result->rounds = (unsigned)rounds;
+    count++;
+  }
+  free(data);
+  return count;
+}
+
+// Prints the change of one metric from `base` to `current` and returns true if
+// it is a regression larger than the metric's threshold. With `rounds` of zero
+// the values are exact, so any change counts as significant.
+static bool compare(const char *name, const Metric *metric, double base, double base_stddev, unsigned base_rounds,
+                    double current, double current_stddev, unsigned current_rounds) {
+  if (isnan(base)) {
+    printf("%-36s %-10s %12s\n", name, metric->label, "(not in baseline)");
+    return false;
+  }
+  if (base == 0) {
+    printf("%-36s %-10s %12.1f %12.1f\n", name, metric->label, base, current / metric->scale);
+    return false;
+  }
+
+  double base_variance = base_rounds ? base_stddev * base_stddev / base_rounds : 0;
+  double current_variance = current_rounds ? current_stddev * current_stddev / current_rounds : 0;
+  double standard_error = sqrt(base_variance + current_variance);
+  double degrees_of_freedom = 1;
+  if (standard_error > 0 && base_rounds > 1 && current_rounds > 1) {
+    degrees_of_freedom = pow(base_variance + current_variance, 2) /
+                         (base_variance * base_variance / (base_rounds - 1) +
+                          current_variance * current_variance / (current_rounds - 1));
+  }
+
+  double difference = current - base;
+  double interval = standard_error > 0 ? t_95(degrees_of_freedom) * standard_error : 0;
+  double delta = 100.0 * difference / base;
+  double delta_interval = 100.0 * interval / base;
+  // Positive when the metric got worse.
+  double worse = metric->direction == LOWER_IS_BETTER ? difference : -difference;
+  double worse_delta = metric->direction == LOWER_IS_BETTER ? delta : -delta;
+
+  const char *verdict = "~";
+  bool failed = false;
+  if (worse - interval > 0) {
+    verdict = "worse";
+    if (worse_delta > metric->threshold) {
+      verdict = "WORSE";
+      failed = true;
+    }
+  } else if (worse + interval < 0) {
+    verdict = "better";
+  }
+
+  printf("%-36s %-10s %12.1f %12.1f %+8.2f%% %7.2f%%  %s\n", name, metric->label, base / metric->scale,
+         current / metric->scale, delta, delta_interval, verdict);
+  return failed;
+}
+
+// Compares every metric of one input and returns the number that regressed.
+static size_t compare_input(const Measurement *base, const Measurement *current, const Metric metrics[4]) {
+  size_t failures = 0;
+  failures += compare(current->name, &metrics[0], base->mean_ns, base->stddev_ns, base->rounds, current->mean_ns,
+                      current->stddev_ns, current->rounds);
+  failures += compare(current->name, &metrics[1], base->throughput_mbs, base->throughput_stddev_mbs, base->rounds,
+                      current->throughput_mbs, current->throughput_stddev_mbs, current->rounds);
+  failures += compare(current->name, &metrics[2], base->p99_ns, 0, 0, current->p99_ns, 0, 0);
+  failures += compare(current->name, &metrics[3], base->peak_bytes, 0, 0, current->peak_bytes, 0, 0);
+  return failures;
+}
+
+static bool add_input(Input *inputs, size_t *count, const char *name, char *source, size_t length) {
+  if (!source) {
+    fprintf(stderr, "could not read %s\n", name);
+    return false;
+  }
+  snprintf(inputs[*count].name, MAX_NAME, "%s", name);
+  inputs[*count].source = source;
+  inputs[*count].length = length;
+  (*count)++;
+  return true;
+}
+
+static void add_default_inputs(Input *inputs, size_t *count) {
+  size_t length = 0;
+  char *app = bench_read_file(BENCH_DEFAULT_INPUT, &length);
+  if (app) {
+    size_t repeated_length = 0;
+    char *repeated = bench_repeat(app, length, 64, &repeated_length);
+    add_input(inputs, count, "app.vue", app, length);
+    add_input(inputs, count, "app.vue x64", repeated, repeated_length);
+  } else {
+    fprintf(stderr, "could not read %s\n", BENCH_DEFAULT_INPUT);
+  }
+
+  char *corpus = bench_read_file(CORPUS_PATH, &length);
+  if (!corpus) {
+    fprintf(stderr, "could not read %s\n", CORPUS_PATH);
+    return;
+  }
+  BenchCorpusCase cases[MAX_CORPUS_CASES];
+  size_t case_count = bench_corpus_cases(corpus, length, cases, MAX_CORPUS_CASES);
+  if (case_count > MAX_CORPUS_CASES) case_count = MAX_CORPUS_CASES;
+  for (size_t i = 0; i < case_count; i++) {
+    if (cases[i].input_length == 0) continue;
+    char name[MAX_NAME];
+    snprintf(name, sizeof(name), "corpus %zu: %.*s", i + 1, (int)cases[i].name_length, cases[i].name);
+    size_t repeated_length = 0;
+    char *repeated = bench_repeat(cases[i].input, cases[i].input_length,
+                                  CORPUS_TARGET_BYTES / cases[i].input_length + 1, &repeated_length);
+    add_input(inputs, count, name, repeated, repeated_length);
+  }
+  free(corpus);
+}
+
+int main(int argc, char **argv) {
+  unsigned rounds = DEFAULT_ROUNDS;
+  unsigned parses = DEFAULT_PARSES;
+  Metric metrics[4] = {
+    {"mean_us", 1e3, LOWER_IS_BETTER, DEFAULT_THRESHOLD},
+    {"MB/s", 1, HIGHER_IS_BETTER, DEFAULT_THROUGHPUT_THRESHOLD},
+    {"p99_us", 1e3, LOWER_IS_BETTER, DEFAULT_P99_THRESHOLD},
+    {"heap_KB", 1024, LOWER_IS_BETTER, DEFAULT_MEMORY_THRESHOLD},
+  };
+  const char *revision = "unknown";
+  const char *save_path = NULL;
+  const char *baseline_path = NULL;
+  Input *inputs = (Input *)calloc((size_t)argc + MAX_CORPUS_CASES + 2, sizeof(Input));
+  size_t input_count = 0;
+  if (!inputs) return 1;
+
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "-k") == 0 && i + 1 < argc) {
+      rounds = (unsigned)strtoul(argv[++i], NULL, 10);
+    } else if (strcmp(argv[i], "-n") == 0 && i + 1 < argc) {
+      parses = (unsigned)strtoul(argv[++i], NULL, 10);
+    } else if (strcmp(argv[i], "-r") == 0 && i + 1 < argc) {
+      revision = argv[++i];
+    } else if (strcmp(argv[i], "-o") == 0 && i + 1 < argc) {
+      save_path = argv[++i];
+    } else if (strcmp(argv[i], "-b") == 0 && i + 1 < argc) {
+      baseline_path = argv[++i];
+    } else if (strcmp(argv[i], "-t") == 0 && i + 1 < argc) {
+      metrics[0].threshold = strtod(argv[++i], NULL);
+    } else if (strcmp(argv[i], "-x") == 0 && i + 1 < argc) {
+      metrics[1].threshold = strtod(argv[++i], NULL);
+    } else if (strcmp(argv[i], "-p") == 0 && i + 1 < argc) {
+      metrics[2].threshold = strtod(argv[++i], NULL);
+    } else if (strcmp(argv[i], "-m") == 0 && i + 1 < argc) {
+      metrics[3].threshold = strtod(argv[++i], NULL);
+    } else {
+      size_t length = 0;
+      char *source = bench_read_file(argv[i], &length);
+      add_input(inputs, &input_count, argv[i], source, length);
+    }
+  }
+  if (rounds < 2) rounds = 2;
+  if (parses == 0) parses = 1;
+  if (input_count == 0) add_default_inputs(inputs, &input_count);
+  if (input_count == 0) return 1;
+
+  Measurement *results = (Measurement *)calloc(input_count, sizeof(Measurement));
+  double *times = (double *)calloc((size_t)rounds * parses, sizeof(double));
+  if (!results || !times) return 1;
+
+  counting_allocator_install();
+  TSParser *parser = ts_parser_new();
+  ts_parser_set_language(parser, tree_sitter_vue3());
+
+  printf("# revision %s, %u rounds of %u parses per input\n", revision, rounds, parses);
+  printf("%-36s %9s %12s %12s %12s %12s %12s\n", "input", "bytes", "mean_us", "ci95_us", "MB/s", "p99_us",
+         "peak_heap_KB");
+  for (size_t i = 0; i < input_count; i++) {
+    measure(parser, &inputs[i], rounds, parses, times, &results[i]);
+    printf("%-36s %9zu %12.1f %12.2f %12.2f %12.1f %12.1f\n", results[i].name, results[i].bytes,
+           results[i].mean_ns / 1e3, ci95(results[i].rounds, results[i].stddev_ns) / 1e3, results[i].throughput_mbs,
+           results[i].p99_ns / 1e3, results[i].peak_bytes / 1024);
+  }
+  ts_parser_delete(parser);
+  free(times);
+
+  int status = 0;
+  if (save_path) {
+    FILE *output = fopen(save_path, "w");
+    if (output) {
+      save(output, revision, rounds, parses, results, input_count);
+      fclose(output);
+      printf("# saved to %s\n", save_path);
+    } else {
+      fprintf(stderr, "could not open %s\n", save_path);
+      status = 1;
+    }
+  }
+
+  if (baseline_path) {
+    Measurement *baseline = NULL;
+    char baseline_revision[64];
+    long baseline_count = load(baseline_path, &baseline, baseline_revision, sizeof(baseline_revision));
+    if (baseline_count < 0) {
+      fprintf(stderr, "could not read baseline %s\n", baseline_path);
+      status = 1;
+    } else {
+      printf("\n# %s (baseline) -> %s, regressions fail over", baseline_revision, revision);
+      for (size_t m = 0; m < 4; m++) {
+        printf("%s %s %.1f%%", m ? "," : "", metrics[m].label, metrics[m].threshold);
+      }
+      printf("\n%-36s %-10s %12s %12s %9s %8s\n", "input", "metric", "base", "now", "delta", "ci95");
+      size_t failures = 0;
+      for (size_t i = 0; i < input_count; i++) {
+        const Measurement *base = NULL;
+        for (long j = 0; j < baseline_count; j++) {
+          if (strcmp(baseline[j].name, results[i].name) == 0) base = &baseline[j];
+        }
+        if (!base) {
+          printf("%-36s %12s\n", results[i].name, "(not in baseline)");
+        } else {
+          failures += compare_input(base, &results[i], metrics);
+        }
+      }
+      if (failures) {
+        fprintf(stderr, "%zu metric%s significantly worse than the baseline\n", failures, failures == 1 ? "" : "s");
+        status = 1;
+      }
+    }
+    free(baseline);
+  }
+
+  for (size_t i = 0; i < input_count; i++) {
+    free(inputs[i].source);
+  }
+  free(inputs);
+  free(results);
+  return status;
+}
@@ -0,0 +1,239 @@
+// Drives the external scanner directly through a mock TSLexer, without the
+// parser, and reports ns per byte for each scanner mode. Each mode has its own
+// crafted input and valid_symbols array and exercises one hot loop: the text
+// and interpolation loops in vue_scan, scan_raw_text for <script> and <style>,
+// scan_comment, and scan_tag_name through the start and end tag paths.
+//
+//   scanner_bench [iterations] [kilobytes]
+
+#include <string.h>
+
+#include "../src/scanner.c"
+#include "bench.h"
+#include "mock_lexer.h"
+
+typedef struct {
+  const char *name;
+  // Repeated up to the target size.
+  const char *body;
+  const char *prefix;
+  const char *suffix;
+  // External tokens that are valid for every call.
+  unsigned valid;
+  // Tag pushed onto the stack before the walk, e.g. SCRIPT for raw text.
+  const char *open_tag;
+  // Push the tag named by each token before scanning it, so that end tags
+  // match and pop.
+  bool push_each_token;
+  // Pop after each token so that start tags do not grow the stack.
+  bool pop_each_token;
+} ScannerMode;
+
+#define VALID(token) (1u << (token))
+
+static const ScannerMode MODES[] = {
+  {
+    "text",
+    "Lorem ipsum dolor sit amet, a < b && c > d { not an interpolation } - \xC3\xA9t\xC3\xA9 \xE2\x80\x94 fin.\n",
+    "",
+    "</div>",
+    VALID(TEXT_FRAGMENT),
+    NULL,
+    false,
+    false,
+  },
+  {
+    "interpolation",
+    " items.filter((item) => item.a < limit ? { x: 1 } : fn({ y: [1, 2] })).length ",
+    "",
+    "}}",
+    VALID(INTERPOLATION_TEXT) | VALID(TEXT_FRAGMENT),
+    NULL,
+    false,
+    false,
+  },
+  {
+    "raw_text_script",
+    "const html = count < 10 ? \"<div>\" : '</span>'; // </scr is not the end\n",
+    "",
+    "</script>",
+    VALID(RAW_TEXT),
+    "SCRIPT",
+    false,
+    false,
+  },
+  {
+    "raw_text_style",
+    ".list > .item:hover, a[href$=\".vue\"] { margin: 0 auto; content: \"</sty\"; }\n",
+    "",
+    "</style>",
+    VALID(RAW_TEXT),
+    "STYLE",
+    false,
+    false,
+  },
+  {
+    "comment",
+    "  <div v-if=\"x\"> -- commented out -> not yet - </div>\n",
+    "<!--",
+    "-->",
+    VALID(TEXT_FRAGMENT) | VALID(START_TAG_NAME) | VALID(COMMENT),
+    NULL,
+    false,
+    false,
+  },
+  {
+    "start_tag_name",
+    "div el-table-column MyComponent span x-very-long-custom-element-name svg:path router-link\n",
+    "",
+    "",
+    VALID(START_TAG_NAME) | VALID(TEMPLATE_START_TAG_NAME) | VALID(SCRIPT_START_TAG_NAME) |
+      VALID(STYLE_START_TAG_NAME),
+    NULL,
+    false,
+    true,
+  },
+  {
+    "end_tag_name",
+    "div el-table-column MyComponent span x-very-long-custom-element-name svg:path router-link\n",
+    "",
+    "",
+    VALID(END_TAG_NAME) | VALID(ERRONEOUS_END_TAG_NAME),
+    NULL,
+    true,
+    false,
+  },
+};
+
+static char *build_input(const ScannerMode *mode, size_t target_length, size_t *length) {
+  size_t prefix_length = strlen(mode->prefix);
+  size_t body_length = strlen(mode->body);
+  size_t suffix_length = strlen(mode->suffix);
+  size_t copies = target_length / body_length + 1;
+  char *data = (char *)malloc(prefix_length + copies * body_length + suffix_length + 1);
+  if (!data) return NULL;
+
+  size_t size = 0;
+  memcpy(data, mode->prefix, prefix_length);
+  size += prefix_length;
+  for (size_t i = 0; i < copies; i++) {
+    memcpy(&data[size], mode->body, body_length);
+    size += body_length;
+  }
+  memcpy(&data[size], mode->suffix, suffix_length);
+  size += suffix_length;
+  data[size] = '\0';
+  *length = size;
+  return data;
+}
+
+// The uppercased tag name starting at `position`, as scan_tag_name stores it.
+static Tag tag_at(const char *input, size_t length, size_t position) {
+  char name[TREE_SITTER_HTML_MAX_CUSTOM_TAG_NAME_LENGTH + 1];
+  size_t size = 0;
+  while (position < length && size < TREE_SITTER_HTML_MAX_CUSTOM_TAG_NAME_LENGTH &&
+         !strchr(" \t\n", input[position])) {
+    name[size++] = (char)towupper((unsigned char)input[position++]);
+  }
+  name[size] = '\0';
+  return tag_for_name(name);
+}
+
+// Scans the input from start to end in one mode, restarting after each token
+// (or one byte past the start when nothing is recognized).
+static uint64_t walk(const ScannerMode *mode, Scanner *scanner, MockLexer *lexer, const bool *valid_symbols,
+                     const Tag *tokens, uint64_t *calls) {
+  uint64_t token_count = 0;
+  size_t position = 0;
+  size_t token_index = 0;
+  while (position < lexer->length) {
+    mock_lexer_reset(lexer, position);
+    if (mode->push_each_token) {
+      tag_stack_push(&scanner->tags, &tokens[token_index]);
+    }
+    (*calls)++;
+    size_t next = position + 1;
+    if (tree_sitter_vue3_external_scanner_scan(scanner, &lexer->lexer, valid_symbols) &&
+        mock_lexer_token_end(lexer) > position) {
+      token_count++;
+      token_index++;
+      next = mock_lexer_token_end(lexer);
+    }
+    if (mode->pop_each_token) {
+      tag_stack_pop(&scanner->tags);
+    }
+    position = next;
+  }
+  return token_count;
+}
+
+int main(int argc, char **argv) {
+  unsigned iterations = argc > 1 ? (unsigned)strtoul(argv[1], NULL, 10) : 20;
+  size_t kilobytes = argc > 2 ? (size_t)strtoull(argv[2], NULL, 10) : 256;
+  if (iterations == 0) iterations = 1;
+  if (kilobytes == 0) kilobytes = 1;
+
+  uint64_t *samples = (uint64_t *)malloc(iterations * sizeof(uint64_t));
+  if (!samples) return 1;
+
+  printf("# %zu KB per mode, %u iterations, median of each\n", kilobytes, iterations);
+  printf("%-16s %10s %10s %10s %10s %10s\n", "mode", "bytes", "calls", "tokens", "ns/byte", "ns/call");
+
+  int status = 0;
+  for (size_t m = 0; m < sizeof(MODES) / sizeof(MODES[0]); m++) {
+    const ScannerMode *mode = &MODES[m];
+    size_t length = 0;
+    char *input = build_input(mode, kilobytes * 1024, &length);
+    Tag *tokens = mode->push_each_token ? (Tag *)calloc(length / 2 + 1, sizeof(Tag)) : NULL;
+    Scanner *scanner = (Scanner *)tree_sitter_vue3_external_scanner_create();
+    if (!input || (mode->push_each_token && !tokens) || !scanner) {
+      free(input);
+      free(tokens);
+      tree_sitter_vue3_external_scanner_destroy(scanner);
+      status = 1;
+      continue;
+    }
+
+    bool valid_symbols[TS_VUE3_EXTERNAL_TOKEN_COUNT] = {false};
+    for (unsigned i = 0; i < TS_VUE3_EXTERNAL_TOKEN_COUNT; i++) {
+      valid_symbols[i] = mode->valid & VALID(i);
+    }
+
+    if (mode->push_each_token) {
+      size_t count = 0;
+      for (size_t i = 0; i < length; i++) {
+        if (strchr(" \t\n", input[i])) continue;
+        tokens[count++] = tag_at(input, length, i);
+        while (i < length && !strchr(" \t\n", input[i])) i++;
+      }
+    }
+
+    MockLexer lexer;
+    mock_lexer_init(&lexer, input, length);
+
+    uint64_t calls = 0;
+    uint64_t token_count = 0;
+    for (unsigned i = 0; i < iterations; i++) {
+      tag_stack_clear(&scanner->tags);
+      if (mode->open_tag) {
+        Tag tag = tag_for_name(mode->open_tag);
+        tag_stack_push(&scanner->tags, &tag);
+      }
+      calls = 0;
+      uint64_t start = bench_now_ns();
+      token_count = walk(mode, scanner, &lexer, valid_symbols, tokens, &calls);
+      samples[i] = bench_now_ns() - start;
+    }
+
+    uint64_t median = bench_percentile(samples, iterations, 50);
+    printf("%-16s %10zu %10llu %10llu %10.3f %10.1f\n", mode->name, length, (unsigned long long)calls,
+           (unsigned long long)token_count, (double)median / length, calls ? (double)median / calls : 0.0);
+
+    tree_sitter_vue3_external_scanner_destroy(scanner);
+    free(tokens);
+    free(input);
+  }
+
+  free(samples);
+  return status;
+}
@@ -0,0 +1,325 @@
+#ifndef TREE_SITTER_VUE3_SFC_GEN_H_
+#define TREE_SITTER_VUE3_SFC_GEN_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Deterministic generator of Vue single-file components for scaling
+// benchmarks. The same options always produce the same bytes.
+typedef struct {
+  uint64_t seed;
+  // Levels of elements below the <template> root.
+  unsigned depth;
+  // Children per element.
+  unsigned fanout;
+  // Plain attributes per element.
+  unsigned attributes;
+  // Directives (v-*, :, @ and #) per element.
+  unsigned directives;
+  // Probability that a text child contains an interpolation.
+  double interpolation_density;
+  // Approximate sizes of the <script> and <style> bodies.
+  size_t script_bytes;
+  size_t style_bytes;
+  // Fraction of elements that are custom components rather than HTML tags.
+  double component_ratio;
+  // Fraction of elements that get a deliberate syntax error: a missing or
+  // stray end tag, an unclosed interpolation, or a bare `<` in text.
+  double malformation_rate;
+} SfcOptions;
+
+static const SfcOptions SFC_DEFAULT_OPTIONS = {
+  1,      // seed
+  4,      // depth
+  4,      // fanout
+  2,      // attributes
+  2,      // directives
+  0.5,    // interpolation_density
+  2048,   // script_bytes
+  1024,   // style_bytes
+  0.3,    // component_ratio
+  0.0,    // malformation_rate
+};
+
+typedef struct {
+  char *data;
+  size_t size;
+  size_t capacity;
+  uint64_t rng;
+  bool failed;
+} SfcBuffer;
+
+static inline uint64_t sfc_next(SfcBuffer *buffer) {
+  // splitmix64
+  uint64_t z = (buffer->rng += 0x9E3779B97F4A7C15ull);
+  z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+  z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+  return z ^ (z >> 31);
+}
+
+static inline unsigned sfc_below(SfcBuffer *buffer, unsigned limit) {
+  return limit ? (unsigned)(sfc_next(buffer) % limit) : 0;
+}
+
+static inline bool sfc_chance(SfcBuffer *buffer, double probability) {
+  if (probability <= 0) return false;
+  if (probability >= 1) return true;
+  return (double)(sfc_next(buffer) >> 11) / 9007199254740992.0 < probability;
+}
+
+static inline void sfc_append(SfcBuffer *buffer, const char *text, size_t length) {
+  if (buffer->failed) return;
+  if (buffer->size + length + 1 > buffer->capacity) {
+    size_t capacity = buffer->capacity ? buffer->capacity : 4096;
+    while (capacity < buffer->size + length + 1) {
+      capacity *= 2;
+    }
+    char *data = (char *)realloc(buffer->data, capacity);
+    if (!data) {
+      buffer->failed = true;
+      return;
+    }
+    buffer->data = data;
+    buffer->capacity = capacity;
+  }
+  memcpy(&buffer->data[buffer->size], text, length);
+  buffer->size += length;
+  buffer->data[buffer->size] = '\0';
+}
+
+static inline void sfc_puts(SfcBuffer *buffer, const char *text) {
+  sfc_append(buffer, text, strlen(text));
+}
+
+static inline void sfc_printf_u(SfcBuffer *buffer, const char *format, unsigned value) {
+  char text[256];
+  int length = snprintf(text, sizeof(text), format, value, value);
+  if (length > 0) sfc_append(buffer, text, (size_t)length < sizeof(text) ? (size_t)length : sizeof(text) - 1);
+}
+
+static inline void sfc_indent(SfcBuffer *buffer, unsigned level) {
+  static const char spaces[] = "                                                                ";
+  size_t width = 2u * level;
+  if (width > sizeof(spaces) - 1) width = sizeof(spaces) - 1;
+  sfc_append(buffer, spaces, width);
+}
+
+static const char *const SFC_HTML_TAGS[] = {
+  "div", "span", "section", "article", "header", "footer", "button", "label", "strong", "em", "nav", "main",
+};
+
+static const char *const SFC_COMPONENT_TAGS[] = {
+  "UserCard", "el-table-column", "RouterLink", "base-button", "AppDialog", "v-list-item", "TransitionGroup", "i18n-t",
+};
+
+// printf formats taking the same number twice.
+static const char *const SFC_ATTRIBUTES[] = {
+  " class=\"item-%u box-%u\"",
+  " id=\"node-%u\"",
+  " data-index=\"%u\"",
+  " title='Title %u'",
+  " aria-label=\"label %u\"",
+  " tabindex=%u",
+  " disabled",
+  " role=\"listitem\"",
+};
+
+static const char *const SFC_DIRECTIVES[] = {
+  " v-if=\"visible%u\"",
+  " v-for=\"(item, index) in list%u\"",
+  " :key=\"item.id + %u\"",
+  " :class=\"{ active: index === selected%u }\"",
+  " @click.stop=\"select(%u)\"",
+  " v-model.trim=\"form.field%u\"",
+  " v-show=\"!hidden%u\"",
+  " v-bind:title=\"titles[%u]\"",
+  " v-on:keyup.enter=\"submit(%u)\"",
+  " #header=\"{ title%u }\"",
+  " :[dynamicAttr%u]=\"value\"",
+  " v-focus.lazy=\"%u\"",
+};
+
+#define SFC_COUNT(array) (sizeof(array) / sizeof((array)[0]))
+
+static inline void sfc_text(SfcBuffer *buffer, const SfcOptions *options, unsigned level, unsigned id) {
+  sfc_indent(buffer, level);
+  sfc_printf_u(buffer, "Lorem ipsum %u dolor sit amet", id);
+  if (sfc_chance(buffer, options->interpolation_density)) {
+    sfc_printf_u(buffer, " {{ item.value%u ?? fallback }}", id);
+  }
+  sfc_puts(buffer, "\n");
+}
+
+static inline void sfc_element(SfcBuffer *buffer, const SfcOptions *options, unsigned level, unsigned remaining_depth, unsigned *id) {
+  unsigned element_id = (*id)++;
+  bool component = sfc_chance(buffer, options->component_ratio);
+  const char *tag = component
+    ? SFC_COMPONENT_TAGS[sfc_below(buffer, SFC_COUNT(SFC_COMPONENT_TAGS))]
+    : SFC_HTML_TAGS[sfc_below(buffer, SFC_COUNT(SFC_HTML_TAGS))];
+
+  unsigned malformation = sfc_chance(buffer, options->malformation_rate) ? 1 + sfc_below(buffer, 4) : 0;
+
+  sfc_indent(buffer, level);
+  sfc_puts(buffer, "<");
+  sfc_puts(buffer, tag);
+  for (unsigned i = 0; i < options->attributes; i++) {
+    sfc_printf_u(buffer, SFC_ATTRIBUTES[(element_id + i) % SFC_COUNT(SFC_ATTRIBUTES)], element_id);
+  }
+  for (unsigned i = 0; i < options->directives; i++) {
+    sfc_printf_u(buffer, SFC_DIRECTIVES[(element_id + i) % SFC_COUNT(SFC_DIRECTIVES)], element_id);
+  }
+
+  if (remaining_depth == 0 && options->fanout > 0 && component && malformation == 0) {
+    sfc_puts(buffer, " />\n");
+    return;
+  }
+  sfc_puts(buffer, ">\n");
+
+  if (remaining_depth == 0) {
+    sfc_text(buffer, options, level + 1, element_id);
+  } else {
+    for (unsigned i = 0; i < options->fanout; i++) {
+      if (sfc_chance(buffer, 0.25)) {
+        sfc_text(buffer, options, level + 1, *id);
+      }
+      sfc_element(buffer, options, level + 1, remaining_depth - 1, id);
+    }
+  }
+
+  switch (malformation) {
+    case 1:
+      // Missing end tag.
+      return;
+    case 2:
+      sfc_indent(buffer, level + 1);
+      sfc_puts(buffer, "</stray-end-tag>\n");
+      break;
+    case 3:
+      sfc_indent(buffer, level + 1);
+      sfc_printf_u(buffer, "{{ unclosed%u\n", element_id);
+      break;
+    case 4:
+      sfc_indent(buffer, level + 1);
+      sfc_puts(buffer, "a < b and c <= d\n");
+      break;
+  }
+
+  sfc_indent(buffer, level);
+  sfc_puts(buffer, "</");
+  sfc_puts(buffer, tag);
+  sfc_puts(buffer, ">\n");
+}
+
+static inline void sfc_script(SfcBuffer *buffer, size_t target_bytes) {
+  sfc_puts(buffer, "\n<script setup lang=\"ts\">\nimport { ref, computed } from \"vue\";\n\n");
+  size_t start = buffer->size;
+  for (unsigned i = 0; buffer->size - start < target_bytes && !buffer->failed; i++) {
+    sfc_printf_u(buffer, "const value%u = ref<number>(%u);\n", i);
+    sfc_printf_u(buffer, "const doubled%u = computed(() => value%u.value * 2 < 10 ? \"<small>\" : '</big>');\n", i);
+  }
+  sfc_puts(buffer, "</script>\n");
+}
+
+static inline void sfc_style(SfcBuffer *buffer, size_t target_bytes) {
+  sfc_puts(buffer, "\n<style scoped lang=\"scss\">\n");
+  size_t start = buffer->size;
+  for (unsigned i = 0; buffer->size - start < target_bytes && !buffer->failed; i++) {
+    sfc_printf_u(buffer, ".item-%u > .box-%u {\n", i);
+    sfc_printf_u(buffer, "  margin: %upx %upx;\n  color: #333;\n}\n", i);
+  }
+  sfc_puts(buffer, "</style>\n");
+}
+
+// Generates one component. Returns a NUL-terminated heap buffer, or NULL when
+// allocation fails.
+static inline char *sfc_generate(const SfcOptions *options, size_t *length) {
+  SfcBuffer buffer = {NULL, 0, 0, options->seed, false};
+  unsigned id = 0;
+
+  sfc_puts(&buffer, "<template>\n");
+  if (options->fanout == 0) {
+    sfc_text(&buffer, options, 1, 0);
+  } else {
+    sfc_element(&buffer, options, 1, options->depth, &id);
+  }
+  sfc_puts(&buffer, "</template>\n");
+  if (options->script_bytes) sfc_script(&buffer, options->script_bytes);
+  if (options->style_bytes) sfc_style(&buffer, options->style_bytes);
+
+  if (buffer.failed) {
+    free(buffer.data);
+    return NULL;
+  }
+  if (length) {
+    *length = buffer.size;
+  }
+  return buffer.data;
+}
+
+// Sets the option called `name` from `value`. Returns false for unknown names.
+static inline bool sfc_set_option(SfcOptions *options, const char *name, const char *value) {
+  if (strcmp(name, "seed") == 0) {
+    options->seed = strtoull(value, NULL, 10);
+  } else if (strcmp(name, "depth") == 0) {
+    options->depth = (unsigned)strtoul(value, NULL, 10);
+  } else if (strcmp(name, "fanout") == 0) {
+    options->fanout = (unsigned)strtoul(value, NULL, 10);
+  } else if (strcmp(name, "attributes") == 0) {
+    options->attributes = (unsigned)strtoul(value, NULL, 10);
+  } else if (strcmp(name, "directives") == 0) {
+    options->directives = (unsigned)strtoul(value, NULL, 10);
+  } else if (strcmp(name, "interpolation") == 0) {
+    options->interpolation_density = strtod(value, NULL);
+  } else if (strcmp(name, "script") == 0) {
+    options->script_bytes = (size_t)strtoull(value, NULL, 10);
+  } else if (strcmp(name, "style") == 0) {
+    options->style_bytes = (size_t)strtoull(value, NULL, 10);
+  } else if (strcmp(name, "components") == 0) {
+    options->component_ratio = strtod(value, NULL);
+  } else if (strcmp(name, "malformed") == 0) {
+    options->malformation_rate = strtod(value, NULL);
+  } else {
+    return false;
+  }
+  return true;
+}
+
+// Applies a comma-separated list of name=value options, e.g.
+// "depth=6,fanout=3". Returns false if any name is unknown.
+static inline bool sfc_parse_options(SfcOptions *options, const char *spec) {
+  bool ok = true;
+  while (*spec) {
+    const char *end = strchr(spec, ',');
+    if (!end) end = spec + strlen(spec);
+    const char *separator = (const char *)memchr(spec, '=', (size_t)(end - spec));
+    char name[32];
+    char value[64];
+    size_t name_length = separator ? (size_t)(separator - spec) : 0;
+    size_t value_length = separator ? (size_t)(end - separator - 1) : 0;
+    if (separator && name_length < sizeof(name) && value_length < sizeof(value)) {
+      memcpy(name, spec, name_length);
+      name[name_length] = '\0';
+      memcpy(value, separator + 1, value_length);
+      value[value_length] = '\0';
+      ok = sfc_set_option(options, name, value) && ok;
+    } else if (end != spec) {
+      ok = false;
+    }
+    spec = *end ? end + 1 : end;
+  }
+  return ok;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,140 @@
+// Parse time against each axis of the synthetic SFC generator. Every axis is
+// swept on its own while the others keep their sfc_gen.h defaults, and each
+// generated component is parsed N times. Results go to stdout as a table and
+// to sweep_output.txt as one JSON object per line.
+//
+//   sweep [-n iterations] [-o output] [-s seed] [axis ...]
+
+#include <string.h>
+#include <tree_sitter/api.h>
+
+#include "bench.h"
+#include "sfc_gen.h"
+
+#define DEFAULT_OUTPUT "../sweep_output.txt"
+#define MAX_POINTS 12
+
+typedef struct {
+  const char *name;
+  const char *values[MAX_POINTS];
+  // Options changed from SFC_DEFAULT_OPTIONS for the whole axis, so that the
+  // sweep stays in a useful size range.
+  const char *base;
+} SweepAxis;
+
+static const SweepAxis AXES[] = {
+  {"depth", {"1", "2", "3", "4", "5", "6", "7", "8", "9", "10", "11", "12"}, "fanout=2"},
+  {"fanout", {"1", "2", "4", "8", "16", "32", "64", "128"}, "depth=2"},
+  {"attributes", {"0", "1", "2", "4", "8", "16", "32", "64"}, NULL},
+  {"directives", {"0", "1", "2", "4", "8", "16", "32", "64"}, NULL},
+  {"interpolation", {"0", "0.25", "0.5", "0.75", "1"}, NULL},
+  {"script", {"0", "1024", "4096", "16384", "65536", "262144", "1048576"}, NULL},
+  {"style", {"0", "1024", "4096", "16384", "65536", "262144", "1048576"}, NULL},
+  {"components", {"0", "0.25", "0.5", "0.75", "1"}, NULL},
+  {"malformed", {"0", "0.01", "0.05", "0.1", "0.25", "0.5"}, NULL},
+};
+
+static bool sweep_point(TSParser *parser, FILE *output, const SweepAxis *axis, const char *value, uint64_t seed,
+                        unsigned iterations, uint64_t *samples) {
+  SfcOptions options = SFC_DEFAULT_OPTIONS;
+  options.seed = seed;
+  if (axis->base) sfc_parse_options(&options, axis->base);
+  sfc_set_option(&options, axis->name, value);
+
+  size_t length = 0;
+  char *source = sfc_generate(&options, &length);
+  if (!source) return false;
+
+  uint64_t nodes = 0;
+  uint64_t tokens = 0;
+  bool has_error = false;
+  ts_tree_delete(ts_parser_parse_string(parser, NULL, source, (uint32_t)length));
+  for (unsigned i = 0; i < iterations; i++) {
+    uint64_t start = bench_now_ns();
+    TSTree *tree = ts_parser_parse_string(parser, NULL, source, (uint32_t)length);
+    samples[i] = bench_now_ns() - start;
+    if (i + 1 == iterations) {
+      bench_count_nodes(tree, &nodes, &tokens);
+      has_error = ts_node_has_error(ts_tree_root_node(tree));
+    }
+    ts_tree_delete(tree);
+  }
+
+  uint64_t p50 = bench_percentile(samples, iterations, 50);
+  uint64_t p99 = bench_percentile(samples, iterations, 99);
+  double ns_per_byte = length ? (double)p50 / (double)length : 0.0;
+
+  printf("%-14s %9s %10zu %9llu %10.1f %10.1f %9.2f%s\n", axis->name, value, length, (unsigned long long)nodes,
+         p50 / 1e3, p99 / 1e3, ns_per_byte, has_error ? "  (has errors)" : "");
+
+  fputs("{\"axis\":", output);
+  bench_json_string(output, axis->name);
+  fprintf(output,
+          ",\"value\":%s,\"seed\":%llu,\"bytes\":%zu,\"nodes\":%llu,\"tokens\":%llu,\"has_error\":%s"
+          ",\"iterations\":%u,\"p50_ns\":%llu,\"p99_ns\":%llu,\"ns_per_byte\":%.3f}\n",
+          value, (unsigned long long)seed, length, (unsigned long long)nodes, (unsigned long long)tokens,
+          has_error ? "true" : "false", iterations, (unsigned long long)p50, (unsigned long long)p99, ns_per_byte);
+
+  free(source);
+  return true;
+}
+
+int main(int argc, char **argv) {
+  unsigned iterations = 20;
+  uint64_t seed = SFC_DEFAULT_OPTIONS.seed;
+  const char *output_path = DEFAULT_OUTPUT;
+  const char **selected = (const char **)calloc((size_t)argc + 1, sizeof(char *));
+  size_t selected_count = 0;
+  if (!selected) return 1;
+
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "-n") == 0 && i + 1 < argc) {
+      iterations = (unsigned)strtoul(argv[++i], NULL, 10);
+    } else if (strcmp(argv[i], "-o") == 0 && i + 1 < argc) {
+      output_path = argv[++i];
+    } else if (strcmp(argv[i], "-s") == 0 && i + 1 < argc) {
+      seed = strtoull(argv[++i], NULL, 10);
+    } else {
+      selected[selected_count++] = argv[i];
+    }
+  }
+  if (iterations == 0) iterations = 1;
+
+  FILE *output = fopen(output_path, "w");
+  uint64_t *samples = (uint64_t *)malloc(iterations * sizeof(uint64_t));
+  if (!output || !samples) {
+    fprintf(stderr, "could not open %s\n", output_path);
+    if (output) fclose(output);
+    free(samples);
+    free(selected);
+    return 1;
+  }
+
+  TSParser *parser = ts_parser_new();
+  ts_parser_set_language(parser, tree_sitter_vue3());
+
+  printf("%-14s %9s %10s %9s %10s %10s %9s\n", "axis", "value", "bytes", "nodes", "p50_us", "p99_us", "ns/byte");
+
+  int status = 0;
+  for (size_t i = 0; i < sizeof(AXES) / sizeof(AXES[0]); i++) {
+    const SweepAxis *axis = &AXES[i];
+    bool wanted = selected_count == 0;
+    for (size_t j = 0; j < selected_count; j++) {
+      if (strcmp(selected[j], axis->name) == 0) wanted = true;
+    }
+    if (!wanted) continue;
+
+    for (unsigned j = 0; j < MAX_POINTS && axis->values[j]; j++) {
+      if (!sweep_point(parser, output, axis, axis->values[j], seed, iterations, samples)) {
+        fprintf(stderr, "could not generate %s=%s\n", axis->name, axis->values[j]);
+        status = 1;
+      }
+    }
+  }
+
+  ts_parser_delete(parser);
+  free(samples);
+  fclose(output);
+  free(selected);
+  return status;
+}
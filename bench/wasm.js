@@ -0,0 +1,164 @@
+#!/usr/bin/env node
+// Compares the WebAssembly builds of the grammar under Node: the checked-in
+// tree-sitter-vue3.wasm (the os build) and whatever script/build-wasm.js has
+// built. Each is first checked to give the same trees as the checked-in
+// build, and the exit status is 1 if any does not, after the timings. Then it
+// parses every input -n times (default 20) on the main thread, for MB/s and
+// the p50/p99 latency of a parse, and again through a ParserPool of one
+// worker and of -j workers (default: the number of CPUs) without flattening.
+// The sizes that the build recorded in wasm_sizes.json are reported next to
+// the timings, so the size/speed trade-off of each profile is in one table.
+// Results go to stdout and to wasm_output.txt as one JSON object per build
+// and mode.
+//
+//   node wasm.js [-n runs] [-j workers] [-o output] [file ...]
+//
+// The inputs default to every file in ../bench-corpus/manifest.json.
+
+const fs = require("fs");
+const os = require("os");
+const path = require("path");
+const Parser = require("web-tree-sitter");
+
+const { createParserPool } = require("../bindings/wasm");
+const { PROFILES, SIZES_PATH, CHECKED_IN } = require("../script/build-wasm");
+
+const root = path.resolve(__dirname, "..");
+
+function parseArgs(argv) {
+  const options = {
+    runs: 20,
+    workers: os.availableParallelism ? os.availableParallelism() : os.cpus().length,
+    output: path.join(root, "wasm_output.txt"),
+    files: [],
+  };
+  for (let i = 0; i < argv.length; i++) {
+    if (argv[i] === "-n") options.runs = Number(argv[++i]);
+    else if (argv[i] === "-j") options.workers = Number(argv[++i]);
+    else if (argv[i] === "-o") options.output = argv[++i];
+    else options.files.push(argv[i]);
+  }
+  if (options.files.length === 0) {
+    const manifest = require("../bench-corpus/manifest.json");
+    options.files = manifest.map((entry) => path.join(root, "bench-corpus", entry.file));
+  }
+  return options;
+}
+
+function builds() {
+  const recorded = fs.existsSync(SIZES_PATH) ? JSON.parse(fs.readFileSync(SIZES_PATH, "utf8")).builds : [];
+  const result = [{ name: "checked-in", file: CHECKED_IN }];
+  for (const [name, profile] of Object.entries(PROFILES)) {
+    if (!fs.existsSync(profile.output)) continue;
+    const entry = recorded.find((other) => other.profile === name);
+    result.push({ name, file: profile.output, flags: entry && entry.flags.join(" ") });
+  }
+  for (const build of result) build.bytes = fs.statSync(build.file).size;
+  return result;
+}
+
+function percentile(sorted, p) {
+  return sorted[Math.min(sorted.length - 1, Math.floor((sorted.length * p) / 100))];
+}
+
+function megabytesPerSecond(bytes, milliseconds) {
+  return bytes / 1e6 / (milliseconds / 1e3);
+}
+
+// Milliseconds per parse of each input, over `runs` passes after one to
+// warm up.
+function timeMainThread(parser, sources, runs) {
+  const times = sources.map(() => []);
+  for (let run = -1; run < runs; run++) {
+    sources.forEach((source, i) => {
+      const start = process.hrtime.bigint();
+      const tree = parser.parse(source);
+      const elapsed = Number(process.hrtime.bigint() - start) / 1e6;
+      tree.delete();
+      if (run >= 0) times[i].push(elapsed);
+    });
+  }
+  return times;
+}
+
+async function timePool(file, workers, sources, runs) {
+  const pool = await createParserPool({ wasm: file, size: workers });
+  try {
+    await Promise.all(sources.map((source) => pool.parse(source, { flatten: false })));
+    const start = process.hrtime.bigint();
+    for (let run = 0; run < runs; run++) {
+      await Promise.all(sources.map((source) => pool.parse(source, { flatten: false })));
+    }
+    return Number(process.hrtime.bigint() - start) / 1e6;
+  } finally {
+    await pool.close();
+  }
+}
+
+async function main() {
+  const options = parseArgs(process.argv.slice(2));
+  const sources = options.files.map((file) => fs.readFileSync(file, "utf8"));
+  const bytes = sources.reduce((sum, source) => sum + Buffer.byteLength(source), 0);
+
+  await Parser.init();
+  const parser = new Parser();
+  const results = [];
+  let expected = null;
+  for (const build of builds()) {
+    parser.setLanguage(await Parser.Language.load(build.file));
+    const trees = sources.map((source) => {
+      const tree = parser.parse(source);
+      const text = tree.rootNode.toString();
+      tree.delete();
+      return text;
+    });
+    expected = expected || trees;
+    const mismatches = trees.filter((text, i) => text !== expected[i]).length;
+    if (mismatches > 0) {
+      console.error(`${build.name}: ${mismatches} of ${sources.length} trees differ from the checked-in build`);
+      process.exitCode = 1;
+    }
+
+    const times = timeMainThread(parser, sources, options.runs);
+    const total = times.flat().reduce((sum, time) => sum + time, 0);
+    const all = times.flat().sort((a, b) => a - b);
+    const common = { build: build.name, flags: build.flags, wasmBytes: build.bytes, mismatches };
+    results.push({
+      ...common,
+      mode: "main-thread",
+      mbPerSecond: megabytesPerSecond(bytes * options.runs, total),
+      p50Ms: percentile(all, 50),
+      p99Ms: percentile(all, 99),
+    });
+
+    for (const workers of new Set([1, options.workers])) {
+      const elapsed = await timePool(build.file, workers, sources, options.runs);
+      results.push({
+        ...common,
+        mode: `pool-${workers}`,
+        mbPerSecond: megabytesPerSecond(bytes * options.runs, elapsed),
+      });
+    }
+  }
+
+  console.log(`${sources.length} files, ${(bytes / 1e3).toFixed(0)} KB, ${options.runs} runs`);
+  console.log("build        wasm bytes  mode           MB/s     p50 ms   p99 ms");
+  for (const result of results) {
+    console.log(
+      [
+        result.build.padEnd(12),
+        String(result.wasmBytes).padStart(10),
+        " " + result.mode.padEnd(12),
+        result.mbPerSecond.toFixed(2).padStart(8),
+        result.p50Ms === undefined ? "" : result.p50Ms.toFixed(3).padStart(10),
+        result.p99Ms === undefined ? "" : result.p99Ms.toFixed(3).padStart(8),
+      ].join(" "),
+    );
+  }
+  fs.writeFileSync(options.output, results.map((result) => JSON.stringify(result)).join("\n") + "\n");
+}
+
+main().catch((error) => {
+  console.error(error);
+  process.exit(1);
+});
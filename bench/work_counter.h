@@ -0,0 +1,91 @@
+#ifndef TREE_SITTER_VUE3_WORK_COUNTER_H_
+#define TREE_SITTER_VUE3_WORK_COUNTER_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <tree_sitter/api.h>
+#include <tree_sitter/parser.h>
+
+#include "scanner_stats.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Counts the characters the internal lexer, the keyword lexer and the external
+// scanner advance over while parsing. Unlike wall time the count is
+// deterministic, so it shows rescans exactly. Single-threaded.
+//
+// work_counter_total() also adds the tag stack entries the scanner compares
+// (tree_sitter_vue3_scanner_work), so the scanner must then be compiled with
+// TREE_SITTER_VUE3_SCANNER_WORK. Searching the whole tag stack on every tag
+// costs no advances, so without it a deep stack looks free.
+
+const TSLanguage *tree_sitter_vue3(void);
+
+static uint64_t work_counter_advances;
+static void (*work_counter_original_advance)(TSLexer *, bool);
+
+static inline void work_counter_advance(TSLexer *lexer, bool skip) {
+  work_counter_advances++;
+  work_counter_original_advance(lexer, skip);
+}
+
+static inline void work_counter_reset(void) {
+  work_counter_advances = 0;
+  tree_sitter_vue3_scanner_work = 0;
+}
+
+// Advances plus tag stack entries visited since the last reset.
+static inline uint64_t work_counter_total(void) {
+  return work_counter_advances + tree_sitter_vue3_scanner_work;
+}
+
+// The parser hands every callback the same lexer, so swapping `advance` for
+// the duration of the call counts exactly the characters that callback reads.
+#define WORK_COUNTER_WRAP(lexer, call)                  \
+  do {                                                  \
+    work_counter_original_advance = (lexer)->advance;   \
+    (lexer)->advance = work_counter_advance;            \
+    result = (call);                                    \
+    (lexer)->advance = work_counter_original_advance;   \
+  } while (0)
+
+static inline bool work_counter_lex(TSLexer *lexer, TSStateId state) {
+  bool result;
+  WORK_COUNTER_WRAP(lexer, tree_sitter_vue3()->lex_fn(lexer, state));
+  return result;
+}
+
+static inline bool work_counter_keyword_lex(TSLexer *lexer, TSStateId state) {
+  bool result;
+  WORK_COUNTER_WRAP(lexer, tree_sitter_vue3()->keyword_lex_fn(lexer, state));
+  return result;
+}
+
+static inline bool work_counter_scan(void *payload, TSLexer *lexer, const bool *valid_symbols) {
+  bool result;
+  WORK_COUNTER_WRAP(lexer, tree_sitter_vue3()->external_scanner.scan(payload, lexer, valid_symbols));
+  return result;
+}
+
+// Returns tree_sitter_vue3() with its lexing callbacks wrapped. Parses with
+// this language add to `work_counter_advances`.
+static inline const TSLanguage *work_counter_language(void) {
+  static TSLanguage language;
+  static bool initialized = false;
+  if (!initialized) {
+    language = *tree_sitter_vue3();
+    language.lex_fn = work_counter_lex;
+    if (language.keyword_lex_fn) language.keyword_lex_fn = work_counter_keyword_lex;
+    language.external_scanner.scan = work_counter_scan;
+    initialized = true;
+  }
+  return &language;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
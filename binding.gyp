@@ -1,19 +1,85 @@
 {
+  "variables": {
+    # The tree-sitter runtime node-tree-sitter ships. The addon only takes its
+    # headers: bindings/node/index.js loads node-tree-sitter's binding with
+    # RTLD_GLOBAL first, and the addon's ts_* calls resolve to that copy, so
+    # its parsers and trees come from the same runtime as node-tree-sitter's.
+    "tree_sitter_lib": "<!(node -p \"require('path').join(require('path').dirname(require.resolve('tree-sitter/package.json')), 'vendor', 'tree-sitter', 'lib')\")",
+  },
   "targets": [
     {
-      "target_name": "tree_sitter_YOUR_LANGUAGE_NAME_binding",
+      "target_name": "tree_sitter_vue3_binding",
+      "dependencies": [
+        "<!(node -p \"require('node-addon-api').targets\"):node_addon_api",
+      ],
       "include_dirs": [
-        "<!(node -e \"require('nan')\")",
-        "src"
+        "src",
+        "<(tree_sitter_lib)/include",
       ],
       "sources": [
         "bindings/node/binding.cc",
+        "bindings/node/extract.cc",
+        "bindings/node/flat_tree.cc",
+        "bindings/node/parse_async.cc",
+        "bindings/node/parse_many.cc",
+        "bindings/node/tree.cc",
         "src/parser.c",
-        # If your language uses an external scanner, add it here.
+        "src/scanner.c",
+      ],
+      "defines": [
+        "_POSIX_C_SOURCE=200112L",
+        "_DEFAULT_SOURCE",
       ],
       "cflags_c": [
-        "-std=c99",
-      ]
+        "-std=c11",
+      ],
+      "configurations": {
+        "Release": {
+          "cflags": [
+            "-O3",
+            "-flto",
+          ],
+          "ldflags": [
+            "-flto",
+          ],
+          "xcode_settings": {
+            "GCC_OPTIMIZATION_LEVEL": "3",
+            "LLVM_LTO": "YES",
+          },
+          "msvs_settings": {
+            "VCCLCompilerTool": {
+              "Optimization": 2,
+              "WholeProgramOptimization": "true",
+            },
+            "VCLinkerTool": {
+              "LinkTimeCodeGeneration": 1,
+            },
+          },
+        },
+      },
+      "conditions": [
+        # Linux links shared objects with undefined symbols by default; macOS
+        # has to be told to look them up at load time.
+        ["OS=='mac'", {
+          "xcode_settings": {
+            "GCC_C_LANGUAGE_STANDARD": "c11",
+            "OTHER_LDFLAGS": [
+              "-undefined",
+              "dynamic_lookup",
+            ],
+          },
+        }],
+        # A DLL cannot import from another addon that was not built as a
+        # library, so on Windows the addon keeps a runtime of its own.
+        ["OS=='win'", {
+          "include_dirs": [
+            "<(tree_sitter_lib)/src",
+          ],
+          "sources": [
+            "<(tree_sitter_lib)/src/lib.c",
+          ],
+        }],
+      ],
     }
   ]
 }
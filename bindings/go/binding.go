@@ -0,0 +1,15 @@
+package tree_sitter_vue
+
+// #cgo CFLAGS: -std=c11 -fPIC -I${SRCDIR}/../../src
+// #cgo CFLAGS: -Wno-unused-parameter -Wno-unused-but-set-variable -Wno-trigraphs
+// #include "../../src/parser.c"
+// #include "../../src/scanner.c"
+import "C"
+
+import "unsafe"
+
+// Language returns the tree-sitter Language for this grammar, for use with
+// a Go binding of the tree-sitter runtime.
+func Language() unsafe.Pointer {
+	return unsafe.Pointer(C.tree_sitter_vue3())
+}
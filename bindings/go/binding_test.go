@@ -0,0 +1,189 @@
+package tree_sitter_vue_test
+
+import (
+	"bytes"
+	"fmt"
+	"os"
+	"reflect"
+	"runtime"
+	"sync"
+	"testing"
+
+	tree_sitter_vue "github.com/xiaoxin-sky/tree-sitter-vue/bindings/go"
+)
+
+// Checks that every node but the root is reached exactly once through the
+// FirstChild and NextSibling links, from a parent that precedes it.
+func checkLinks(t *testing.T, tree tree_sitter_vue.FlatTree) {
+	t.Helper()
+	reached := 1
+	for i := range tree.Nodes {
+		parent := &tree.Nodes[i]
+		for child := parent.FirstChild; child != tree_sitter_vue.None; child = tree.Nodes[child].NextSibling {
+			node := &tree.Nodes[child]
+			if child <= uint32(i) || node.Parent != uint32(i) {
+				t.Fatalf("node %d is linked from %d but has parent %d", child, i, node.Parent)
+			}
+			if node.StartByte < parent.StartByte || node.EndByte > parent.EndByte {
+				t.Fatalf("node %d is outside its parent %d", child, i)
+			}
+			reached++
+		}
+	}
+	if reached != len(tree.Nodes) {
+		t.Fatalf("reached %d of %d nodes", reached, len(tree.Nodes))
+	}
+}
+
+func contains(kinds []string, kind string) bool {
+	for _, k := range kinds {
+		if k == kind {
+			return true
+		}
+	}
+	return false
+}
+
+func TestParse(t *testing.T) {
+	source := []byte(`<template><div v-if="ok">{{ message }}</div></template>`)
+	tree, err := tree_sitter_vue.Parse(source)
+	if err != nil {
+		t.Fatal(err)
+	}
+	root := tree.Nodes[0]
+	if name := tree_sitter_vue.KindName(root.Kind); name != "component" {
+		t.Errorf("root is %q", name)
+	}
+	if root.Parent != tree_sitter_vue.None || root.EndByte != uint32(len(source)) {
+		t.Errorf("root is %+v", root)
+	}
+	if tree.HasError() {
+		t.Error("tree has errors")
+	}
+	checkLinks(t, tree)
+
+	var kinds []string
+	for i := range tree.Nodes {
+		if tree.Nodes[i].IsNamed() {
+			kinds = append(kinds, tree_sitter_vue.KindName(tree.Nodes[i].Kind))
+		}
+	}
+	if kinds[1] != "template_element" || !contains(kinds, "interpolation") {
+		t.Errorf("named nodes are %v", kinds)
+	}
+}
+
+func TestParseBatch(t *testing.T) {
+	app, err := os.ReadFile("../../test/app.vue")
+	if err != nil {
+		t.Fatal(err)
+	}
+	sources := [][]byte{app, nil, []byte("<template><div></template>"), component(10)}
+	trees, err := tree_sitter_vue.ParseBatch(sources)
+	if err != nil {
+		t.Fatal(err)
+	}
+	for i, source := range sources {
+		tree, err := tree_sitter_vue.Parse(source)
+		if err != nil {
+			t.Fatal(err)
+		}
+		if !reflect.DeepEqual(trees[i].Nodes, tree.Nodes) {
+			t.Errorf("source %d differs when parsed on its own", i)
+		}
+		checkLinks(t, trees[i])
+	}
+}
+
+// Goroutines share the parser pool; each must get the tree it would get on
+// its own, including from parsers that have already parsed other sources.
+func TestParseConcurrent(t *testing.T) {
+	sources := [][]byte{component(1), component(50), []byte("<template><div></template>"), nil}
+	want := make([]tree_sitter_vue.FlatTree, len(sources))
+	for i, source := range sources {
+		tree, err := tree_sitter_vue.Parse(source)
+		if err != nil {
+			t.Fatal(err)
+		}
+		want[i] = tree
+	}
+
+	var wg sync.WaitGroup
+	errs := make(chan error, 4*runtime.GOMAXPROCS(0))
+	for g := 0; g < cap(errs); g++ {
+		wg.Add(1)
+		go func(g int) {
+			defer wg.Done()
+			for round := 0; round < 20; round++ {
+				i := (g + round) % len(sources)
+				tree, err := tree_sitter_vue.Parse(sources[i])
+				if err == nil && !reflect.DeepEqual(tree.Nodes, want[i].Nodes) {
+					err = fmt.Errorf("source %d differs in goroutine %d", i, g)
+				}
+				if err != nil {
+					errs <- err
+					return
+				}
+			}
+		}(g)
+	}
+	wg.Wait()
+	close(errs)
+	for err := range errs {
+		t.Error(err)
+	}
+}
+
+func component(elements int) []byte {
+	var b bytes.Buffer
+	b.WriteString("<template>\n")
+	for i := 0; i < elements; i++ {
+		b.WriteString("  <div :class=\"{ active }\" @click=\"toggle\">{{ message }}</div>\n")
+	}
+	b.WriteString("</template>\n")
+	return b.Bytes()
+}
+
+// The cgo-calls/file metric stays the same whatever the node count.
+func BenchmarkParse(b *testing.B) {
+	for _, elements := range []int{1, 10, 100, 1000} {
+		source := component(elements)
+		b.Run(fmt.Sprintf("elements=%d", elements), func(b *testing.B) {
+			var nodes int
+			b.SetBytes(int64(len(source)))
+			calls := runtime.NumCgoCall()
+			for i := 0; i < b.N; i++ {
+				tree, err := tree_sitter_vue.Parse(source)
+				if err != nil {
+					b.Fatal(err)
+				}
+				nodes = len(tree.Nodes)
+			}
+			b.ReportMetric(float64(runtime.NumCgoCall()-calls)/float64(b.N), "cgo-calls/file")
+			b.ReportMetric(float64(nodes), "nodes/file")
+		})
+	}
+}
+
+// A batch makes the same calls as a single file, so cgo-calls/file falls
+// as the batch grows.
+func BenchmarkParseBatch(b *testing.B) {
+	for _, files := range []int{1, 16, 256} {
+		sources := make([][]byte, files)
+		size := 0
+		for i := range sources {
+			sources[i] = component(100)
+			size += len(sources[i])
+		}
+		b.Run(fmt.Sprintf("files=%d", files), func(b *testing.B) {
+			b.SetBytes(int64(size))
+			calls := runtime.NumCgoCall()
+			for i := 0; i < b.N; i++ {
+				if _, err := tree_sitter_vue.ParseBatch(sources); err != nil {
+					b.Fatal(err)
+				}
+			}
+			b.ReportMetric(float64(runtime.NumCgoCall()-calls)/float64(b.N*files), "cgo-calls/file")
+		})
+	}
+}
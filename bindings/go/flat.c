@@ -0,0 +1,122 @@
+#include "flat.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+// parser.c is generated by tree-sitter-cli 0.20.7 for language version 14,
+// so the runtime has to be 0.20.7 or later. Older runtimes would only fail at
+// run time, when ts_parser_set_language rejects the language.
+#if !defined(TREE_SITTER_LANGUAGE_VERSION) || TREE_SITTER_LANGUAGE_VERSION < 14
+#error "the Go binding needs libtree-sitter 0.20.7 or later, which loads language version 14"
+#endif
+
+const TSLanguage *tree_sitter_vue3(void);
+
+static void write_node(TSVueFlatNode *flat, TSNode node, uint32_t parent) {
+  uint16_t flags = 0;
+  if (ts_node_is_named(node)) flags |= TS_VUE_FLAT_NAMED;
+  if (ts_node_is_extra(node)) flags |= TS_VUE_FLAT_EXTRA;
+  if (ts_node_is_missing(node)) flags |= TS_VUE_FLAT_MISSING;
+  if (ts_node_has_error(node)) flags |= TS_VUE_FLAT_HAS_ERROR;
+  flat->symbol = ts_node_symbol(node);
+  flat->flags = flags;
+  flat->start_byte = ts_node_start_byte(node);
+  flat->end_byte = ts_node_end_byte(node);
+  flat->parent = parent;
+  flat->first_child = TS_VUE_FLAT_NONE;
+  flat->next_sibling = TS_VUE_FLAT_NONE;
+}
+
+// The batch's node table, which grows as trees are flattened into it.
+typedef struct {
+  TSVueFlatNode *nodes;
+  size_t length;
+  size_t capacity;
+} Table;
+
+// Appends a node and returns false if memory runs out. Indices must stay
+// below TS_VUE_FLAT_NONE.
+static bool push_node(Table *table, TSNode node, uint32_t parent) {
+  if (table->length == table->capacity) {
+    if (table->capacity >= TS_VUE_FLAT_NONE) return false;
+    size_t new_capacity = table->capacity ? table->capacity * 2 : 256;
+    if (new_capacity > TS_VUE_FLAT_NONE) new_capacity = TS_VUE_FLAT_NONE;
+    TSVueFlatNode *new_nodes = realloc(table->nodes, new_capacity * sizeof(TSVueFlatNode));
+    if (!new_nodes) return false;
+    table->nodes = new_nodes;
+    table->capacity = new_capacity;
+  }
+  write_node(&table->nodes[table->length++], node, parent);
+  return true;
+}
+
+// Appends the tree's nodes in the order the cursor visits them. The links
+// are relative to the tree's first node. The parent links are written first,
+// so climbing back up needs no stack.
+static bool flatten(const TSTree *tree, Table *table) {
+  TSTreeCursor cursor = ts_tree_cursor_new(ts_tree_root_node(tree));
+  size_t first = table->length;
+  uint32_t current = 0;
+  bool ok = push_node(table, ts_tree_cursor_current_node(&cursor), TS_VUE_FLAT_NONE);
+  while (ok) {
+    if (ts_tree_cursor_goto_first_child(&cursor)) {
+      uint32_t child = (uint32_t)(table->length - first);
+      ok = push_node(table, ts_tree_cursor_current_node(&cursor), current);
+      if (ok) table->nodes[first + current].first_child = child;
+      current = child;
+      continue;
+    }
+    const TSVueFlatNode *nodes = table->nodes + first;
+    while (!ts_tree_cursor_goto_next_sibling(&cursor)) {
+      if (!ts_tree_cursor_goto_parent(&cursor)) {
+        ts_tree_cursor_delete(&cursor);
+        return true;
+      }
+      current = nodes[current].parent;
+    }
+    uint32_t sibling = (uint32_t)(table->length - first);
+    ok = push_node(table, ts_tree_cursor_current_node(&cursor), nodes[current].parent);
+    if (ok) table->nodes[first + current].next_sibling = sibling;
+    current = sibling;
+  }
+  ts_tree_cursor_delete(&cursor);
+  return false;
+}
+
+TSParser *ts_vue_flat_parser_new(void) {
+  TSParser *parser = ts_parser_new();
+  ts_parser_set_language(parser, tree_sitter_vue3());
+  return parser;
+}
+
+TSVueFlatNode *ts_vue_flat_parse(TSParser *parser, const char *sources, const uint32_t *ends, uint32_t count,
+                                 TSVueFlatTree *trees, uint32_t *node_count) {
+  Table table = {NULL, 0, 0};
+  uint32_t start = 0;
+  for (uint32_t i = 0; i < count; i++) {
+    TSTree *tree = ts_parser_parse_string(parser, NULL, sources + start, ends[i] - start);
+    if (!tree) {
+      ts_parser_reset(parser);
+      goto fail;
+    }
+    size_t first = table.length;
+    bool ok = flatten(tree, &table);
+    ts_tree_delete(tree);
+    if (!ok) goto fail;
+    trees[i].first_node = (uint32_t)first;
+    trees[i].node_count = (uint32_t)(table.length - first);
+    start = ends[i];
+  }
+  *node_count = (uint32_t)table.length;
+  // Keep the result non-NULL for an empty batch.
+  return table.nodes ? table.nodes : malloc(1);
+
+fail:
+  free(table.nodes);
+  return NULL;
+}
+
+void ts_vue_flat_move(TSVueFlatNode *table, TSVueFlatNode *nodes, uint32_t node_count) {
+  if (node_count > 0) memcpy(nodes, table, node_count * sizeof(TSVueFlatNode));
+  free(table);
+}
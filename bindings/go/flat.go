@@ -0,0 +1,189 @@
+package tree_sitter_vue
+
+// #cgo pkg-config: tree-sitter
+// #include <tree_sitter/api.h>
+// #include "flat.h"
+//
+// const TSLanguage *tree_sitter_vue3(void);
+import "C"
+
+import (
+	"errors"
+	"math"
+	"runtime"
+	"sync"
+	"unsafe"
+)
+
+// None marks a missing Parent, FirstChild or NextSibling.
+const None = ^uint32(0)
+
+// ErrorKind is the Kind of ERROR nodes.
+const ErrorKind = ^uint16(0)
+
+type NodeFlags uint16
+
+const (
+	Named NodeFlags = 1 << iota
+	Extra
+	Missing
+	HasError
+)
+
+// Node is one node of a FlatTree. Parent, FirstChild and NextSibling are
+// indices into the same tree's Nodes, or None.
+type Node struct {
+	// The node's symbol; KindName gives its name.
+	Kind        uint16
+	Flags       NodeFlags
+	StartByte   uint32
+	EndByte     uint32
+	Parent      uint32
+	FirstChild  uint32
+	NextSibling uint32
+}
+
+func (n *Node) IsNamed() bool   { return n.Flags&Named != 0 }
+func (n *Node) IsExtra() bool   { return n.Flags&Extra != 0 }
+func (n *Node) IsMissing() bool { return n.Flags&Missing != 0 }
+func (n *Node) HasError() bool  { return n.Flags&HasError != 0 }
+
+// FlatTree is a syntax tree flattened into a slice in pre-order, so the
+// root is Nodes[0] and a node's descendants directly follow it. Anonymous
+// nodes are included, as a TreeCursor visits them. Walking it makes no cgo
+// calls.
+type FlatTree struct {
+	Nodes []Node
+}
+
+// HasError reports whether the tree has syntax errors anywhere.
+func (t FlatTree) HasError() bool {
+	return t.Nodes[0].HasError()
+}
+
+// ErrParse is returned if the parser fails, which only happens when it runs
+// out of memory.
+var ErrParse = errors.New("tree_sitter_vue: parse failed")
+
+// Parse parses source and flattens its tree with a single cgo call (and a
+// second one to hand over the nodes), however big the tree is.
+func Parse(source []byte) (FlatTree, error) {
+	if uint64(len(source)) > math.MaxUint32 {
+		return FlatTree{}, ErrParse
+	}
+	trees, err := parse(source, []uint32{uint32(len(source))})
+	if err != nil {
+		return FlatTree{}, err
+	}
+	return trees[0], nil
+}
+
+// ParseBatch parses and flattens every source with one parser, making the
+// same two cgo calls as Parse for the whole batch. The trees share one
+// backing array. It is safe to call ParseBatch from several goroutines at
+// once; each call takes its own parser from the pool.
+func ParseBatch(sources [][]byte) ([]FlatTree, error) {
+	if len(sources) == 0 {
+		return nil, nil
+	}
+	total := 0
+	for _, source := range sources {
+		total += len(source)
+	}
+	if uint64(total) > math.MaxUint32 {
+		return nil, ErrParse
+	}
+	// The C side cannot hold on to Go pointers, so the sources are passed
+	// as one buffer.
+	buffer := make([]byte, 0, total)
+	ends := make([]uint32, len(sources))
+	for i, source := range sources {
+		buffer = append(buffer, source...)
+		ends[i] = uint32(len(buffer))
+	}
+	return parse(buffer, ends)
+}
+
+// parsers holds idle parsers, up to one per P, so that a call only creates a
+// parser, with a third cgo call, when every pooled one is in use. It is a
+// channel rather than a sync.Pool because a sync.Pool drops items without a
+// chance to free their C memory.
+var parsers = make(chan *C.TSParser, runtime.GOMAXPROCS(0))
+
+func getParser() *C.TSParser {
+	select {
+	case parser := <-parsers:
+		return parser
+	default:
+		return C.ts_vue_flat_parser_new()
+	}
+}
+
+func putParser(parser *C.TSParser) {
+	select {
+	case parsers <- parser:
+	default:
+		C.ts_parser_delete(parser)
+	}
+}
+
+func parse(buffer []byte, ends []uint32) ([]FlatTree, error) {
+	if len(buffer) == 0 {
+		buffer = []byte{0}
+	}
+	trees := make([]C.TSVueFlatTree, len(ends))
+	var nodeCount C.uint32_t
+	parser := getParser()
+	defer putParser(parser)
+	table := C.ts_vue_flat_parse(
+		parser,
+		(*C.char)(unsafe.Pointer(&buffer[0])),
+		(*C.uint32_t)(unsafe.Pointer(&ends[0])),
+		C.uint32_t(len(ends)),
+		&trees[0],
+		&nodeCount,
+	)
+	if table == nil {
+		return nil, ErrParse
+	}
+	nodes := make([]Node, nodeCount)
+	// Every tree has a root, so nodes is never empty.
+	C.ts_vue_flat_move(table, (*C.TSVueFlatNode)(unsafe.Pointer(&nodes[0])), nodeCount)
+
+	result := make([]FlatTree, len(trees))
+	for i, tree := range trees {
+		first, end := uint32(tree.first_node), uint32(tree.first_node+tree.node_count)
+		result[i].Nodes = nodes[first:end:end]
+	}
+	return result, nil
+}
+
+var kindNames struct {
+	once  sync.Once
+	names []string
+}
+
+// KindName returns the name of the node kind, such as "element" or "<".
+func KindName(kind uint16) string {
+	if kind == ErrorKind {
+		return "ERROR"
+	}
+	kindNames.once.Do(func() {
+		language := C.tree_sitter_vue3()
+		names := make([]string, C.ts_language_symbol_count(language))
+		for i := range names {
+			names[i] = C.GoString(C.ts_language_symbol_name(language, C.TSSymbol(i)))
+		}
+		kindNames.names = names
+	})
+	if int(kind) >= len(kindNames.names) {
+		return ""
+	}
+	return kindNames.names[kind]
+}
+
+func init() {
+	if unsafe.Sizeof(Node{}) != unsafe.Sizeof(C.TSVueFlatNode{}) {
+		panic("tree_sitter_vue: Node does not match TSVueFlatNode")
+	}
+}
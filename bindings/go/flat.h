@@ -0,0 +1,56 @@
+#ifndef TREE_SITTER_VUE3_GO_FLAT_H_
+#define TREE_SITTER_VUE3_GO_FLAT_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <tree_sitter/api.h>
+
+// A node of a flattened tree. Trees are flattened in pre-order, so the root
+// is node 0, and the links are indices into the same tree's nodes, or
+// TS_VUE_FLAT_NONE. Anonymous nodes are included, as a TreeCursor visits
+// them. flat.go's Node has the same layout.
+typedef struct {
+  uint16_t symbol;
+  uint16_t flags;
+  uint32_t start_byte;
+  uint32_t end_byte;
+  uint32_t parent;
+  uint32_t first_child;
+  uint32_t next_sibling;
+} TSVueFlatNode;
+
+#define TS_VUE_FLAT_NONE UINT32_MAX
+
+enum {
+  TS_VUE_FLAT_NAMED = 1 << 0,
+  TS_VUE_FLAT_EXTRA = 1 << 1,
+  TS_VUE_FLAT_MISSING = 1 << 2,
+  TS_VUE_FLAT_HAS_ERROR = 1 << 3,
+};
+
+// Where one source's nodes are in the batch's node table.
+typedef struct {
+  uint32_t first_node;
+  uint32_t node_count;
+} TSVueFlatTree;
+
+// A parser for ts_vue_flat_parse, which the caller frees with
+// ts_parser_delete().
+TSParser *ts_vue_flat_parser_new(void);
+
+// Parses `count` sources with `parser` and flattens their trees one after the
+// other into a single node table, which grows as it is filled. The sources
+// are consecutive in `sources`; source i ends at byte `ends[i]`. Fills in
+// `trees`, which has `count` entries, and `*node_count`, and returns the
+// table, which ts_vue_flat_move() must be given. Returns NULL if a parse
+// fails or memory runs out; `parser` is reset and can be used again.
+//
+// This is the only call needed per batch besides ts_vue_flat_move(), so the
+// number of cgo calls does not grow with the size of the trees.
+TSVueFlatNode *ts_vue_flat_parse(TSParser *parser, const char *sources, const uint32_t *ends, uint32_t count,
+                                 TSVueFlatTree *trees, uint32_t *node_count);
+
+// Copies the `node_count` nodes of `table` to `nodes` and frees `table`.
+void ts_vue_flat_move(TSVueFlatNode *table, TSVueFlatNode *nodes, uint32_t node_count);
+
+#endif  // TREE_SITTER_VUE3_GO_FLAT_H_
@@ -1,28 +1,48 @@
-#include "tree_sitter/parser.h"
-#include <node.h>
-#include "nan.h"
+#include <napi.h>
 
-using namespace v8;
+#include "binding.h"
+#include "tree.h"
 
-extern "C" TSLanguage * tree_sitter_YOUR_LANGUAGE_NAME();
+using namespace tree_sitter_vue3_node;
 
 namespace {
 
-NAN_METHOD(New) {}
-
-void Init(Local<Object> exports, Local<Object> module) {
-  Local<FunctionTemplate> tpl = Nan::New<FunctionTemplate>(New);
-  tpl->SetClassName(Nan::New("Language").ToLocalChecked());
-  tpl->InstanceTemplate()->SetInternalFieldCount(1);
+// The tag node-tree-sitter checks before it accepts an External as a language.
+const napi_type_tag LANGUAGE_TYPE_TAG = {0x8AF2E5212AD58ABF, 0xD5006CAD83ABBA16};
+
+// Type names by symbol, for flat trees, which store symbols.
+Napi::Array SymbolNames(Napi::Env env) {
+  const TSLanguage *language = tree_sitter_vue3();
+  uint32_t count = ts_language_symbol_count(language);
+  Napi::Array names = Napi::Array::New(env, count);
+  for (uint32_t i = 0; i < count; i++) {
+    names[i] = Napi::String::New(env, ts_language_symbol_name(language, static_cast<TSSymbol>(i)));
+  }
+  return names;
+}
 
-  Local<Function> constructor = Nan::GetFunction(tpl).ToLocalChecked();
-  Local<Object> instance = constructor->NewInstance(Nan::GetCurrentContext()).ToLocalChecked();
-  Nan::SetInternalFieldPointer(instance, 0, tree_sitter_YOUR_LANGUAGE_NAME());
+}  // namespace
 
-  Nan::Set(instance, Nan::New("name").ToLocalChecked(), Nan::New("YOUR_LANGUAGE_NAME").ToLocalChecked());
-  Nan::Set(module, Nan::New("exports").ToLocalChecked(), instance);
+// NODE_API_MODULE registers a context-aware module: Init runs once for the
+// main thread and once for every worker_threads Worker that loads the addon.
+// The language is static and read-only, so every environment can share it;
+// anything else lives in the environment's AddonData.
+static Napi::Object Init(Napi::Env env, Napi::Object exports) {
+  auto *data = new AddonData();
+  Napi::Function tree_constructor = Tree::Define(env);
+  data->tree_constructor = Napi::Persistent(tree_constructor);
+  env.SetInstanceData(data);
+
+  exports["name"] = Napi::String::New(env, "vue3");
+  auto language = Napi::External<TSLanguage>::New(env, const_cast<TSLanguage *>(tree_sitter_vue3()));
+  language.TypeTag(&LANGUAGE_TYPE_TAG);
+  exports["language"] = language;
+  exports["Tree"] = tree_constructor;
+  exports["symbolNames"] = SymbolNames(env);
+  exports["parseHandleAsync"] = Napi::Function::New<ParseAsync>(env, "parseHandleAsync");
+  exports["parseMany"] = Napi::Function::New<ParseMany>(env, "parseMany");
+  exports["RecordKind"] = RecordKinds(env);
+  return exports;
 }
 
-NODE_MODULE(tree_sitter_YOUR_LANGUAGE_NAME_binding, Init)
-
-}  // namespace
+NODE_API_MODULE(tree_sitter_vue3_binding, Init)
@@ -0,0 +1,32 @@
+#ifndef TREE_SITTER_VUE3_NODE_BINDING_H_
+#define TREE_SITTER_VUE3_NODE_BINDING_H_
+
+#include <napi.h>
+#include <tree_sitter/api.h>
+
+extern "C" const TSLanguage *tree_sitter_vue3();
+
+namespace tree_sitter_vue3_node {
+
+// State for one environment: the main thread or one worker_threads Worker.
+// Stored with Napi::Env::SetInstanceData, never in globals.
+struct AddonData {
+  Napi::FunctionReference tree_constructor;
+};
+
+inline AddonData *GetAddonData(Napi::Env env) {
+  return env.GetInstanceData<AddonData>();
+}
+
+// parseHandleAsync(source, oldTree?) → Promise<Tree> with a cancel() method.
+Napi::Value ParseAsync(const Napi::CallbackInfo &info);
+
+// parseMany(files, {extract, threads}?) → Promise of one result per file.
+Napi::Value ParseMany(const Napi::CallbackInfo &info);
+
+// The RecordKind constants of parseMany's records, by name.
+Napi::Object RecordKinds(Napi::Env env);
+
+}  // namespace tree_sitter_vue3_node
+
+#endif  // TREE_SITTER_VUE3_NODE_BINDING_H_
@@ -0,0 +1,218 @@
+#include "extract.h"
+
+#include <cctype>
+#include <cstring>
+
+#include "tree_sitter_html/tag.h"
+
+extern "C" const TSLanguage *tree_sitter_vue3();
+
+namespace tree_sitter_vue3_node {
+
+namespace {
+
+struct Symbols {
+  TSSymbol template_element;
+  TSSymbol script_element;
+  TSSymbol style_element;
+  TSSymbol element;
+  TSSymbol start_tag;
+  TSSymbol self_closing_tag;
+  TSSymbol end_tag;
+  TSSymbol raw_text;
+  TSSymbol directive_attribute;
+  TSSymbol quoted_attribute_value;
+  TSSymbol attribute_value;
+  TSSymbol interpolation;
+  TSSymbol equals;
+
+  Symbols() {
+    const TSLanguage *language = tree_sitter_vue3();
+    auto named = [language](const char *name) {
+      return ts_language_symbol_for_name(language, name, static_cast<uint32_t>(strlen(name)), true);
+    };
+    template_element = named("template_element");
+    script_element = named("script_element");
+    style_element = named("style_element");
+    element = named("element");
+    start_tag = named("start_tag");
+    self_closing_tag = named("self_closing_tag");
+    end_tag = named("end_tag");
+    raw_text = named("raw_text");
+    directive_attribute = named("directive_attribute");
+    quoted_attribute_value = named("quoted_attribute_value");
+    attribute_value = named("attribute_value");
+    interpolation = named("interpolation");
+    equals = ts_language_symbol_for_name(language, "=", 1, false);
+  }
+};
+
+// Initialized once, thread-safely, on first use.
+const Symbols &GetSymbols() {
+  static const Symbols symbols;
+  return symbols;
+}
+
+void Push(std::vector<uint32_t> *records, RecordKind kind, uint32_t start, uint32_t end, uint32_t inner_start,
+          uint32_t inner_end) {
+  records->insert(records->end(), {kind, start, end, inner_start, inner_end});
+}
+
+// The content of an element or block: between its start tag and its end tag,
+// or its raw text for <script> and <style>.
+void Inner(const Symbols &symbols, TSNode node, uint32_t *start, uint32_t *end) {
+  uint32_t count = ts_node_child_count(node);
+  *start = *end = ts_node_end_byte(node);
+  if (count == 0) return;
+  TSNode first = ts_node_child(node, 0);
+  TSNode last = ts_node_child(node, count - 1);
+  *start = ts_node_symbol(first) == symbols.start_tag ? ts_node_end_byte(first) : ts_node_start_byte(first);
+  *end = ts_node_symbol(last) == symbols.end_tag ? ts_node_start_byte(last) : ts_node_end_byte(last);
+  if (*end < *start) *end = *start;
+  for (uint32_t i = 0; i < count; i++) {
+    TSNode child = ts_node_child(node, i);
+    if (ts_node_symbol(child) == symbols.raw_text) {
+      *start = ts_node_start_byte(child);
+      *end = ts_node_end_byte(child);
+      break;
+    }
+  }
+}
+
+enum class TagKind { kHtml, kComponent, kSvg };
+
+// Classifies an element by its tag name: HTML tags are the ones the external
+// scanner knows, everything else is a component. Returns false if `node` has
+// no tag name.
+bool ClassifyTag(TSNode node, const char *source, TagKind *kind, TSNode *tag_name) {
+  if (ts_node_child_count(node) == 0) return false;
+  TSNode tag = ts_node_child(node, 0);
+  if (ts_node_named_child_count(tag) == 0) return false;
+  *tag_name = ts_node_named_child(tag, 0);
+
+  uint32_t start = ts_node_start_byte(*tag_name);
+  uint32_t length = ts_node_end_byte(*tag_name) - start;
+  if (length == 0 || length > TREE_SITTER_HTML_MAX_CUSTOM_TAG_NAME_LENGTH) {
+    *kind = TagKind::kComponent;
+    return true;
+  }
+  char name[TREE_SITTER_HTML_MAX_CUSTOM_TAG_NAME_LENGTH + 1];
+  for (uint32_t i = 0; i < length; i++) {
+    name[i] = static_cast<char>(toupper(static_cast<unsigned char>(source[start + i])));
+  }
+  name[length] = '\0';
+  if (strcmp(name, "SVG") == 0) {
+    *kind = TagKind::kSvg;
+  } else {
+    *kind = tag_for_name(name).type == CUSTOM ? TagKind::kComponent : TagKind::kHtml;
+  }
+  return true;
+}
+
+void Directive(const Symbols &symbols, TSNode node, std::vector<uint32_t> *records) {
+  uint32_t start = ts_node_start_byte(node);
+  uint32_t name_end = start;
+  uint32_t value_start = ts_node_end_byte(node);
+  uint32_t value_end = value_start;
+  uint32_t count = ts_node_child_count(node);
+  for (uint32_t i = 0; i < count; i++) {
+    TSNode child = ts_node_child(node, i);
+    TSSymbol symbol = ts_node_symbol(child);
+    if (symbol == symbols.equals) break;
+    name_end = ts_node_end_byte(child);
+  }
+  for (uint32_t i = 0; i < count; i++) {
+    TSNode child = ts_node_child(node, i);
+    TSSymbol symbol = ts_node_symbol(child);
+    if (symbol == symbols.quoted_attribute_value) {
+      // `""` has no attribute_value; its value is empty, after the quote.
+      value_start = value_end = ts_node_start_byte(child) + 1;
+      if (ts_node_named_child_count(child) > 0) {
+        TSNode value = ts_node_named_child(child, 0);
+        value_start = ts_node_start_byte(value);
+        value_end = ts_node_end_byte(value);
+      }
+    } else if (symbol == symbols.attribute_value) {
+      value_start = ts_node_start_byte(child);
+      value_end = ts_node_end_byte(child);
+    }
+  }
+  Push(records, RECORD_DIRECTIVE, start, name_end, value_start, value_end);
+}
+
+}  // namespace
+
+void ExtractRecords(const TSTree *tree, const char *source, uint32_t flags, std::vector<uint32_t> *records) {
+  const Symbols &symbols = GetSymbols();
+  TSTreeCursor cursor = ts_tree_cursor_new(ts_tree_root_node(tree));
+
+  // Iterative, since deeply nested templates would overflow the small stacks
+  // of threadpool threads. `outer_svg` holds `in_svg` for each ancestor level.
+  std::vector<bool> outer_svg;
+  bool in_svg = false;
+  for (;;) {
+    TSNode node = ts_tree_cursor_current_node(&cursor);
+    TSSymbol symbol = ts_node_symbol(node);
+    bool descend = true;
+    bool child_in_svg = in_svg;
+    uint32_t start = ts_node_start_byte(node);
+    uint32_t end = ts_node_end_byte(node);
+    uint32_t inner_start = 0;
+    uint32_t inner_end = 0;
+
+    if (outer_svg.size() == 1 && (symbol == symbols.template_element || symbol == symbols.script_element ||
+                                  symbol == symbols.style_element || symbol == symbols.element)) {
+      if (flags & EXTRACT_BLOCKS) {
+        RecordKind kind = symbol == symbols.template_element ? RECORD_TEMPLATE
+                          : symbol == symbols.script_element ? RECORD_SCRIPT
+                          : symbol == symbols.style_element  ? RECORD_STYLE
+                                                             : RECORD_CUSTOM_BLOCK;
+        Inner(symbols, node, &inner_start, &inner_end);
+        Push(records, kind, start, end, inner_start, inner_end);
+      }
+      // Custom blocks such as <i18n> hold data, not markup.
+      descend = symbol == symbols.template_element;
+    } else if (symbol == symbols.element) {
+      TagKind kind;
+      TSNode tag_name;
+      if (ClassifyTag(node, source, &kind, &tag_name)) {
+        if (kind == TagKind::kSvg) child_in_svg = true;
+        if (kind == TagKind::kComponent && !in_svg && (flags & EXTRACT_COMPONENTS)) {
+          Push(records, RECORD_COMPONENT, ts_node_start_byte(tag_name), ts_node_end_byte(tag_name), start, end);
+        }
+      }
+    } else if (symbol == symbols.directive_attribute) {
+      if (flags & EXTRACT_DIRECTIVES) Directive(symbols, node, records);
+      descend = false;
+    } else if (symbol == symbols.interpolation) {
+      if (flags & EXTRACT_INTERPOLATIONS) {
+        inner_start = inner_end = start + 2;
+        if (ts_node_named_child_count(node) > 0) {
+          TSNode expression = ts_node_named_child(node, 0);
+          inner_start = ts_node_start_byte(expression);
+          inner_end = ts_node_end_byte(expression);
+        }
+        Push(records, RECORD_INTERPOLATION, start, end, inner_start, inner_end);
+      }
+      descend = false;
+    } else if (symbol == symbols.end_tag || symbol == symbols.raw_text || !ts_node_is_named(node)) {
+      descend = false;
+    }
+
+    if (descend && ts_tree_cursor_goto_first_child(&cursor)) {
+      outer_svg.push_back(in_svg);
+      in_svg = child_in_svg;
+      continue;
+    }
+    while (!ts_tree_cursor_goto_next_sibling(&cursor)) {
+      if (!ts_tree_cursor_goto_parent(&cursor)) {
+        ts_tree_cursor_delete(&cursor);
+        return;
+      }
+      in_svg = outer_svg.back();
+      outer_svg.pop_back();
+    }
+  }
+}
+
+}  // namespace tree_sitter_vue3_node
@@ -0,0 +1,49 @@
+#ifndef TREE_SITTER_VUE3_NODE_EXTRACT_H_
+#define TREE_SITTER_VUE3_NODE_EXTRACT_H_
+
+#include <tree_sitter/api.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace tree_sitter_vue3_node {
+
+// parseMany returns each file as flat records of RECORD_STRIDE uint32s:
+// [kind, start, end, inner_start, inner_end], byte offsets into the UTF-8
+// source.
+//
+//   template, script, style and custom blocks: start/end span the whole
+//     top-level element; inner spans its content between the tags.
+//   component: start/end span the tag name; inner spans the element.
+//   directive: start/end span the name with its argument and modifiers
+//     (`v-if`, `:class`, `@click.stop`); inner spans the value inside the
+//     quotes, empty at `end` when there is none.
+//   interpolation: start/end span `{{ ... }}`; inner spans the expression.
+enum RecordKind : uint32_t {
+  RECORD_TEMPLATE = 1,
+  RECORD_SCRIPT = 2,
+  RECORD_STYLE = 3,
+  RECORD_CUSTOM_BLOCK = 4,
+  RECORD_COMPONENT = 5,
+  RECORD_DIRECTIVE = 6,
+  RECORD_INTERPOLATION = 7,
+};
+
+const uint32_t RECORD_STRIDE = 5;
+
+// What to extract, from parseMany's `extract` option.
+enum ExtractFlags : uint32_t {
+  EXTRACT_BLOCKS = 1 << 0,
+  EXTRACT_COMPONENTS = 1 << 1,
+  EXTRACT_DIRECTIVES = 1 << 2,
+  EXTRACT_INTERPOLATIONS = 1 << 3,
+  EXTRACT_ALL = EXTRACT_BLOCKS | EXTRACT_COMPONENTS | EXTRACT_DIRECTIVES | EXTRACT_INTERPOLATIONS,
+};
+
+// Appends the records of `tree` to `records`. Only reads the tree and the
+// source, so files can be extracted on any thread.
+void ExtractRecords(const TSTree *tree, const char *source, uint32_t flags, std::vector<uint32_t> *records);
+
+}  // namespace tree_sitter_vue3_node
+
+#endif  // TREE_SITTER_VUE3_NODE_EXTRACT_H_
@@ -0,0 +1,80 @@
+#include "flat_tree.h"
+
+#include <vector>
+
+namespace tree_sitter_vue3_node {
+
+namespace {
+
+enum Column { TYPE, FLAGS, START, END, PARENT, FIRST_CHILD, NEXT_SIBLING };
+
+}  // namespace
+
+size_t FlatTreeLength(const TSTree *tree) {
+  return FLAT_TREE_HEADER_LENGTH + size_t(FLAT_TREE_COLUMNS) * ts_node_descendant_count(ts_tree_root_node(tree));
+}
+
+bool WriteFlatTree(const TSTree *tree, uint32_t *words, size_t length) {
+  if (length < FlatTreeLength(tree)) return false;
+  uint32_t count = ts_node_descendant_count(ts_tree_root_node(tree));
+  uint32_t *columns[FLAT_TREE_COLUMNS];
+  for (uint32_t i = 0; i < FLAT_TREE_COLUMNS; i++) {
+    columns[i] = words + FLAT_TREE_HEADER_LENGTH + size_t(i) * count;
+  }
+
+  // Nodes are numbered in the order the cursor visits them. `ancestors`
+  // holds the index of each ancestor, `previous` the last child seen so far
+  // at each depth, so that its nextSibling can be filled in.
+  TSTreeCursor cursor = ts_tree_cursor_new(ts_tree_root_node(tree));
+  std::vector<uint32_t> ancestors;
+  std::vector<uint32_t> previous;
+  uint32_t index = 0;
+  bool done = false;
+  while (!done && index < count) {
+    TSNode node = ts_tree_cursor_current_node(&cursor);
+    uint32_t flags = 0;
+    if (ts_node_is_named(node)) flags |= FLAT_TREE_NAMED;
+    if (ts_node_is_extra(node)) flags |= FLAT_TREE_EXTRA;
+    if (ts_node_is_missing(node)) flags |= FLAT_TREE_MISSING;
+    if (ts_node_has_error(node)) flags |= FLAT_TREE_HAS_ERROR;
+    columns[TYPE][index] = ts_node_symbol(node);
+    columns[FLAGS][index] = flags;
+    columns[START][index] = ts_node_start_byte(node) / 2;
+    columns[END][index] = ts_node_end_byte(node) / 2;
+    columns[PARENT][index] = ancestors.empty() ? FLAT_TREE_NONE : ancestors.back();
+    columns[FIRST_CHILD][index] = FLAT_TREE_NONE;
+    columns[NEXT_SIBLING][index] = FLAT_TREE_NONE;
+    if (!previous.empty()) {
+      if (previous.back() == FLAT_TREE_NONE) {
+        columns[FIRST_CHILD][ancestors.back()] = index;
+      } else {
+        columns[NEXT_SIBLING][previous.back()] = index;
+      }
+      previous.back() = index;
+    }
+
+    if (ts_tree_cursor_goto_first_child(&cursor)) {
+      ancestors.push_back(index++);
+      previous.push_back(FLAT_TREE_NONE);
+      continue;
+    }
+    index++;
+    while (!ts_tree_cursor_goto_next_sibling(&cursor)) {
+      if (!ts_tree_cursor_goto_parent(&cursor)) {
+        done = true;
+        break;
+      }
+      ancestors.pop_back();
+      previous.pop_back();
+    }
+  }
+  ts_tree_cursor_delete(&cursor);
+
+  words[0] = FLAT_TREE_MAGIC;
+  words[1] = FLAT_TREE_VERSION;
+  words[2] = count;
+  words[3] = FLAT_TREE_COLUMNS;
+  return true;
+}
+
+}  // namespace tree_sitter_vue3_node
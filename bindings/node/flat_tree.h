@@ -0,0 +1,50 @@
+#ifndef TREE_SITTER_VUE3_NODE_FLAT_TREE_H_
+#define TREE_SITTER_VUE3_NODE_FLAT_TREE_H_
+
+#include <tree_sitter/api.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace tree_sitter_vue3_node {
+
+// A tree flattened into uint32 words, so that it can live in a
+// SharedArrayBuffer and be read by any worker_threads Worker without a copy.
+// flat_tree.js reads the same layout.
+//
+// The header is FLAT_TREE_HEADER_LENGTH words: FLAT_TREE_MAGIC,
+// FLAT_TREE_VERSION, the node count n and the column count. Then come the
+// columns, n words each, indexed by node in pre-order, so the root is 0:
+//
+//   type          the node's symbol, ts_node_symbol()
+//   flags         FlatTreeFlags
+//   startIndex    as in Tree, UTF-16 code units
+//   endIndex
+//   parent        FLAT_TREE_NONE for the root
+//   firstChild    FLAT_TREE_NONE for leaves
+//   nextSibling   FLAT_TREE_NONE for last children
+//
+// Anonymous nodes are included, as a TreeCursor visits them.
+const uint32_t FLAT_TREE_MAGIC = 0x33657576;  // "vue3"
+const uint32_t FLAT_TREE_VERSION = 1;
+const uint32_t FLAT_TREE_HEADER_LENGTH = 4;
+const uint32_t FLAT_TREE_COLUMNS = 7;
+const uint32_t FLAT_TREE_NONE = UINT32_MAX;
+
+enum FlatTreeFlags : uint32_t {
+  FLAT_TREE_NAMED = 1 << 0,
+  FLAT_TREE_EXTRA = 1 << 1,
+  FLAT_TREE_MISSING = 1 << 2,
+  FLAT_TREE_HAS_ERROR = 1 << 3,
+};
+
+// The number of words needed to flatten `tree`.
+size_t FlatTreeLength(const TSTree *tree);
+
+// Flattens `tree` into `words`, which holds `length` words. Returns false,
+// writing nothing meaningful, if `length` is too small.
+bool WriteFlatTree(const TSTree *tree, uint32_t *words, size_t length);
+
+}  // namespace tree_sitter_vue3_node
+
+#endif  // TREE_SITTER_VUE3_NODE_FLAT_TREE_H_
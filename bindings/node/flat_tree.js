@@ -0,0 +1,189 @@
+// Reads the flat tree layout that bindings/node/flat_tree.h describes. A
+// FlatTree is only a set of views of its buffer, so a SharedArrayBuffer can
+// be posted to any number of workers and walked there without a copy.
+
+const MAGIC = 0x33657576;
+const VERSION = 1;
+const HEADER_LENGTH = 4;
+const COLUMNS = 7;
+const NONE = 0xffffffff;
+const ERROR_SYMBOL = 0xffff;
+
+const NAMED = 1 << 0;
+const EXTRA = 1 << 1;
+const MISSING = 1 << 2;
+const HAS_ERROR = 1 << 3;
+
+// Flattens `tree` into a new SharedArrayBuffer. A handle from
+// parseHandleAsync is flattened natively in one call; a node-tree-sitter Tree
+// is walked from JavaScript with its TreeCursor.
+function flattenTree(tree) {
+  if (typeof tree.flattenInto !== "function") {
+    return flattenCursor(tree.walk(), nodeTreeSitterFlags, SharedArrayBuffer);
+  }
+  const buffer = new SharedArrayBuffer(tree.flatLength * Uint32Array.BYTES_PER_ELEMENT);
+  tree.flattenInto(new Uint32Array(buffer));
+  return buffer;
+}
+
+function nodeTreeSitterFlags(cursor) {
+  const node = cursor.currentNode;
+  return (
+    (cursor.nodeIsNamed ? NAMED : 0) |
+    (node.isExtra ? EXTRA : 0) |
+    (cursor.nodeIsMissing ? MISSING : 0) |
+    (node.hasError ? HAS_ERROR : 0)
+  );
+}
+
+// Writes the nodes `cursor` visits, starting at its current node, into a new
+// `Buffer` (SharedArrayBuffer or ArrayBuffer), numbered in pre-order like
+// WriteFlatTree. `flags(cursor)` gives the FlatTreeFlags of the current node.
+// Works with the TreeCursor of node-tree-sitter and of web-tree-sitter.
+function flattenCursor(cursor, flags, Buffer) {
+  const columns = Array.from({ length: COLUMNS }, () => []);
+  const [types, flagColumn, starts, ends, parents, firstChildren, nextSiblings] = columns;
+  const add = (parent) => {
+    types.push(cursor.nodeTypeId);
+    flagColumn.push(flags(cursor));
+    starts.push(cursor.startIndex);
+    ends.push(cursor.endIndex);
+    parents.push(parent);
+    firstChildren.push(NONE);
+    nextSiblings.push(NONE);
+    return types.length - 1;
+  };
+
+  // The parent links are written first, so climbing back up needs no stack.
+  let current = add(NONE);
+  for (;;) {
+    if (cursor.gotoFirstChild()) {
+      const child = add(current);
+      firstChildren[current] = child;
+      current = child;
+      continue;
+    }
+    let done = false;
+    while (!cursor.gotoNextSibling()) {
+      if (!cursor.gotoParent()) {
+        done = true;
+        break;
+      }
+      current = parents[current];
+    }
+    if (done) break;
+    const sibling = add(parents[current]);
+    nextSiblings[current] = sibling;
+    current = sibling;
+  }
+  if (typeof cursor.delete === "function") cursor.delete();
+
+  const count = types.length;
+  const buffer = new Buffer((HEADER_LENGTH + COLUMNS * count) * Uint32Array.BYTES_PER_ELEMENT);
+  const words = new Uint32Array(buffer);
+  words.set([MAGIC, VERSION, count, COLUMNS]);
+  columns.forEach((column, i) => words.set(column, HEADER_LENGTH + i * count));
+  return buffer;
+}
+
+class FlatTree {
+  constructor(buffer, symbolNames) {
+    const header = new Uint32Array(buffer, 0, HEADER_LENGTH);
+    if (header[0] !== MAGIC || header[1] !== VERSION || header[3] !== COLUMNS) {
+      throw new TypeError("not a flat tree of this version");
+    }
+    const count = header[2];
+    const column = (i) => new Uint32Array(buffer, (HEADER_LENGTH + i * count) * 4, count);
+    this.buffer = buffer;
+    this.symbolNames = symbolNames;
+    this.nodeCount = count;
+    this.types = column(0);
+    this.flags = column(1);
+    this.startIndices = column(2);
+    this.endIndices = column(3);
+    this.parents = column(4);
+    this.firstChildren = column(5);
+    this.nextSiblings = column(6);
+  }
+
+  typeOf(index) {
+    const symbol = this.types[index];
+    return symbol === ERROR_SYMBOL ? "ERROR" : this.symbolNames[symbol];
+  }
+
+  walk(index = 0) {
+    return new FlatTreeCursor(this, index);
+  }
+}
+
+// Named after node-tree-sitter's TreeCursor. Nodes are plain indices into
+// the tree's columns; `nodeIndex` is the current one.
+class FlatTreeCursor {
+  constructor(tree, index) {
+    this.tree = tree;
+    this.nodeIndex = index;
+    this.rootIndex = index;
+  }
+
+  get nodeType() {
+    return this.tree.typeOf(this.nodeIndex);
+  }
+
+  get nodeTypeId() {
+    return this.tree.types[this.nodeIndex];
+  }
+
+  get nodeIsNamed() {
+    return (this.tree.flags[this.nodeIndex] & NAMED) !== 0;
+  }
+
+  get nodeIsExtra() {
+    return (this.tree.flags[this.nodeIndex] & EXTRA) !== 0;
+  }
+
+  get nodeIsMissing() {
+    return (this.tree.flags[this.nodeIndex] & MISSING) !== 0;
+  }
+
+  get nodeHasError() {
+    return (this.tree.flags[this.nodeIndex] & HAS_ERROR) !== 0;
+  }
+
+  get startIndex() {
+    return this.tree.startIndices[this.nodeIndex];
+  }
+
+  get endIndex() {
+    return this.tree.endIndices[this.nodeIndex];
+  }
+
+  gotoFirstChild() {
+    return this.goto(this.tree.firstChildren[this.nodeIndex]);
+  }
+
+  gotoNextSibling() {
+    if (this.nodeIndex === this.rootIndex) return false;
+    return this.goto(this.tree.nextSiblings[this.nodeIndex]);
+  }
+
+  gotoParent() {
+    if (this.nodeIndex === this.rootIndex) return false;
+    return this.goto(this.tree.parents[this.nodeIndex]);
+  }
+
+  reset(index = this.rootIndex) {
+    this.nodeIndex = index;
+    this.rootIndex = index;
+  }
+
+  goto(index) {
+    if (index === NONE) return false;
+    this.nodeIndex = index;
+    return true;
+  }
+}
+
+// For writers of the same layout, such as bindings/wasm/flatten.js.
+const layout = { MAGIC, VERSION, HEADER_LENGTH, COLUMNS, NONE, ERROR_SYMBOL, NAMED, EXTRA, MISSING, HAS_ERROR };
+
+module.exports = { flattenTree, flattenCursor, FlatTree, FlatTreeCursor, layout };
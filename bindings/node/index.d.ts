@@ -0,0 +1,174 @@
+import Parser = require("tree-sitter");
+
+type BaseNode = {
+  type: string;
+  named: boolean;
+};
+
+type ChildNode = {
+  multiple: boolean;
+  required: boolean;
+  types: BaseNode[];
+};
+
+type NodeInfo =
+  | (BaseNode & {
+      subtypes: BaseNode[];
+    })
+  | (BaseNode & {
+      fields: { [name: string]: ChildNode };
+      children: ChildNode[];
+    });
+
+type Point = {
+  row: number;
+  column: number;
+};
+
+type Edit = {
+  startIndex: number;
+  oldEndIndex: number;
+  newEndIndex: number;
+  startPosition: Point;
+  oldEndPosition: Point;
+  newEndPosition: Point;
+};
+
+type Range = {
+  startIndex: number;
+  endIndex: number;
+  startPosition: Point;
+  endPosition: Point;
+};
+
+/**
+ * A handle to a tree from parseHandleAsync, not a node-tree-sitter Tree: it
+ * has no rootNode and no node API. Pass it to parseHandleAsync as the old
+ * tree, or read its nodes through flattenTree and openFlatTree. Indices and
+ * columns count UTF-16 code units.
+ */
+declare class Tree {
+  private constructor();
+  readonly hasError: boolean;
+  edit(edit: Edit): Tree;
+  getChangedRanges(newTree: Tree): Range[];
+  toString(): string;
+  /** Frees the tree without waiting for garbage collection. */
+  delete(): void;
+  /** The number of uint32 words flattenInto() writes. */
+  readonly flatLength: number;
+  flattenInto(words: Uint32Array): void;
+}
+
+/**
+ * A tree flattened into columns, indexed by node in pre-order. The root is
+ * node 0, and 0xffffffff means no node.
+ */
+declare class FlatTree {
+  private constructor();
+  readonly buffer: SharedArrayBuffer | ArrayBuffer;
+  readonly nodeCount: number;
+  readonly types: Uint32Array;
+  readonly flags: Uint32Array;
+  readonly startIndices: Uint32Array;
+  readonly endIndices: Uint32Array;
+  readonly parents: Uint32Array;
+  readonly firstChildren: Uint32Array;
+  readonly nextSiblings: Uint32Array;
+  typeOf(index: number): string;
+  walk(index?: number): FlatTreeCursor;
+}
+
+declare class FlatTreeCursor {
+  private constructor();
+  readonly nodeIndex: number;
+  readonly nodeType: string;
+  readonly nodeTypeId: number;
+  readonly nodeIsNamed: boolean;
+  readonly nodeIsExtra: boolean;
+  readonly nodeIsMissing: boolean;
+  readonly nodeHasError: boolean;
+  readonly startIndex: number;
+  readonly endIndex: number;
+  gotoFirstChild(): boolean;
+  gotoNextSibling(): boolean;
+  gotoParent(): boolean;
+  reset(index?: number): void;
+}
+
+type ParseOptions = {
+  /** A newer parseAsync call with the same key cancels this one. */
+  key?: unknown;
+  signal?: AbortSignal;
+};
+
+/** The first element of each parseMany record. */
+declare const enum RecordKind {
+  TEMPLATE = 1,
+  SCRIPT = 2,
+  STYLE = 3,
+  CUSTOM_BLOCK = 4,
+  COMPONENT = 5,
+  DIRECTIVE = 6,
+  INTERPOLATION = 7,
+}
+
+type ParseManyOptions = {
+  /** Defaults to all four. */
+  extract?: Array<"blocks" | "components" | "directives" | "interpolations">;
+  /** Defaults to the number of CPUs. */
+  threads?: number;
+};
+
+type ParseManyResult = {
+  /**
+   * Records of five numbers, `[kind, start, end, innerStart, innerEnd]`, as
+   * UTF-8 byte offsets into `source`.
+   */
+  records: Uint32Array;
+  hasError: boolean;
+  /** The Buffer that was passed in, or the contents of the path. */
+  source?: Buffer;
+  /** Set when the file could not be read. */
+  error?: string;
+};
+
+type Language = {
+  name: string;
+  language: unknown;
+  nodeTypeInfo: NodeInfo[];
+  Tree: typeof Tree;
+  /** Type names by symbol id. */
+  symbolNames: string[];
+  /**
+   * Copies `tree` into a SharedArrayBuffer that can be posted to workers,
+   * natively for a Tree handle and through a TreeCursor for a
+   * node-tree-sitter Tree.
+   */
+  flattenTree(tree: Tree | Parser.Tree): SharedArrayBuffer;
+  /** Reads a buffer from flattenTree in place, in any thread. */
+  openFlatTree(buffer: SharedArrayBuffer): FlatTree;
+  /**
+   * Parses with node-tree-sitter's Parser in slices that let the event loop
+   * run in between. Cancelled parses reject with an AbortError.
+   */
+  parseAsync(
+    source: string,
+    oldTree?: Parser.Tree | null,
+    options?: ParseOptions,
+  ): Promise<Parser.Tree> & { cancel(): void };
+  /**
+   * Parses on the libuv threadpool and resolves with a Tree handle, which
+   * has no rootNode. Cancelled parses reject with an AbortError.
+   */
+  parseHandleAsync(source: string, oldTree?: Tree | null, options?: ParseOptions): Promise<Tree> & { cancel(): void };
+  RecordKind: typeof RecordKind;
+  /**
+   * Parses paths and Buffers on a native thread pool and returns only the
+   * extracted records. Buffers must not change until the promise settles.
+   */
+  parseMany(files: Array<string | Buffer>, options?: ParseManyOptions): Promise<ParseManyResult[]>;
+};
+
+declare const language: Language;
+export = language;
@@ -1,11 +1,23 @@
+// The addon calls the tree-sitter runtime in node-tree-sitter's binding
+// instead of carrying its own (see binding.gyp). Loading that binding again
+// with RTLD_GLOBAL makes its symbols visible to the addon; dlopen returns the
+// copy that is already loaded, if any, so both share one runtime.
+if (process.platform !== "win32") {
+  const path = require("path");
+  const { RTLD_NOW, RTLD_GLOBAL } = require("os").constants.dlopen;
+  const treeSitterDir = path.dirname(require.resolve("tree-sitter/package.json"));
+  const nodeGypBuild = require(require.resolve("node-gyp-build", { paths: [treeSitterDir] }));
+  process.dlopen({ exports: {} }, nodeGypBuild.path(treeSitterDir), RTLD_NOW | RTLD_GLOBAL);
+}
+
 try {
-  module.exports = require("../../build/Release/tree_sitter_YOUR_LANGUAGE_NAME_binding");
+  module.exports = require("../../build/Release/tree_sitter_vue3_binding");
 } catch (error1) {
   if (error1.code !== 'MODULE_NOT_FOUND') {
     throw error1;
   }
   try {
-    module.exports = require("../../build/Debug/tree_sitter_YOUR_LANGUAGE_NAME_binding");
+    module.exports = require("../../build/Debug/tree_sitter_vue3_binding");
   } catch (error2) {
     if (error2.code !== 'MODULE_NOT_FOUND') {
       throw error2;
@@ -17,3 +29,25 @@ try {
 try {
   module.exports.nodeTypeInfo = require("../../src/node-types.json");
 } catch (_) {}
+
+// flattenTree(tree) copies a tree into a SharedArrayBuffer once, and
+// openFlatTree(buffer), in any thread, reads it in place.
+const { flattenTree, FlatTree } = require("./flat_tree");
+const symbolNames = module.exports.symbolNames;
+
+module.exports.flattenTree = flattenTree;
+module.exports.openFlatTree = (buffer) => new FlatTree(buffer, symbolNames);
+
+// parseAsync(source, oldTree, {key, signal}) resolves with a node-tree-sitter
+// Tree, parsed on the main thread in slices between which the event loop runs.
+// parseHandleAsync takes the same arguments and parses on the libuv
+// threadpool, but resolves with the addon's own Tree, a handle without
+// rootNode: node-tree-sitter has no way to wrap a tree it did not parse, even
+// though both come from the same runtime. Read its nodes with flattenTree().
+// Cancelled calls reject with an AbortError, and the returned promises also
+// have a cancel() method.
+const { createSlicedParse, withCancellation } = require("./parse_async");
+const Parser = require("tree-sitter");
+
+module.exports.parseHandleAsync = withCancellation(module.exports.parseHandleAsync);
+module.exports.parseAsync = withCancellation(createSlicedParse(Parser, module.exports));
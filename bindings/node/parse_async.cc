@@ -0,0 +1,100 @@
+#include <atomic>
+#include <memory>
+#include <string>
+
+#include "binding.h"
+#include "tree.h"
+
+namespace tree_sitter_vue3_node {
+
+namespace {
+
+// tree-sitter polls the cancellation flag with an atomic load of a size_t.
+using CancellationFlag = std::atomic<size_t>;
+static_assert(sizeof(CancellationFlag) == sizeof(size_t), "the flag must have the layout of a size_t");
+
+// Parses on the libuv threadpool. The source is copied as UTF-16 on the main
+// thread, and the old tree, if any, is a ts_tree_copy that the worker owns, so
+// nothing the worker touches can change under it.
+class ParseWorker : public Napi::AsyncWorker {
+ public:
+  ParseWorker(Napi::Env env, std::u16string source, TSTree *old_tree, std::shared_ptr<CancellationFlag> flag)
+      : Napi::AsyncWorker(env, "tree_sitter_vue3.parseHandleAsync"),
+        deferred_(Napi::Promise::Deferred::New(env)),
+        source_(std::move(source)),
+        old_tree_(old_tree),
+        flag_(std::move(flag)) {}
+
+  ~ParseWorker() override {
+    if (old_tree_) ts_tree_delete(old_tree_);
+    if (tree_) ts_tree_delete(tree_);
+  }
+
+  Napi::Promise Promise() const { return deferred_.Promise(); }
+
+  void Execute() override {
+    if (flag_->load()) {
+      SetError("parse cancelled");
+      return;
+    }
+    TSParser *parser = ts_parser_new();
+    ts_parser_set_language(parser, tree_sitter_vue3());
+    ts_parser_set_cancellation_flag(parser, reinterpret_cast<const size_t *>(flag_.get()));
+    tree_ = ts_parser_parse_string_encoding(parser, old_tree_, reinterpret_cast<const char *>(source_.data()),
+                                            static_cast<uint32_t>(source_.size() * sizeof(char16_t)),
+                                            TSInputEncodingUTF16);
+    ts_parser_delete(parser);
+    if (!tree_) SetError("parse cancelled");
+  }
+
+  void OnOK() override {
+    Napi::Object tree = Tree::New(Env(), tree_);
+    tree_ = nullptr;
+    deferred_.Resolve(tree);
+  }
+
+  void OnError(const Napi::Error &error) override {
+    Napi::Object value = error.Value();
+    value["name"] = Napi::String::New(Env(), "AbortError");
+    deferred_.Reject(value);
+  }
+
+ private:
+  Napi::Promise::Deferred deferred_;
+  std::u16string source_;
+  TSTree *old_tree_;
+  TSTree *tree_ = nullptr;
+  std::shared_ptr<CancellationFlag> flag_;
+};
+
+}  // namespace
+
+Napi::Value ParseAsync(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  if (info.Length() < 1 || !info[0].IsString()) {
+    Napi::TypeError::New(env, "parseHandleAsync(source, oldTree?) needs a source string").ThrowAsJavaScriptException();
+    return env.Undefined();
+  }
+
+  TSTree *old_tree = nullptr;
+  if (info.Length() > 1 && !info[1].IsUndefined() && !info[1].IsNull()) {
+    Tree *tree = Tree::FromValue(env, info[1]);
+    if (!tree) {
+      Napi::TypeError::New(env, "oldTree must be a live Tree from parseHandleAsync").ThrowAsJavaScriptException();
+      return env.Undefined();
+    }
+    old_tree = ts_tree_copy(tree->tree());
+  }
+
+  auto flag = std::make_shared<CancellationFlag>(0);
+  auto *worker = new ParseWorker(env, info[0].As<Napi::String>().Utf16Value(), old_tree, flag);
+  Napi::Promise promise = worker->Promise();
+  promise["cancel"] = Napi::Function::New(env, [flag](const Napi::CallbackInfo &cancel_info) -> Napi::Value {
+    flag->store(1);
+    return cancel_info.Env().Undefined();
+  }, "cancel");
+  worker->Queue();
+  return promise;
+}
+
+}  // namespace tree_sitter_vue3_node
@@ -0,0 +1,110 @@
+// parseAsync for node-tree-sitter trees, and the key and signal handling that
+// it shares with the addon's threadpool parse.
+//
+// node-tree-sitter only wraps trees that its own Parser returns, so parseAsync
+// drives one of those. Each call parses for at most SLICE_MICROS with the
+// parser's timeout and yields to the event loop. When a parse times out,
+// tree-sitter keeps its state, and the next parse() with the same input resumes
+// where it stopped. Cancelling resets the parser between slices.
+
+const SLICE_MICROS = 5000;
+
+function abortError() {
+  const error = new Error("parse cancelled");
+  error.name = "AbortError";
+  return error;
+}
+
+// Returns parse(source, oldTree), which resolves with a node-tree-sitter Tree.
+// Parsers are reused, and there is one per parse in flight, because a parser
+// cannot resume a parse while it is working on another.
+function createSlicedParse(Parser, language) {
+  const idle = [];
+
+  return function parse(source, oldTree) {
+    let parser = idle.pop();
+    if (!parser) {
+      parser = new Parser();
+      parser.setLanguage(language);
+      parser.setTimeoutMicros(SLICE_MICROS);
+    }
+
+    let cancelled = false;
+    let resolve, reject;
+    const promise = new Promise((resolvePromise, rejectPromise) => {
+      resolve = resolvePromise;
+      reject = rejectPromise;
+    });
+
+    const finish = () => {
+      parser.reset();
+      idle.push(parser);
+    };
+    const step = () => {
+      if (cancelled) {
+        finish();
+        reject(abortError());
+        return;
+      }
+      let tree;
+      try {
+        tree = parser.parse(source, oldTree);
+      } catch (error) {
+        finish();
+        reject(error);
+        return;
+      }
+      if (tree) {
+        finish();
+        resolve(tree);
+      } else {
+        setImmediate(step);
+      }
+    };
+    setImmediate(step);
+
+    promise.cancel = () => {
+      cancelled = true;
+    };
+    return promise;
+  };
+}
+
+// Wraps parse(source, oldTree), whose promise has a cancel() method, with the
+// {key, signal} options. A newer call with the same `key`, e.g. a document
+// URI, cancels the one it supersedes, and aborting `signal` cancels the call.
+function withCancellation(parse) {
+  const pending = new Map();
+
+  return function (source, oldTree, options = {}) {
+    const { key, signal } = options;
+    if (signal && signal.aborted) return Promise.reject(abortError());
+
+    const promise = parse(source, oldTree);
+    if (key !== undefined) {
+      const superseded = pending.get(key);
+      if (superseded) superseded.cancel();
+      pending.set(key, promise);
+    }
+    if (signal) signal.addEventListener("abort", promise.cancel, { once: true });
+
+    const settle = () => {
+      if (key !== undefined && pending.get(key) === promise) pending.delete(key);
+      if (signal) signal.removeEventListener("abort", promise.cancel);
+    };
+    const result = promise.then(
+      (tree) => {
+        settle();
+        return tree;
+      },
+      (error) => {
+        settle();
+        throw error;
+      },
+    );
+    result.cancel = promise.cancel;
+    return result;
+  };
+}
+
+module.exports = { createSlicedParse, withCancellation, SLICE_MICROS };
@@ -0,0 +1,220 @@
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "binding.h"
+#include "extract.h"
+
+namespace tree_sitter_vue3_node {
+
+namespace {
+
+struct File {
+  // Paths are read on the pool thread that parses them, into `contents`.
+  // Buffers are parsed in place and kept alive by `buffer`.
+  std::string path;
+  Napi::Reference<Napi::Buffer<char>> buffer;
+  const char *data = nullptr;
+  size_t length = 0;
+
+  std::string *contents = nullptr;
+  std::vector<uint32_t> records;
+  bool has_error = false;
+  std::string error;
+};
+
+bool ReadFile(File *file) {
+  std::ifstream stream(file->path, std::ios::binary);
+  if (!stream) {
+    file->error = "cannot read " + file->path;
+    return false;
+  }
+  file->contents = new std::string(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+  if (stream.bad()) {
+    file->error = "cannot read " + file->path;
+    return false;
+  }
+  file->data = file->contents->data();
+  file->length = file->contents->size();
+  return true;
+}
+
+// Parses every file on its own pool of threads, one TSParser per thread, and
+// keeps only the extracted records. The JS thread sees one Uint32Array per
+// file and never a tree-sitter node.
+class ParseManyWorker : public Napi::AsyncWorker {
+ public:
+  ParseManyWorker(Napi::Env env, std::vector<File> files, uint32_t flags, unsigned threads)
+      : Napi::AsyncWorker(env, "tree_sitter_vue3.parseMany"),
+        deferred_(Napi::Promise::Deferred::New(env)),
+        files_(std::move(files)),
+        flags_(flags),
+        threads_(threads) {}
+
+  ~ParseManyWorker() override {
+    for (File &file : files_) delete file.contents;
+  }
+
+  Napi::Promise Promise() const { return deferred_.Promise(); }
+
+  void Execute() override {
+    std::atomic<size_t> next(0);
+    auto run = [this, &next]() {
+      TSParser *parser = ts_parser_new();
+      ts_parser_set_language(parser, tree_sitter_vue3());
+      for (size_t i; (i = next.fetch_add(1)) < files_.size();) {
+        File &file = files_[i];
+        if (file.buffer.IsEmpty() && !ReadFile(&file)) continue;
+        TSTree *tree = ts_parser_parse_string(parser, nullptr, file.data, static_cast<uint32_t>(file.length));
+        if (!tree) {
+          file.error = "parse failed";
+          ts_parser_reset(parser);
+          continue;
+        }
+        file.has_error = ts_node_has_error(ts_tree_root_node(tree));
+        ExtractRecords(tree, file.data, flags_, &file.records);
+        ts_tree_delete(tree);
+      }
+      ts_parser_delete(parser);
+    };
+
+    // This libuv thread takes a share of the files too.
+    std::vector<std::thread> pool;
+    unsigned count = static_cast<unsigned>(std::min<size_t>(threads_, files_.size()));
+    for (unsigned i = 1; i < count; i++) pool.emplace_back(run);
+    run();
+    for (std::thread &thread : pool) thread.join();
+  }
+
+  void OnOK() override {
+    Napi::Env env = Env();
+    Napi::Array results = Napi::Array::New(env, files_.size());
+    for (size_t i = 0; i < files_.size(); i++) {
+      File &file = files_[i];
+      Napi::Object result = Napi::Object::New(env);
+
+      size_t bytes = file.records.size() * sizeof(uint32_t);
+      Napi::ArrayBuffer records = Napi::ArrayBuffer::New(env, bytes);
+      if (bytes) memcpy(records.Data(), file.records.data(), bytes);
+      result["records"] = Napi::Uint32Array::New(env, file.records.size(), records, 0);
+      result["hasError"] = Napi::Boolean::New(env, file.has_error);
+
+      // Records hold byte offsets, so hand back the bytes they index into.
+      // Sources read from paths move into the Buffer without a copy.
+      if (!file.buffer.IsEmpty()) {
+        result["source"] = file.buffer.Value();
+      } else if (file.contents) {
+        std::string *contents = file.contents;
+        file.contents = nullptr;
+        result["source"] = Napi::Buffer<char>::New(
+          env, &(*contents)[0], contents->size(), [](Napi::Env, char *, std::string *hint) { delete hint; },
+          contents);
+      }
+      if (!file.error.empty()) result["error"] = Napi::String::New(env, file.error);
+      results[static_cast<uint32_t>(i)] = result;
+    }
+    deferred_.Resolve(results);
+  }
+
+  void OnError(const Napi::Error &error) override { deferred_.Reject(error.Value()); }
+
+ private:
+  Napi::Promise::Deferred deferred_;
+  std::vector<File> files_;
+  uint32_t flags_;
+  unsigned threads_;
+};
+
+bool ReadFlags(Napi::Value value, uint32_t *flags) {
+  if (value.IsUndefined()) {
+    *flags = EXTRACT_ALL;
+    return true;
+  }
+  if (!value.IsArray()) return false;
+  Napi::Array names = value.As<Napi::Array>();
+  *flags = 0;
+  for (uint32_t i = 0; i < names.Length(); i++) {
+    Napi::Value name = names.Get(i);
+    if (!name.IsString()) return false;
+    std::string string = name.As<Napi::String>().Utf8Value();
+    if (string == "blocks") {
+      *flags |= EXTRACT_BLOCKS;
+    } else if (string == "components") {
+      *flags |= EXTRACT_COMPONENTS;
+    } else if (string == "directives") {
+      *flags |= EXTRACT_DIRECTIVES;
+    } else if (string == "interpolations") {
+      *flags |= EXTRACT_INTERPOLATIONS;
+    } else {
+      return false;
+    }
+  }
+  return true;
+}
+
+}  // namespace
+
+Napi::Value ParseMany(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  if (info.Length() < 1 || !info[0].IsArray()) {
+    Napi::TypeError::New(env, "parseMany(files, options?) needs an array of paths and Buffers")
+      .ThrowAsJavaScriptException();
+    return env.Undefined();
+  }
+
+  uint32_t flags = EXTRACT_ALL;
+  unsigned threads = std::max(1u, std::thread::hardware_concurrency());
+  if (info.Length() > 1 && info[1].IsObject()) {
+    Napi::Object options = info[1].As<Napi::Object>();
+    if (!ReadFlags(options.Get("extract"), &flags)) {
+      Napi::TypeError::New(env, "extract must list blocks, components, directives or interpolations")
+        .ThrowAsJavaScriptException();
+      return env.Undefined();
+    }
+    Napi::Value count = options.Get("threads");
+    if (count.IsNumber() && count.As<Napi::Number>().Uint32Value() > 0) {
+      threads = count.As<Napi::Number>().Uint32Value();
+    }
+  }
+
+  Napi::Array inputs = info[0].As<Napi::Array>();
+  std::vector<File> files(inputs.Length());
+  for (uint32_t i = 0; i < inputs.Length(); i++) {
+    Napi::Value input = inputs.Get(i);
+    if (input.IsString()) {
+      files[i].path = input.As<Napi::String>().Utf8Value();
+    } else if (input.IsBuffer()) {
+      Napi::Buffer<char> buffer = input.As<Napi::Buffer<char>>();
+      files[i].data = buffer.Data();
+      files[i].length = buffer.Length();
+      files[i].buffer = Napi::Persistent(buffer);
+    } else {
+      Napi::TypeError::New(env, "parseMany() files must be paths or Buffers").ThrowAsJavaScriptException();
+      return env.Undefined();
+    }
+  }
+
+  auto *worker = new ParseManyWorker(env, std::move(files), flags, threads);
+  Napi::Promise promise = worker->Promise();
+  worker->Queue();
+  return promise;
+}
+
+Napi::Object RecordKinds(Napi::Env env) {
+  Napi::Object kinds = Napi::Object::New(env);
+  kinds["TEMPLATE"] = Napi::Number::New(env, RECORD_TEMPLATE);
+  kinds["SCRIPT"] = Napi::Number::New(env, RECORD_SCRIPT);
+  kinds["STYLE"] = Napi::Number::New(env, RECORD_STYLE);
+  kinds["CUSTOM_BLOCK"] = Napi::Number::New(env, RECORD_CUSTOM_BLOCK);
+  kinds["COMPONENT"] = Napi::Number::New(env, RECORD_COMPONENT);
+  kinds["DIRECTIVE"] = Napi::Number::New(env, RECORD_DIRECTIVE);
+  kinds["INTERPOLATION"] = Napi::Number::New(env, RECORD_INTERPOLATION);
+  return kinds;
+}
+
+}  // namespace tree_sitter_vue3_node
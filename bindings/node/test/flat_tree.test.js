@@ -0,0 +1,121 @@
+// node --test bindings/node/test/
+const assert = require("node:assert");
+const fs = require("node:fs");
+const path = require("node:path");
+const { test } = require("node:test");
+
+const { flattenTree, flattenCursor, FlatTree, layout } = require("../flat_tree");
+
+const { NONE, NAMED, EXTRA, MISSING, HAS_ERROR } = layout;
+
+// Every node but the root is reached exactly once from its parent's
+// firstChild/nextSibling chain, comes after it in pre-order, and lies inside
+// it.
+function checkLinks(tree) {
+  let reached = 1;
+  for (let i = 0; i < tree.nodeCount; i++) {
+    for (let child = tree.firstChildren[i]; child !== NONE; child = tree.nextSiblings[child]) {
+      assert.ok(child > i && tree.parents[child] === i, `node ${child} is linked from ${i} but has parent ${tree.parents[child]}`);
+      assert.ok(
+        tree.startIndices[child] >= tree.startIndices[i] && tree.endIndices[child] <= tree.endIndices[i],
+        `node ${child} is outside its parent ${i}`,
+      );
+      reached++;
+    }
+  }
+  assert.strictEqual(reached, tree.nodeCount, `reached ${reached} of ${tree.nodeCount} nodes`);
+  assert.strictEqual(tree.parents[0], NONE);
+}
+
+// A tree with the TreeCursor and SyntaxNode properties flattenTree reads from
+// node-tree-sitter, over plain objects.
+function fakeTree(root) {
+  const link = (node, parent) => {
+    node.parent = parent;
+    (node.children || []).forEach((child, i) => {
+      child.index = i;
+      link(child, node);
+    });
+  };
+  link(root, null);
+  return {
+    walk() {
+      let node = root;
+      return {
+        get nodeTypeId() { return node.typeId; },
+        get nodeIsNamed() { return !!node.named; },
+        get nodeIsMissing() { return !!node.missing; },
+        get startIndex() { return node.start; },
+        get endIndex() { return node.end; },
+        get currentNode() { return { isExtra: !!node.extra, hasError: !!node.error }; },
+        gotoFirstChild() {
+          if (!node.children || !node.children.length) return false;
+          node = node.children[0];
+          return true;
+        },
+        gotoNextSibling() {
+          if (node === root || node.index + 1 >= node.parent.children.length) return false;
+          node = node.parent.children[node.index + 1];
+          return true;
+        },
+        gotoParent() {
+          if (node === root) return false;
+          node = node.parent;
+          return true;
+        },
+      };
+    },
+  };
+}
+
+const fake = fakeTree({
+  typeId: 1, named: true, start: 0, end: 20, error: true,
+  children: [
+    { typeId: 2, start: 0, end: 1 },
+    {
+      typeId: 3, named: true, start: 1, end: 12, error: true,
+      children: [
+        { typeId: 4, named: true, start: 1, end: 5, extra: true },
+        { typeId: 0xffff, named: true, start: 5, end: 12, error: true, children: [{ typeId: 5, start: 6, end: 7 }] },
+      ],
+    },
+    { typeId: 6, start: 12, end: 12, missing: true },
+    { typeId: 7, named: true, start: 12, end: 20 },
+  ],
+});
+
+test("flattenTree walks node-tree-sitter trees in pre-order", () => {
+  const flat = new FlatTree(flattenTree(fake), []);
+  assert.ok(flat.buffer instanceof SharedArrayBuffer);
+  assert.deepStrictEqual(Array.from(flat.types), [1, 2, 3, 4, 0xffff, 5, 6, 7]);
+  assert.deepStrictEqual(Array.from(flat.parents), [NONE, 0, 0, 2, 2, 4, 0, 0]);
+  assert.deepStrictEqual(Array.from(flat.flags), [
+    NAMED | HAS_ERROR, 0, NAMED | HAS_ERROR, NAMED | EXTRA, NAMED | HAS_ERROR, 0, MISSING, NAMED,
+  ]);
+  checkLinks(flat);
+});
+
+test("flattening a flat tree's own cursor gives the same buffer", () => {
+  const buffer = flattenTree(fake);
+  const flat = new FlatTree(buffer, []);
+  const copy = flattenCursor(flat.walk(), (cursor) => flat.flags[cursor.nodeIndex], ArrayBuffer);
+  assert.deepStrictEqual(new Uint32Array(copy), new Uint32Array(buffer));
+});
+
+// Needs the addon and node-tree-sitter, so it is skipped where they are not
+// installed.
+let binding;
+try {
+  binding = require("..");
+} catch (_) {}
+
+test("node-tree-sitter and handle trees flatten alike", { skip: !binding && "the addon is not built" }, async () => {
+  const source = fs.readFileSync(path.join(__dirname, "../../../test/app.vue"), "utf8");
+  const tree = await binding.parseAsync(source);
+  const handle = await binding.parseHandleAsync(source);
+  const flat = new FlatTree(flattenTree(tree), binding.symbolNames);
+  checkLinks(flat);
+  assert.strictEqual(flat.typeOf(0), tree.rootNode.type);
+  assert.deepStrictEqual(new Uint32Array(flat.buffer), new Uint32Array(flattenTree(handle)));
+  handle.delete();
+});
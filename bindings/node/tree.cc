@@ -0,0 +1,172 @@
+#include "tree.h"
+
+#include <cstdlib>
+
+#include "binding.h"
+#include "flat_tree.h"
+
+namespace tree_sitter_vue3_node {
+
+namespace {
+
+// UTF-16 code units to and from the byte offsets tree-sitter uses.
+inline uint32_t ToBytes(uint32_t code_units) { return code_units * 2; }
+inline uint32_t ToCodeUnits(uint32_t bytes) { return bytes / 2; }
+
+bool ReadIndex(Napi::Object object, const char *name, uint32_t *index) {
+  Napi::Value value = object.Get(name);
+  if (!value.IsNumber()) return false;
+  *index = ToBytes(value.As<Napi::Number>().Uint32Value());
+  return true;
+}
+
+bool ReadPoint(Napi::Object object, const char *name, TSPoint *point) {
+  Napi::Value value = object.Get(name);
+  if (!value.IsObject()) return false;
+  Napi::Object position = value.As<Napi::Object>();
+  Napi::Value row = position.Get("row");
+  Napi::Value column = position.Get("column");
+  if (!row.IsNumber() || !column.IsNumber()) return false;
+  point->row = row.As<Napi::Number>().Uint32Value();
+  point->column = ToBytes(column.As<Napi::Number>().Uint32Value());
+  return true;
+}
+
+Napi::Object PointToObject(Napi::Env env, TSPoint point) {
+  Napi::Object object = Napi::Object::New(env);
+  object["row"] = Napi::Number::New(env, point.row);
+  object["column"] = Napi::Number::New(env, ToCodeUnits(point.column));
+  return object;
+}
+
+}  // namespace
+
+Napi::Function Tree::Define(Napi::Env env) {
+  return DefineClass(env, "Tree",
+                     {
+                       InstanceMethod<&Tree::Edit>("edit"),
+                       InstanceMethod<&Tree::GetChangedRanges>("getChangedRanges"),
+                       InstanceMethod<&Tree::ToString>("toString"),
+                       InstanceMethod<&Tree::Delete>("delete"),
+                       InstanceMethod<&Tree::FlattenInto>("flattenInto"),
+                       InstanceAccessor<&Tree::HasError>("hasError"),
+                       InstanceAccessor<&Tree::FlatLength>("flatLength"),
+                     });
+}
+
+Napi::Object Tree::New(Napi::Env env, TSTree *tree) {
+  Napi::External<TSTree> external = Napi::External<TSTree>::New(env, tree);
+  return GetAddonData(env)->tree_constructor.New({external});
+}
+
+Tree *Tree::FromValue(Napi::Env env, Napi::Value value) {
+  if (!value.IsObject()) return nullptr;
+  Napi::Object object = value.As<Napi::Object>();
+  if (!object.InstanceOf(GetAddonData(env)->tree_constructor.Value())) return nullptr;
+  Tree *tree = Unwrap(object);
+  return tree && tree->tree_ ? tree : nullptr;
+}
+
+// Trees are only created by the addon, which passes the TSTree as an External.
+Tree::Tree(const Napi::CallbackInfo &info) : Napi::ObjectWrap<Tree>(info) {
+  if (info.Length() != 1 || !info[0].IsExternal()) {
+    Napi::TypeError::New(info.Env(), "Trees are created by parseHandleAsync").ThrowAsJavaScriptException();
+    return;
+  }
+  tree_ = info[0].As<Napi::External<TSTree>>().Data();
+}
+
+Tree::~Tree() {
+  if (tree_) ts_tree_delete(tree_);
+}
+
+// edit({startIndex, oldEndIndex, newEndIndex, startPosition, oldEndPosition,
+// newEndPosition}), the same shape as node-tree-sitter's Tree#edit.
+Napi::Value Tree::Edit(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  TSInputEdit edit;
+  if (
+    !tree_ || info.Length() < 1 || !info[0].IsObject() ||
+    !ReadIndex(info[0].As<Napi::Object>(), "startIndex", &edit.start_byte) ||
+    !ReadIndex(info[0].As<Napi::Object>(), "oldEndIndex", &edit.old_end_byte) ||
+    !ReadIndex(info[0].As<Napi::Object>(), "newEndIndex", &edit.new_end_byte) ||
+    !ReadPoint(info[0].As<Napi::Object>(), "startPosition", &edit.start_point) ||
+    !ReadPoint(info[0].As<Napi::Object>(), "oldEndPosition", &edit.old_end_point) ||
+    !ReadPoint(info[0].As<Napi::Object>(), "newEndPosition", &edit.new_end_point)
+  ) {
+    Napi::TypeError::New(env, "edit() needs a live tree and a complete edit").ThrowAsJavaScriptException();
+    return env.Undefined();
+  }
+  ts_tree_edit(tree_, &edit);
+  return info.This();
+}
+
+// getChangedRanges(newTree) → [{startIndex, endIndex, startPosition, endPosition}]
+Napi::Value Tree::GetChangedRanges(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  Tree *other = info.Length() > 0 ? FromValue(env, info[0]) : nullptr;
+  if (!tree_ || !other) {
+    Napi::TypeError::New(env, "getChangedRanges() needs two live trees").ThrowAsJavaScriptException();
+    return env.Undefined();
+  }
+
+  uint32_t count = 0;
+  TSRange *ranges = ts_tree_get_changed_ranges(tree_, other->tree_, &count);
+  Napi::Array result = Napi::Array::New(env, count);
+  for (uint32_t i = 0; i < count; i++) {
+    Napi::Object range = Napi::Object::New(env);
+    range["startIndex"] = Napi::Number::New(env, ToCodeUnits(ranges[i].start_byte));
+    range["endIndex"] = Napi::Number::New(env, ToCodeUnits(ranges[i].end_byte));
+    range["startPosition"] = PointToObject(env, ranges[i].start_point);
+    range["endPosition"] = PointToObject(env, ranges[i].end_point);
+    result[i] = range;
+  }
+  free(ranges);
+  return result;
+}
+
+// The S-expression of the root node.
+Napi::Value Tree::ToString(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  if (!tree_) return Napi::String::New(env, "");
+  char *string = ts_node_string(ts_tree_root_node(tree_));
+  Napi::String result = Napi::String::New(env, string);
+  free(string);
+  return result;
+}
+
+// Frees the tree now instead of waiting for the garbage collector.
+Napi::Value Tree::Delete(const Napi::CallbackInfo &info) {
+  if (tree_) ts_tree_delete(tree_);
+  tree_ = nullptr;
+  return info.Env().Undefined();
+}
+
+Napi::Value Tree::HasError(const Napi::CallbackInfo &info) {
+  return Napi::Boolean::New(info.Env(), tree_ && ts_node_has_error(ts_tree_root_node(tree_)));
+}
+
+// The number of uint32 words flattenInto() writes; see flat_tree.h.
+Napi::Value Tree::FlatLength(const Napi::CallbackInfo &info) {
+  return Napi::Number::New(info.Env(), tree_ ? static_cast<double>(FlatTreeLength(tree_)) : 0);
+}
+
+// flattenInto(words: Uint32Array), usually a view of a SharedArrayBuffer
+// that flat_tree.js allocated with flatLength words.
+Napi::Value Tree::FlattenInto(const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+  if (
+    !tree_ || info.Length() < 1 || !info[0].IsTypedArray() ||
+    info[0].As<Napi::TypedArray>().TypedArrayType() != napi_uint32_array
+  ) {
+    Napi::TypeError::New(env, "flattenInto() needs a live tree and a Uint32Array").ThrowAsJavaScriptException();
+    return env.Undefined();
+  }
+  Napi::Uint32Array words = info[0].As<Napi::Uint32Array>();
+  if (!WriteFlatTree(tree_, words.Data(), words.ElementLength())) {
+    Napi::RangeError::New(env, "flattenInto() needs flatLength words").ThrowAsJavaScriptException();
+  }
+  return env.Undefined();
+}
+
+}  // namespace tree_sitter_vue3_node
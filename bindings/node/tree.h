@@ -0,0 +1,40 @@
+#ifndef TREE_SITTER_VUE3_NODE_TREE_H_
+#define TREE_SITTER_VUE3_NODE_TREE_H_
+
+#include <napi.h>
+#include <tree_sitter/api.h>
+
+namespace tree_sitter_vue3_node {
+
+// A syntax tree produced by this addon. Sources are parsed as UTF-16, so, as
+// in node-tree-sitter, indices and columns count UTF-16 code units.
+class Tree : public Napi::ObjectWrap<Tree> {
+ public:
+  static Napi::Function Define(Napi::Env env);
+
+  // Wraps `tree` in a new JS Tree, which takes ownership of it.
+  static Napi::Object New(Napi::Env env, TSTree *tree);
+
+  // The Tree behind `value`, or nullptr if `value` is not a live Tree.
+  static Tree *FromValue(Napi::Env env, Napi::Value value);
+
+  explicit Tree(const Napi::CallbackInfo &info);
+  ~Tree() override;
+
+  const TSTree *tree() const { return tree_; }
+
+ private:
+  Napi::Value Edit(const Napi::CallbackInfo &info);
+  Napi::Value GetChangedRanges(const Napi::CallbackInfo &info);
+  Napi::Value ToString(const Napi::CallbackInfo &info);
+  Napi::Value Delete(const Napi::CallbackInfo &info);
+  Napi::Value HasError(const Napi::CallbackInfo &info);
+  Napi::Value FlatLength(const Napi::CallbackInfo &info);
+  Napi::Value FlattenInto(const Napi::CallbackInfo &info);
+
+  TSTree *tree_ = nullptr;
+};
+
+}  // namespace tree_sitter_vue3_node
+
+#endif  // TREE_SITTER_VUE3_NODE_TREE_H_
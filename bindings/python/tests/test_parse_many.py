@@ -0,0 +1,105 @@
+import os
+import tempfile
+import unittest
+
+import tree_sitter_vue as vue
+
+APP = os.path.join(os.path.dirname(__file__), "..", "..", "..", "test", "app.vue")
+
+SOURCE = b"""<template>
+  <my-button v-if="ok" @click.stop="go">{{ message }}</my-button>
+</template>
+
+<script>
+export default {}
+</script>
+
+<style scoped>
+a { color: red }
+</style>"""
+
+
+def rows(result, stride):
+    records = result.records.tolist()
+    return [records[i : i + stride] for i in range(0, len(records), stride)]
+
+
+def text(start, end):
+    return SOURCE[start:end].decode()
+
+
+class ParseManyTest(unittest.TestCase):
+    def setUp(self):
+        directory = tempfile.TemporaryDirectory()
+        self.addCleanup(directory.cleanup)
+        self.path = os.path.join(directory.name, "component.vue")
+        with open(self.path, "wb") as file:
+            file.write(SOURCE)
+
+    def test_node_rows(self):
+        [result] = vue.parse_many([self.path])
+        self.assertIsNone(result.error)
+        self.assertFalse(result.has_error)
+        nodes = rows(result, vue.NODE_STRIDE)
+
+        kind, start, end, parent = nodes[0]
+        self.assertEqual(vue.KIND_NAMES[kind], "component")
+        self.assertEqual((start, end, parent), (0, len(SOURCE), vue.NO_PARENT))
+
+        # Every parent row comes before its children and encloses them.
+        for row, (kind, start, end, parent) in enumerate(nodes[1:], 1):
+            self.assertLess(parent, row)
+            _, parent_start, parent_end, _ = nodes[parent]
+            self.assertTrue(parent_start <= start <= end <= parent_end, f"row {row} is outside row {parent}")
+
+        kinds = [vue.KIND_NAMES[node[0]] for node in nodes]
+        for kind in ("template_element", "script_element", "style_element", "interpolation"):
+            self.assertIn(kind, kinds)
+
+    def test_extract(self):
+        [result] = vue.parse_many([self.path], extract=["blocks", "components", "directives", "interpolations"])
+        records = [
+            (vue.RecordKind(kind), text(start, end), text(inner_start, inner_end))
+            for kind, start, end, inner_start, inner_end in rows(result, vue.RECORD_STRIDE)
+        ]
+        element = '<my-button v-if="ok" @click.stop="go">{{ message }}</my-button>'
+        self.assertEqual(
+            records,
+            [
+                (vue.RecordKind.TEMPLATE, f"<template>\n  {element}\n</template>", f"\n  {element}\n"),
+                (vue.RecordKind.COMPONENT, "my-button", element),
+                (vue.RecordKind.DIRECTIVE, "v-if", "ok"),
+                (vue.RecordKind.DIRECTIVE, "@click.stop", "go"),
+                (vue.RecordKind.INTERPOLATION, "{{ message }}", " message "),
+                (vue.RecordKind.SCRIPT, "<script>\nexport default {}\n</script>", "export default {}\n"),
+                (vue.RecordKind.STYLE, "<style scoped>\na { color: red }\n</style>", "a { color: red }\n"),
+            ],
+        )
+
+    def test_extract_subset(self):
+        [result] = vue.parse_many([self.path], extract=["blocks"])
+        kinds = [row[0] for row in rows(result, vue.RECORD_STRIDE)]
+        self.assertEqual(kinds, [vue.RecordKind.TEMPLATE, vue.RecordKind.SCRIPT, vue.RecordKind.STYLE])
+
+    def test_threads_agree(self):
+        paths = [self.path, APP] * 8
+        single = vue.parse_many(paths, threads=1)
+        many = vue.parse_many(paths, threads=4)
+        self.assertEqual([r.records.tobytes() for r in single], [r.records.tobytes() for r in many])
+
+    def test_unreadable_file(self):
+        missing = self.path + ".missing"
+        [result] = vue.parse_many([missing])
+        self.assertEqual(result.path, missing)
+        self.assertIsNotNone(result.error)
+        self.assertEqual(len(result.records), 0)
+
+    def test_bad_extract(self):
+        with self.assertRaises(ValueError):
+            vue.parse_many([self.path], extract=["nodes"])
+        with self.assertRaises(ValueError):
+            vue.parse_many([self.path], extract=[])
+
+
+if __name__ == "__main__":
+    unittest.main()
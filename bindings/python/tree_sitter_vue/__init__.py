@@ -0,0 +1,90 @@
+"""Vue grammar for tree-sitter"""
+
+import os
+from enum import IntEnum
+from typing import Iterable, List, NamedTuple, Optional, Sequence, Union
+
+from ._binding import _kind_names, _parse_many, language
+
+__all__ = [
+    "ERROR_KIND",
+    "KIND_NAMES",
+    "NODE_STRIDE",
+    "NO_PARENT",
+    "RECORD_STRIDE",
+    "ParseResult",
+    "RecordKind",
+    "language",
+    "parse_many",
+]
+
+#: Node kind names, indexed by the kind IDs in parse_many's node rows,
+#: except ERROR_KIND.
+KIND_NAMES: List[str] = _kind_names()
+
+#: The kind of ERROR nodes, which is past the end of KIND_NAMES.
+ERROR_KIND = 0xFFFF
+
+#: Node rows are [kind, start_byte, end_byte, parent_row].
+NODE_STRIDE = 4
+
+#: Extracted records are [kind, start, end, inner_start, inner_end].
+RECORD_STRIDE = 5
+
+#: The row that a root node's parent_row points to.
+NO_PARENT = 0xFFFFFFFF
+
+
+class RecordKind(IntEnum):
+    """The first field of an extracted record."""
+
+    TEMPLATE = 1
+    SCRIPT = 2
+    STYLE = 3
+    CUSTOM_BLOCK = 4
+    COMPONENT = 5
+    DIRECTIVE = 6
+    INTERPOLATION = 7
+
+
+_EXTRACT_FLAGS = {"blocks": 1, "components": 2, "directives": 4, "interpolations": 8}
+
+
+class ParseResult(NamedTuple):
+    path: str
+    #: uint32 rows of NODE_STRIDE or RECORD_STRIDE fields. numpy.asarray()
+    #: wraps it without a copy.
+    records: memoryview
+    has_error: bool
+    #: Set when the file could not be read.
+    error: Optional[str]
+
+
+def parse_many(
+    paths: Iterable[Union[str, "os.PathLike[str]"]],
+    threads: Optional[int] = None,
+    extract: Optional[Sequence[str]] = None,
+) -> List[ParseResult]:
+    """Parse files on a native thread pool, without holding the GIL.
+
+    Without ``extract``, each result has one row per named node, in
+    pre-order. With ``extract``, a list of ``"blocks"``, ``"components"``,
+    ``"directives"`` and ``"interpolations"``, it has the matching records
+    instead. Offsets are UTF-8 byte offsets. ``threads`` defaults to the
+    number of CPUs.
+    """
+    flags = 0
+    if extract is not None:
+        for name in extract:
+            if name not in _EXTRACT_FLAGS:
+                raise ValueError(f"cannot extract {name!r}")
+            flags |= _EXTRACT_FLAGS[name]
+        if not flags:
+            raise ValueError("extract needs at least one kind of record")
+
+    paths = [os.fspath(path) for path in paths]
+    results = _parse_many(paths, threads or 0, flags)
+    return [
+        ParseResult(path, memoryview(records).cast("I"), has_error, error)
+        for path, (records, has_error, error) in zip(paths, results)
+    ]
@@ -0,0 +1,31 @@
+import os
+from enum import IntEnum
+from typing import Final, Iterable, List, NamedTuple, Optional, Sequence, Union
+
+KIND_NAMES: Final[List[str]]
+ERROR_KIND: Final[int]
+NODE_STRIDE: Final[int]
+RECORD_STRIDE: Final[int]
+NO_PARENT: Final[int]
+
+class RecordKind(IntEnum):
+    TEMPLATE = 1
+    SCRIPT = 2
+    STYLE = 3
+    CUSTOM_BLOCK = 4
+    COMPONENT = 5
+    DIRECTIVE = 6
+    INTERPOLATION = 7
+
+class ParseResult(NamedTuple):
+    path: str
+    records: memoryview
+    has_error: bool
+    error: Optional[str]
+
+def language() -> object: ...
+def parse_many(
+    paths: Iterable[Union[str, os.PathLike[str]]],
+    threads: Optional[int] = None,
+    extract: Optional[Sequence[str]] = None,
+) -> List[ParseResult]: ...
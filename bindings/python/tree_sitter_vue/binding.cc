@@ -0,0 +1,181 @@
+#define PY_SSIZE_T_CLEAN
+#include <Python.h>
+#include <tree_sitter/api.h>
+
+#include <algorithm>
+#include <atomic>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "extract.h"
+
+extern "C" const TSLanguage *tree_sitter_vue3(void);
+
+namespace {
+
+// Rows of flattened named nodes: [kind, start_byte, end_byte, parent_row].
+const uint32_t NODE_STRIDE = 4;
+const uint32_t NO_PARENT = UINT32_MAX;
+
+struct File {
+  std::string path;
+  std::vector<uint32_t> records;
+  bool has_error = false;
+  std::string error;
+};
+
+// Named nodes in pre-order. A node's parent is its nearest named ancestor.
+void FlattenNamedNodes(const TSTree *tree, std::vector<uint32_t> *records) {
+  TSTreeCursor cursor = ts_tree_cursor_new(ts_tree_root_node(tree));
+  // `parent` is the row of the nearest named ancestor; `ancestors` saves it
+  // for every level the cursor descends from.
+  std::vector<uint32_t> ancestors;
+  uint32_t parent = NO_PARENT;
+  for (;;) {
+    TSNode node = ts_tree_cursor_current_node(&cursor);
+    uint32_t row = NO_PARENT;
+    if (ts_node_is_named(node)) {
+      row = static_cast<uint32_t>(records->size() / NODE_STRIDE);
+      records->insert(records->end(), {ts_node_symbol(node), ts_node_start_byte(node), ts_node_end_byte(node), parent});
+    }
+    if (ts_tree_cursor_goto_first_child(&cursor)) {
+      ancestors.push_back(parent);
+      if (row != NO_PARENT) parent = row;
+      continue;
+    }
+    while (!ts_tree_cursor_goto_next_sibling(&cursor)) {
+      if (!ts_tree_cursor_goto_parent(&cursor)) {
+        ts_tree_cursor_delete(&cursor);
+        return;
+      }
+      parent = ancestors.back();
+      ancestors.pop_back();
+    }
+  }
+}
+
+void ParseFile(TSParser *parser, uint32_t flags, File *file) {
+  std::ifstream stream(file->path, std::ios::binary);
+  if (!stream) {
+    file->error = "cannot read " + file->path;
+    return;
+  }
+  std::string source((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+  TSTree *tree = ts_parser_parse_string(parser, nullptr, source.data(), static_cast<uint32_t>(source.size()));
+  if (!tree) {
+    file->error = "parse failed";
+    ts_parser_reset(parser);
+    return;
+  }
+  file->has_error = ts_node_has_error(ts_tree_root_node(tree));
+  if (flags) {
+    tree_sitter_vue3_node::ExtractRecords(tree, source.data(), flags, &file->records);
+  } else {
+    FlattenNamedNodes(tree, &file->records);
+  }
+  ts_tree_delete(tree);
+}
+
+// Called without the GIL: touches no Python objects.
+void ParseFiles(std::vector<File> *files, uint32_t flags, size_t threads) {
+  std::atomic<size_t> next(0);
+  auto run = [files, flags, &next]() {
+    TSParser *parser = ts_parser_new();
+    ts_parser_set_language(parser, tree_sitter_vue3());
+    for (size_t i; (i = next.fetch_add(1)) < files->size();) ParseFile(parser, flags, &(*files)[i]);
+    ts_parser_delete(parser);
+  };
+  std::vector<std::thread> pool;
+  size_t count = std::min(threads, files->size());
+  for (size_t i = 1; i < count; i++) pool.emplace_back(run);
+  run();
+  for (std::thread &thread : pool) thread.join();
+}
+
+PyObject *language(PyObject *, PyObject *) {
+  return PyCapsule_New(const_cast<TSLanguage *>(tree_sitter_vue3()), "tree_sitter.Language", nullptr);
+}
+
+PyObject *kind_names(PyObject *, PyObject *) {
+  const TSLanguage *language = tree_sitter_vue3();
+  uint32_t count = ts_language_symbol_count(language);
+  PyObject *names = PyList_New(count);
+  if (!names) return nullptr;
+  for (uint32_t i = 0; i < count; i++) {
+    PyObject *name = PyUnicode_FromString(ts_language_symbol_name(language, static_cast<TSSymbol>(i)));
+    if (!name) {
+      Py_DECREF(names);
+      return nullptr;
+    }
+    PyList_SET_ITEM(names, i, name);
+  }
+  return names;
+}
+
+// _parse_many(paths, threads, flags) -> [(records: bytes, has_error, error)]
+PyObject *parse_many(PyObject *, PyObject *args) {
+  PyObject *paths;
+  Py_ssize_t threads;
+  unsigned int flags;
+  if (!PyArg_ParseTuple(args, "OnI:_parse_many", &paths, &threads, &flags)) return nullptr;
+  PyObject *sequence = PySequence_Fast(paths, "paths must be a sequence");
+  if (!sequence) return nullptr;
+
+  std::vector<File> files(PySequence_Fast_GET_SIZE(sequence));
+  for (size_t i = 0; i < files.size(); i++) {
+    PyObject *encoded;
+    if (!PyUnicode_FSConverter(PySequence_Fast_GET_ITEM(sequence, i), &encoded)) {
+      Py_DECREF(sequence);
+      return nullptr;
+    }
+    files[i].path.assign(PyBytes_AS_STRING(encoded), PyBytes_GET_SIZE(encoded));
+    Py_DECREF(encoded);
+  }
+  Py_DECREF(sequence);
+
+  if (threads <= 0) threads = std::max(1u, std::thread::hardware_concurrency());
+  Py_BEGIN_ALLOW_THREADS
+  ParseFiles(&files, flags, static_cast<size_t>(threads));
+  Py_END_ALLOW_THREADS
+
+  PyObject *results = PyList_New(static_cast<Py_ssize_t>(files.size()));
+  if (!results) return nullptr;
+  for (size_t i = 0; i < files.size(); i++) {
+    File &file = files[i];
+    PyObject *error = file.error.empty() ? Py_None : PyUnicode_DecodeFSDefault(file.error.c_str());
+    // y# turns a null pointer into None, and an empty vector may have one.
+    const char *records = file.records.empty() ? "" : reinterpret_cast<const char *>(file.records.data());
+    PyObject *result = error ? Py_BuildValue("(y#OO)", records,
+                                             static_cast<Py_ssize_t>(file.records.size() * sizeof(uint32_t)),
+                                             file.has_error ? Py_True : Py_False, error)
+                             : nullptr;
+    if (error != Py_None) Py_XDECREF(error);
+    if (!result) {
+      Py_DECREF(results);
+      return nullptr;
+    }
+    PyList_SET_ITEM(results, static_cast<Py_ssize_t>(i), result);
+    std::vector<uint32_t>().swap(file.records);
+  }
+  return results;
+}
+
+PyMethodDef methods[] = {
+  {"language", language, METH_NOARGS, "Get the tree-sitter language for this grammar."},
+  {"_kind_names", kind_names, METH_NOARGS, nullptr},
+  {"_parse_many", parse_many, METH_VARARGS, nullptr},
+  {nullptr, nullptr, 0, nullptr},
+};
+
+PyModuleDef module = {
+  PyModuleDef_HEAD_INIT, "_binding", nullptr, -1, methods, nullptr, nullptr, nullptr, nullptr,
+};
+
+}  // namespace
+
+PyMODINIT_FUNC PyInit__binding(void) {
+  return PyModule_Create(&module);
+}
@@ -0,0 +1,116 @@
+//! `cargo bench --bench descriptor` compares `Descriptor::from_tree` with the
+//! walk that build steps wrote by hand before it existed: a recursive visit
+//! of every node that copies out block contents and attributes as Strings.
+//! Both start from the same parsed trees, so only the extraction is timed.
+
+use std::fs;
+use std::path::{Path, PathBuf};
+
+use criterion::{criterion_group, criterion_main, Criterion, Throughput};
+use tree_sitter::{Node, Parser, Tree};
+use tree_sitter_vue::Descriptor;
+
+#[allow(dead_code)]
+struct OwnedBlock {
+    kind: String,
+    content: String,
+    attributes: Vec<(String, Option<String>)>,
+}
+
+fn manual_walk(node: Node, source: &[u8], depth: usize, blocks: &mut Vec<OwnedBlock>) {
+    let kind = node.kind();
+    if depth == 1 && kind.ends_with("element") {
+        let mut block = OwnedBlock {
+            kind: kind.to_string(),
+            content: String::new(),
+            attributes: Vec::new(),
+        };
+        for i in 0..node.child_count() {
+            let child = node.child(i).unwrap();
+            match child.kind() {
+                "start_tag" => {
+                    for j in 0..child.named_child_count() {
+                        let attribute = child.named_child(j).unwrap();
+                        if attribute.kind() != "attribute" {
+                            continue;
+                        }
+                        let name = attribute.named_child(0).unwrap();
+                        let value = attribute
+                            .named_child(1)
+                            .map(|value| value.named_child(0).unwrap_or(value));
+                        block.attributes.push((
+                            name.utf8_text(source).unwrap().to_string(),
+                            value.map(|value| value.utf8_text(source).unwrap().to_string()),
+                        ));
+                    }
+                }
+                "end_tag" => {}
+                _ => block.content += child.utf8_text(source).unwrap(),
+            }
+        }
+        blocks.push(block);
+    }
+    for i in 0..node.child_count() {
+        manual_walk(node.child(i).unwrap(), source, depth + 1, blocks);
+    }
+}
+
+fn vue_files(dir: &Path, files: &mut Vec<PathBuf>) {
+    for entry in fs::read_dir(dir).expect("run `npm run bench-corpus` first") {
+        let path = entry.unwrap().path();
+        if path.is_dir() {
+            vue_files(&path, files);
+        } else if path
+            .extension()
+            .map_or(false, |extension| extension == "vue")
+        {
+            files.push(path);
+        }
+    }
+}
+
+fn bench_descriptor(c: &mut Criterion) {
+    let root = Path::new(env!("CARGO_MANIFEST_DIR"));
+    let mut paths = vec![root.join("test/app.vue")];
+    vue_files(&root.join("bench-corpus"), &mut paths);
+    paths.sort();
+
+    let mut parser = Parser::new();
+    parser.set_language(tree_sitter_vue::language()).unwrap();
+    let files: Vec<(String, Tree)> = paths
+        .iter()
+        .map(|path| {
+            let source = fs::read_to_string(path).unwrap();
+            let tree = parser.parse(&source, None).unwrap();
+            (source, tree)
+        })
+        .collect();
+    let bytes: usize = files.iter().map(|(source, _)| source.len()).sum();
+
+    let mut group = c.benchmark_group("descriptor");
+    group.throughput(Throughput::Bytes(bytes as u64));
+    group.bench_function("from_tree", |b| {
+        b.iter(|| {
+            files
+                .iter()
+                .map(|(source, tree)| Descriptor::from_tree(tree, source).blocks.len())
+                .sum::<usize>()
+        })
+    });
+    group.bench_function("manual_walk", |b| {
+        b.iter(|| {
+            files
+                .iter()
+                .map(|(source, tree)| {
+                    let mut blocks = Vec::new();
+                    manual_walk(tree.root_node(), source.as_bytes(), 0, &mut blocks);
+                    blocks.len()
+                })
+                .sum::<usize>()
+        })
+    });
+    group.finish();
+}
+
+criterion_group!(benches, bench_descriptor);
+criterion_main!(benches);
@@ -0,0 +1,73 @@
+//! `cargo bench --features parallel` compares parsing `bench-corpus/` on one
+//! thread with `parse_files` on the rayon pool, and times `test/app.vue`
+//! alone. Both corpus benchmarks read the files from disk.
+
+use std::fs;
+use std::path::{Path, PathBuf};
+
+use criterion::{criterion_group, criterion_main, BenchmarkId, Criterion, Throughput};
+use rayon::iter::ParallelIterator;
+use tree_sitter::Parser;
+
+fn manifest_dir() -> &'static Path {
+    Path::new(env!("CARGO_MANIFEST_DIR"))
+}
+
+fn vue_files(dir: &Path, files: &mut Vec<PathBuf>) {
+    for entry in fs::read_dir(dir).expect("run `npm run bench-corpus` first") {
+        let path = entry.unwrap().path();
+        if path.is_dir() {
+            vue_files(&path, files);
+        } else if path
+            .extension()
+            .map_or(false, |extension| extension == "vue")
+        {
+            files.push(path);
+        }
+    }
+}
+
+fn new_parser() -> Parser {
+    let mut parser = Parser::new();
+    parser.set_language(tree_sitter_vue::language()).unwrap();
+    parser
+}
+
+fn bench_app(c: &mut Criterion) {
+    let source = fs::read(manifest_dir().join("test/app.vue")).unwrap();
+    let mut parser = new_parser();
+    let mut group = c.benchmark_group("app.vue");
+    group.throughput(Throughput::Bytes(source.len() as u64));
+    group.bench_function("parse", |b| b.iter(|| parser.parse(&source, None).unwrap()));
+    group.finish();
+}
+
+fn bench_corpus(c: &mut Criterion) {
+    let mut files = Vec::new();
+    vue_files(&manifest_dir().join("bench-corpus"), &mut files);
+    files.sort();
+    let bytes: u64 = files
+        .iter()
+        .map(|path| fs::metadata(path).unwrap().len())
+        .sum();
+
+    let mut group = c.benchmark_group("bench-corpus");
+    group.throughput(Throughput::Bytes(bytes));
+    group.sample_size(20);
+    group.bench_function(BenchmarkId::new("sequential", files.len()), |b| {
+        let mut parser = new_parser();
+        b.iter(|| {
+            for path in &files {
+                let source = fs::read(path).unwrap();
+                parser.parse(&source, None).unwrap();
+            }
+        })
+    });
+    group.bench_function(BenchmarkId::new("parse_files", files.len()), |b| {
+        b.iter(|| tree_sitter_vue::parse_files(files.clone()).count())
+    });
+    group.finish();
+}
+
+criterion_group!(benches, bench_app, bench_corpus);
+criterion_main!(benches);
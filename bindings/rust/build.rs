@@ -1,38 +1,85 @@
+#[path = "generate_nodes.rs"]
+mod generate_nodes;
+
 fn main() {
     let src_dir = std::path::Path::new("src");
 
+    // The external scanner is C; it includes the HTML scanner, which is C as
+    // well despite its `.cc` extension.
     let mut c_config = cc::Build::new();
     c_config.include(&src_dir);
     c_config
+        .flag_if_supported("-std=c11")
         .flag_if_supported("-Wno-unused-parameter")
         .flag_if_supported("-Wno-unused-but-set-variable")
         .flag_if_supported("-Wno-trigraphs");
     let parser_path = src_dir.join("parser.c");
-    c_config.file(&parser_path);
-
-    // If your language uses an external scanner written in C,
-    // then include this block of code:
-
-    /*
     let scanner_path = src_dir.join("scanner.c");
+    c_config.file(&parser_path);
     c_config.file(&scanner_path);
-    println!("cargo:rerun-if-changed={}", scanner_path.to_str().unwrap());
-    */
-
     c_config.compile("parser");
-    println!("cargo:rerun-if-changed={}", parser_path.to_str().unwrap());
 
-    // If your language uses an external scanner written in C++,
-    // then include this block of code:
+    for path in [
+        parser_path.clone(),
+        scanner_path,
+        src_dir.join("tree_sitter_html").join("scanner.cc"),
+        src_dir.join("tree_sitter_html").join("tag.h"),
+        src_dir.join("scanner_stats.h"),
+    ] {
+        println!("cargo:rerun-if-changed={}", path.to_str().unwrap());
+    }
 
-    let mut cpp_config = cc::Build::new();
-    cpp_config.cpp(true);
-    cpp_config.include(&src_dir);
-    cpp_config
-        .flag_if_supported("-Wno-unused-parameter")
-        .flag_if_supported("-Wno-unused-but-set-variable");
-    let scanner_path = src_dir.join("scanner.cc");
-    cpp_config.file(&scanner_path);
-    cpp_config.compile("scanner");
-    println!("cargo:rerun-if-changed={}", scanner_path.to_str().unwrap());
+    let node_types_path = src_dir.join("node-types.json");
+    let out_dir = std::path::PathBuf::from(std::env::var("OUT_DIR").unwrap());
+    let (nodes, missing) = generate_nodes::generate(
+        &std::fs::read_to_string(&node_types_path).unwrap(),
+        &symbol_table(src_dir, &out_dir),
+    );
+    if !missing.is_empty() {
+        panic!(
+            "{} in node-types.json but not in parser.c; run `tree-sitter generate`",
+            missing.join(", ")
+        );
+    }
+    std::fs::write(out_dir.join("nodes.rs"), nodes).unwrap();
+    println!(
+        "cargo:rerun-if-changed={}",
+        node_types_path.to_str().unwrap()
+    );
+    println!("cargo:rerun-if-changed=bindings/rust/generate_nodes.rs");
+    println!("cargo:rerun-if-changed=bindings/rust/symbols.c");
+}
+
+// Builds symbols.c with parser.c and scanner.c for the host and runs it, so
+// that generate_nodes.rs gets the IDs from the compiled language.
+fn symbol_table(src_dir: &std::path::Path, out_dir: &std::path::Path) -> String {
+    let host = std::env::var("HOST").unwrap();
+    let compiler = cc::Build::new()
+        .target(&host)
+        .host(&host)
+        .opt_level(0)
+        .cargo_metadata(false)
+        .get_compiler();
+    let exe = out_dir.join("symbols");
+    let mut command = compiler.to_command();
+    command
+        .arg(format!("-I{}", src_dir.to_str().unwrap()))
+        .arg("bindings/rust/symbols.c")
+        .arg(src_dir.join("parser.c"))
+        .arg(src_dir.join("scanner.c"));
+    if compiler.is_like_msvc() {
+        command
+            .arg(format!("/Fe{}", exe.to_str().unwrap()))
+            .arg(format!("/Fo{}\\", out_dir.to_str().unwrap()));
+    } else {
+        command.arg("-o").arg(&exe);
+    }
+    let status = command.status().expect("could not run the host C compiler");
+    assert!(status.success(), "could not build symbols.c for the host");
+
+    let output = std::process::Command::new(&exe)
+        .output()
+        .expect("could not run symbols");
+    assert!(output.status.success(), "symbols failed");
+    String::from_utf8(output.stdout).unwrap()
 }
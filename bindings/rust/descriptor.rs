@@ -0,0 +1,243 @@
+use std::ops::Range;
+
+use tree_sitter::{Node, Parser, Tree, TreeCursor};
+
+/// The top-level blocks of a single-file component, borrowed from its source.
+///
+/// Only the top level of the tree is visited, and every string is a slice of
+/// `source`, so building a descriptor allocates the block and attribute
+/// vectors and nothing else.
+///
+/// ```
+/// let source = r#"<script setup lang="ts">const a = 1</script><style scoped>a {}</style>"#;
+/// let mut parser = tree_sitter::Parser::new();
+/// parser.set_language(tree_sitter_vue::language()).unwrap();
+/// let descriptor = tree_sitter_vue::Descriptor::parse(&mut parser, source).unwrap();
+///
+/// let script = descriptor.script_setup().unwrap();
+/// assert_eq!(script.lang, Some("ts"));
+/// assert_eq!(script.content, "const a = 1");
+/// assert!(descriptor.styles().all(|style| style.scoped));
+/// ```
+#[derive(Clone, Debug)]
+pub struct Descriptor<'src> {
+    pub source: &'src str,
+    /// Every block, in source order.
+    pub blocks: Vec<Block<'src>>,
+    /// Whether the tree has syntax errors anywhere, not only at the top level.
+    pub has_error: bool,
+}
+
+#[derive(Clone, Copy, Debug, PartialEq, Eq)]
+pub enum BlockKind {
+    Template,
+    Script,
+    Style,
+    /// Any other top-level element, such as `<i18n>` or `<docs>`.
+    Custom,
+}
+
+#[derive(Clone, Debug)]
+pub struct Block<'src> {
+    pub kind: BlockKind,
+    pub tag: &'src str,
+    /// The text between the start and end tags.
+    pub content: &'src str,
+    /// The whole element.
+    pub range: Range<usize>,
+    pub content_range: Range<usize>,
+    pub attributes: Vec<Attribute<'src>>,
+    /// The value of `lang`.
+    pub lang: Option<&'src str>,
+    /// Whether there is a `setup` attribute.
+    pub setup: bool,
+    /// Whether there is a `scoped` attribute.
+    pub scoped: bool,
+    /// Whether there is a `module` attribute; its value, if any, is the
+    /// name of the CSS module.
+    pub module: bool,
+}
+
+/// An attribute of a block's start tag, including directives such as
+/// `v-if` or `:key`.
+#[derive(Clone, Debug)]
+pub struct Attribute<'src> {
+    pub name: &'src str,
+    /// The value without its quotes; `None` for a bare attribute.
+    pub value: Option<&'src str>,
+    pub range: Range<usize>,
+}
+
+impl<'src> Descriptor<'src> {
+    /// Parses `source` with `parser`, which must have the Vue language.
+    /// Returns `None` only if the parser's timeout or cancellation flag
+    /// stopped it.
+    pub fn parse(parser: &mut Parser, source: &'src str) -> Option<Self> {
+        parser
+            .parse(source, None)
+            .map(|tree| Self::from_tree(&tree, source))
+    }
+
+    /// Describes a tree that was parsed from `source`.
+    pub fn from_tree(tree: &Tree, source: &'src str) -> Self {
+        let root = tree.root_node();
+        let mut cursor = root.walk();
+        let mut block_cursor = root.walk();
+        let mut blocks = Vec::new();
+        for node in root.named_children(&mut cursor) {
+            let kind = match node.kind() {
+                "template_element" => BlockKind::Template,
+                "script_element" => BlockKind::Script,
+                "style_element" => BlockKind::Style,
+                "element" => BlockKind::Custom,
+                _ => continue,
+            };
+            blocks.push(Block::new(kind, node, source, &mut block_cursor));
+        }
+        Descriptor {
+            source,
+            blocks,
+            has_error: root.has_error(),
+        }
+    }
+
+    /// The first `<template>`.
+    pub fn template(&self) -> Option<&Block<'src>> {
+        self.blocks
+            .iter()
+            .find(|block| block.kind == BlockKind::Template)
+    }
+
+    /// The first `<script>` without `setup`.
+    pub fn script(&self) -> Option<&Block<'src>> {
+        self.blocks
+            .iter()
+            .find(|block| block.kind == BlockKind::Script && !block.setup)
+    }
+
+    /// The first `<script setup>`.
+    pub fn script_setup(&self) -> Option<&Block<'src>> {
+        self.blocks
+            .iter()
+            .find(|block| block.kind == BlockKind::Script && block.setup)
+    }
+
+    pub fn styles(&self) -> impl Iterator<Item = &Block<'src>> {
+        self.blocks
+            .iter()
+            .filter(|block| block.kind == BlockKind::Style)
+    }
+
+    pub fn custom_blocks(&self) -> impl Iterator<Item = &Block<'src>> {
+        self.blocks
+            .iter()
+            .filter(|block| block.kind == BlockKind::Custom)
+    }
+}
+
+impl<'src> Block<'src> {
+    fn new<'tree>(
+        kind: BlockKind,
+        node: Node<'tree>,
+        source: &'src str,
+        cursor: &mut TreeCursor<'tree>,
+    ) -> Self {
+        let mut start_tag = None;
+        let mut end_tag = None;
+        let mut raw_text = None;
+        cursor.reset(node);
+        for child in node.children(cursor) {
+            match child.kind() {
+                "start_tag" | "self_closing_tag" => start_tag = Some(child),
+                "end_tag" => end_tag = Some(child),
+                "raw_text" => raw_text = Some(child),
+                _ => {}
+            }
+        }
+
+        // A missing end tag leaves the content running to the end of the
+        // element; a self-closing tag leaves it empty.
+        let content_range = match (raw_text, start_tag, end_tag) {
+            (Some(raw_text), _, _) => raw_text.byte_range(),
+            (None, Some(start_tag), Some(end_tag)) => start_tag.end_byte()..end_tag.start_byte(),
+            (None, Some(start_tag), None) => start_tag.end_byte()..node.end_byte(),
+            (None, None, _) => node.end_byte()..node.end_byte(),
+        };
+
+        let mut tag = "";
+        let mut attributes = Vec::new();
+        if let Some(start_tag) = start_tag {
+            cursor.reset(start_tag);
+            for child in start_tag.named_children(cursor) {
+                match child.kind() {
+                    "tag_name" => tag = &source[child.byte_range()],
+                    "attribute" | "directive_attribute" => {
+                        attributes.push(Attribute::new(child, source))
+                    }
+                    _ => {}
+                }
+            }
+        }
+
+        let has = |name: &str| attributes.iter().any(|attribute| attribute.name == name);
+        let lang = attributes
+            .iter()
+            .find(|attribute| attribute.name == "lang")
+            .and_then(|attribute| attribute.value);
+        let setup = has("setup");
+        let scoped = has("scoped");
+        let module = has("module");
+
+        Block {
+            kind,
+            tag,
+            content: &source[content_range.clone()],
+            range: node.byte_range(),
+            content_range,
+            attributes,
+            lang,
+            setup,
+            scoped,
+            module,
+        }
+    }
+
+    /// The first attribute called `name`.
+    pub fn attribute(&self, name: &str) -> Option<&Attribute<'src>> {
+        self.attributes
+            .iter()
+            .find(|attribute| attribute.name == name)
+    }
+}
+
+impl<'src> Attribute<'src> {
+    // The name runs up to the `=`, so that a directive's name keeps its
+    // argument and modifiers, as in `@click.stop`.
+    fn new(node: Node, source: &'src str) -> Self {
+        let mut name_end = node.start_byte();
+        let mut seen_equals = false;
+        let mut value = None;
+        for i in 0..node.child_count() {
+            let child = node.child(i).unwrap();
+            match child.kind() {
+                "=" => seen_equals = true,
+                "attribute_value" => value = Some(child.byte_range()),
+                "quoted_attribute_value" => {
+                    // `""` has no attribute_value inside.
+                    let after_quote = child.start_byte() + 1;
+                    value = Some(match child.named_child(0) {
+                        Some(value) => value.byte_range(),
+                        None => after_quote..after_quote,
+                    });
+                }
+                _ if !seen_equals => name_end = child.end_byte(),
+                _ => {}
+            }
+        }
+        Attribute {
+            name: &source[node.start_byte()..name_end],
+            value: value.map(|range| &source[range]),
+            range: node.byte_range(),
+        }
+    }
+}
@@ -0,0 +1,249 @@
+//! Generates the typed wrappers of `nodes.rs` from `src/node-types.json`.
+//!
+//! Kind IDs are resolved from the symbol table that `symbols.c` prints from
+//! the compiled language, the way `ts_language_symbol_for_name` resolves them
+//! at run time, so that they can be `const`s and kind checks are integer
+//! compares.
+
+use std::collections::{BTreeSet, HashMap};
+use std::fmt::Write;
+
+use serde_json::Value;
+
+struct Symbol {
+    name: String,
+    visible: bool,
+    named: bool,
+    supertype: bool,
+    public: u16,
+}
+
+// Each line of the table is `public_id visible named supertype name`, in
+// symbol order, with `\n` and `\\` escaped in the name.
+fn read_symbols(table: &str) -> Vec<Symbol> {
+    table
+        .lines()
+        .map(|line| {
+            let columns: Vec<&str> = line.splitn(5, ' ').collect();
+            assert_eq!(columns.len(), 5, "bad symbol table line {:?}", line);
+            let mut name = String::new();
+            let mut chars = columns[4].chars();
+            while let Some(c) = chars.next() {
+                // `\\` reads back as the backslash it starts with.
+                if c == '\\' && chars.next() == Some('n') {
+                    name.push('\n');
+                } else {
+                    name.push(c);
+                }
+            }
+            Symbol {
+                name,
+                visible: columns[1] == "1",
+                named: columns[2] == "1",
+                supertype: columns[3] == "1",
+                public: columns[0].parse().expect("bad symbol ID"),
+            }
+        })
+        .collect()
+}
+
+fn kind_id(symbols: &[Symbol], name: &str) -> Option<u16> {
+    symbols
+        .iter()
+        .find(|symbol| (symbol.visible || symbol.supertype) && symbol.named && symbol.name == name)
+        .map(|symbol| symbol.public)
+}
+
+// `directive_attribute` → `DirectiveAttribute`; supertypes such as `_node`
+// become `AnyNode`.
+fn type_name(kind: &str) -> String {
+    let mut name = String::new();
+    if kind.starts_with('_') {
+        name.push_str("Any");
+    }
+    for word in kind.split('_').filter(|word| !word.is_empty()) {
+        name.push_str(&word[..1].to_uppercase());
+        name.push_str(&word[1..]);
+    }
+    name
+}
+
+fn method_name(kind: &str) -> String {
+    match kind.strip_prefix('_') {
+        Some(kind) => format!("any_{}", kind),
+        None => kind.to_string(),
+    }
+}
+
+/// Returns the generated code and the kinds that `node-types.json` lists but
+/// the parser does not have, which means `parser.c` is older than
+/// `node-types.json`.
+pub fn generate(node_types_json: &str, symbol_table: &str) -> (String, Vec<String>) {
+    let symbols = read_symbols(symbol_table);
+    let node_types: Vec<Value> = serde_json::from_str(node_types_json).unwrap();
+    let named: Vec<&Value> = node_types
+        .iter()
+        .filter(|node_type| node_type["named"] == true)
+        .collect();
+
+    let mut ids = HashMap::new();
+    let mut missing = Vec::new();
+    for node_type in &named {
+        let kind = node_type["type"].as_str().unwrap();
+        if node_type["subtypes"].is_array() {
+            continue;
+        }
+        match kind_id(&symbols, kind) {
+            Some(id) => {
+                ids.insert(kind, id);
+            }
+            None => missing.push(kind.to_string()),
+        }
+    }
+    // Supertypes are always generated; their children need not be.
+    let exists = |kind: &str| kind.starts_with('_') || ids.contains_key(kind);
+
+    let mut out = String::new();
+    let mut kind_ids = Vec::new();
+    for node_type in &named {
+        let kind = node_type["type"].as_str().unwrap();
+        let name = type_name(kind);
+
+        if let Some(subtypes) = node_type["subtypes"].as_array() {
+            let subtypes: Vec<String> = subtypes
+                .iter()
+                .map(|subtype| subtype["type"].as_str().unwrap())
+                .filter(|subtype| exists(subtype))
+                .map(type_name)
+                .collect();
+            writeln!(out, "/// One of the `{}` subtypes.", kind).unwrap();
+            writeln!(out, "#[derive(Clone, Copy, Debug, PartialEq, Eq)]").unwrap();
+            writeln!(out, "pub enum {}<'tree> {{", name).unwrap();
+            for subtype in &subtypes {
+                writeln!(out, "    {0}({0}<'tree>),", subtype).unwrap();
+            }
+            writeln!(out, "}}\n").unwrap();
+            writeln!(out, "impl<'tree> AstNode<'tree> for {}<'tree> {{", name).unwrap();
+            writeln!(out, "    fn can_cast(kind_id: u16) -> bool {{").unwrap();
+            let ids: Vec<String> = subtypes
+                .iter()
+                .map(|subtype| format!("{}::KIND_ID", subtype))
+                .collect();
+            writeln!(out, "        matches!(kind_id, {})", ids.join(" | ")).unwrap();
+            writeln!(out, "    }}\n").unwrap();
+            writeln!(out, "    fn cast(node: Node<'tree>) -> Option<Self> {{").unwrap();
+            writeln!(out, "        match node.kind_id() {{").unwrap();
+            for subtype in &subtypes {
+                writeln!(
+                    out,
+                    "            {0}::KIND_ID => Some(Self::{0}({0}(node))),",
+                    subtype
+                )
+                .unwrap();
+            }
+            writeln!(out, "            _ => None,").unwrap();
+            writeln!(out, "        }}").unwrap();
+            writeln!(out, "    }}\n").unwrap();
+            writeln!(out, "    fn node(&self) -> Node<'tree> {{").unwrap();
+            writeln!(out, "        match self {{").unwrap();
+            for subtype in &subtypes {
+                writeln!(out, "            Self::{}(node) => node.node(),", subtype).unwrap();
+            }
+            writeln!(out, "        }}").unwrap();
+            writeln!(out, "    }}").unwrap();
+            writeln!(out, "}}\n").unwrap();
+            continue;
+        }
+
+        let id = match ids.get(kind) {
+            Some(&id) => id,
+            None => continue,
+        };
+        kind_ids.push((kind, id));
+        writeln!(out, "/// A `{}` node.", kind).unwrap();
+        writeln!(out, "#[derive(Clone, Copy, Debug, PartialEq, Eq)]").unwrap();
+        writeln!(out, "#[repr(transparent)]").unwrap();
+        writeln!(out, "pub struct {}<'tree>(Node<'tree>);\n", name).unwrap();
+        writeln!(out, "impl<'tree> {}<'tree> {{", name).unwrap();
+        writeln!(out, "    pub const KIND: &'static str = {:?};", kind).unwrap();
+        writeln!(out, "    pub const KIND_ID: u16 = {};", id).unwrap();
+
+        // One accessor for the first child of each type, and one iterator
+        // over all of them when there can be several.
+        let children = &node_type["children"];
+        let child_kinds: BTreeSet<&str> = children["types"]
+            .as_array()
+            .map(|types| {
+                types
+                    .iter()
+                    .filter(|child| child["named"] == true)
+                    .map(|child| child["type"].as_str().unwrap())
+                    .filter(|child| exists(child))
+                    .collect()
+            })
+            .unwrap_or_default();
+        for child_kind in child_kinds {
+            let child = type_name(child_kind);
+            let method = method_name(child_kind);
+            writeln!(out).unwrap();
+            writeln!(out, "    /// The first `{}` child.", child_kind).unwrap();
+            writeln!(
+                out,
+                "    pub fn {}(&self, cursor: &mut TreeCursor<'tree>) -> Option<{}<'tree>> {{",
+                method, child
+            )
+            .unwrap();
+            writeln!(out, "        cursor.reset(self.0);").unwrap();
+            writeln!(
+                out,
+                "        self.0.named_children(cursor).find_map({}::cast)",
+                child
+            )
+            .unwrap();
+            writeln!(out, "    }}").unwrap();
+            if children["multiple"] == true {
+                writeln!(out).unwrap();
+                writeln!(out, "    /// Every `{}` child.", child_kind).unwrap();
+                writeln!(
+                    out,
+                    "    pub fn {}_children<'a>(&self, cursor: &'a mut TreeCursor<'tree>) -> impl Iterator<Item = {}<'tree>> + 'a {{",
+                    method, child
+                )
+                .unwrap();
+                writeln!(out, "        cursor.reset(self.0);").unwrap();
+                writeln!(
+                    out,
+                    "        self.0.named_children(cursor).filter_map({}::cast)",
+                    child
+                )
+                .unwrap();
+                writeln!(out, "    }}").unwrap();
+            }
+        }
+        writeln!(out, "}}\n").unwrap();
+
+        writeln!(out, "impl<'tree> AstNode<'tree> for {}<'tree> {{", name).unwrap();
+        writeln!(out, "    fn can_cast(kind_id: u16) -> bool {{").unwrap();
+        writeln!(out, "        kind_id == Self::KIND_ID").unwrap();
+        writeln!(out, "    }}\n").unwrap();
+        writeln!(out, "    fn cast(node: Node<'tree>) -> Option<Self> {{").unwrap();
+        writeln!(out, "        if node.kind_id() == Self::KIND_ID {{").unwrap();
+        writeln!(out, "            Some(Self(node))").unwrap();
+        writeln!(out, "        }} else {{").unwrap();
+        writeln!(out, "            None").unwrap();
+        writeln!(out, "        }}").unwrap();
+        writeln!(out, "    }}\n").unwrap();
+        writeln!(out, "    fn node(&self) -> Node<'tree> {{").unwrap();
+        writeln!(out, "        self.0").unwrap();
+        writeln!(out, "    }}").unwrap();
+        writeln!(out, "}}\n").unwrap();
+    }
+
+    writeln!(out, "/// Every concrete named kind with its ID.").unwrap();
+    writeln!(out, "pub const KIND_IDS: &[(&str, u16)] = &[").unwrap();
+    for (kind, id) in kind_ids {
+        writeln!(out, "    ({:?}, {}),", kind, id).unwrap();
+    }
+    writeln!(out, "];").unwrap();
+    (out, missing)
+}
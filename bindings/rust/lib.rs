@@ -1,15 +1,27 @@
-//! This crate provides YOUR_LANGUAGE_NAME language support for the [tree-sitter][] parsing library.
+//! This crate provides Vue language support for the [tree-sitter][] parsing library.
 //!
 //! Typically, you will use the [language][language func] function to add this language to a
 //! tree-sitter [Parser][], and then use the parser to parse some code:
 //!
 //! ```
-//! let code = "";
+//! let code = "<template><div>{{ message }}</div></template>";
 //! let mut parser = tree_sitter::Parser::new();
-//! parser.set_language(tree_sitter_vue::language()).expect("Error loading YOUR_LANGUAGE_NAME grammar");
+//! parser.set_language(tree_sitter_vue::language()).expect("Error loading vue grammar");
 //! let tree = parser.parse(code, None).unwrap();
 //! ```
 //!
+//! [Descriptor][] describes a component's top-level blocks without copying them:
+//!
+//! ```
+//! let code = "<template><div/></template><style scoped lang=\"scss\">a {}</style>";
+//! let mut parser = tree_sitter::Parser::new();
+//! parser.set_language(tree_sitter_vue::language()).unwrap();
+//! let descriptor = tree_sitter_vue::Descriptor::parse(&mut parser, code).unwrap();
+//! assert_eq!(descriptor.styles().next().unwrap().lang, Some("scss"));
+//! ```
+//!
+//! With the `parallel` feature, `parse_files` parses many files on the rayon thread pool.
+//!
 //! [Language]: https://docs.rs/tree-sitter/*/tree_sitter/struct.Language.html
 //! [language func]: fn.language.html
 //! [Parser]: https://docs.rs/tree-sitter/*/tree_sitter/struct.Parser.html
@@ -17,15 +29,25 @@
 
 use tree_sitter::Language;
 
+mod descriptor;
+pub use descriptor::{Attribute, Block, BlockKind, Descriptor};
+
+pub mod nodes;
+
+#[cfg(feature = "parallel")]
+mod parallel;
+#[cfg(feature = "parallel")]
+pub use parallel::{parse_files, ParsedFile};
+
 extern "C" {
-    fn tree_sitter_vue() -> Language;
+    fn tree_sitter_vue3() -> Language;
 }
 
 /// Get the tree-sitter [Language][] for this grammar.
 ///
 /// [Language]: https://docs.rs/tree-sitter/*/tree_sitter/struct.Language.html
 pub fn language() -> Language {
-    unsafe { tree_sitter_vue() }
+    unsafe { tree_sitter_vue3() }
 }
 
 /// The content of the [`node-types.json`][] file for this grammar.
@@ -49,4 +71,72 @@ mod tests {
             .set_language(super::language())
             .expect("Error loading vue grammar");
     }
+
+    #[test]
+    fn test_can_parse_with_scanner() {
+        let mut parser = tree_sitter::Parser::new();
+        parser.set_language(super::language()).unwrap();
+        let tree = parser
+            .parse("<template><div>{{ a }}</div></template>", None)
+            .unwrap();
+        assert!(!tree.root_node().has_error());
+    }
+
+    #[test]
+    fn test_node_kind_ids() {
+        let language = super::language();
+        for &(kind, id) in super::nodes::KIND_IDS {
+            assert_eq!(language.id_for_node_kind(kind, true), id, "{}", kind);
+        }
+    }
+
+    #[test]
+    fn test_descriptor() {
+        let source = concat!(
+            "<template><div :class=\"a\">{{ b }}</div></template>\n",
+            "<script>export default {}</script>\n",
+            "<script setup lang=\"ts\">const c = 1</script>\n",
+            "<style module=\"classes\">.d {}</style>\n",
+            "<i18n lang=\"json\">{}</i18n>\n",
+        );
+        let mut parser = tree_sitter::Parser::new();
+        parser.set_language(super::language()).unwrap();
+        let descriptor = super::Descriptor::parse(&mut parser, source).unwrap();
+        assert!(!descriptor.has_error);
+        assert_eq!(descriptor.blocks.len(), 5);
+
+        let template = descriptor.template().unwrap();
+        assert_eq!(template.content, "<div :class=\"a\">{{ b }}</div>");
+        assert_eq!(&source[template.content_range.clone()], template.content);
+        assert_eq!(descriptor.script().unwrap().content, "export default {}");
+
+        let setup = descriptor.script_setup().unwrap();
+        assert_eq!((setup.lang, setup.content), (Some("ts"), "const c = 1"));
+
+        let style = descriptor.styles().next().unwrap();
+        assert!(style.module && !style.scoped);
+        assert_eq!(style.attribute("module").unwrap().value, Some("classes"));
+
+        let i18n = descriptor.custom_blocks().next().unwrap();
+        assert_eq!(
+            (i18n.tag, i18n.lang, i18n.content),
+            ("i18n", Some("json"), "{}")
+        );
+    }
+
+    #[cfg(feature = "parallel")]
+    #[test]
+    fn test_parse_files() {
+        use rayon::iter::ParallelIterator;
+
+        let app = concat!(env!("CARGO_MANIFEST_DIR"), "/test/app.vue");
+        let results: Vec<_> = super::parse_files(vec![app; 8]).collect();
+        assert_eq!(results.len(), 8);
+        for (path, file) in results {
+            assert!(path.ends_with("app.vue"));
+            let file = file.unwrap();
+            assert!(!file.source.is_empty());
+            assert!(file.tree.root_node().child_count() > 0);
+        }
+    }
 }
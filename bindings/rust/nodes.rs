@@ -0,0 +1,45 @@
+//! Typed wrappers for the named node types in `src/node-types.json`,
+//! generated at build time.
+//!
+//! Each concrete type is a `Node` with a `KIND_ID` constant, so casting is
+//! an integer compare and costs nothing once it succeeds. Supertypes such as
+//! `_node` are enums of their subtypes. Child accessors take a `TreeCursor`
+//! to walk with, as `Node::children` does:
+//!
+//! ```
+//! use tree_sitter_vue::nodes::{AnyNode, AstNode, Component};
+//!
+//! let source = "<template><div v-if=\"a\"><p/></div></template>";
+//! let mut parser = tree_sitter::Parser::new();
+//! parser.set_language(tree_sitter_vue::language()).unwrap();
+//! let tree = parser.parse(source, None).unwrap();
+//!
+//! let mut cursor = tree.walk();
+//! let component = Component::cast(tree.root_node()).unwrap();
+//! let template = component.template_element(&mut cursor).unwrap();
+//! let div = template
+//!     .any_node_children(&mut cursor)
+//!     .find_map(|node| match node {
+//!         AnyNode::Element(element) => Some(element),
+//!         _ => None,
+//!     })
+//!     .unwrap();
+//! let start_tag = div.start_tag(&mut cursor).unwrap();
+//! let tag_name = start_tag.tag_name(&mut cursor).unwrap();
+//! assert_eq!(tag_name.node().utf8_text(source.as_bytes()), Ok("div"));
+//! assert_eq!(start_tag.any_attribute_children(&mut cursor).count(), 1);
+//! ```
+
+use tree_sitter::{Node, TreeCursor};
+
+/// A typed view of a node.
+pub trait AstNode<'tree>: Sized {
+    /// Whether nodes with this kind ID can be cast to `Self`.
+    fn can_cast(kind_id: u16) -> bool;
+
+    fn cast(node: Node<'tree>) -> Option<Self>;
+
+    fn node(&self) -> Node<'tree>;
+}
+
+include!(concat!(env!("OUT_DIR"), "/nodes.rs"));
@@ -0,0 +1,63 @@
+use std::cell::RefCell;
+use std::fs;
+use std::io;
+use std::path::PathBuf;
+
+use rayon::iter::{IntoParallelIterator, ParallelIterator};
+use tree_sitter::{Parser, Tree};
+
+/// A file parsed by [parse_files][]. `tree` indexes into `source`.
+///
+/// [parse_files]: fn.parse_files.html
+pub struct ParsedFile {
+    pub source: Vec<u8>,
+    pub tree: Tree,
+}
+
+thread_local! {
+    // One parser per rayon worker thread, kept for the life of the thread so
+    // that every batch after the first reuses its allocations.
+    static PARSER: RefCell<Parser> = RefCell::new({
+        let mut parser = Parser::new();
+        parser
+            .set_language(crate::language())
+            .expect("Error loading vue grammar");
+        parser
+    });
+}
+
+/// Reads and parses `paths` on the current rayon thread pool.
+///
+/// Each path is paired with its source and tree, or with the error that
+/// kept it from being read. Results arrive in no particular order unless the
+/// iterator is collected, which keeps the order of `paths`.
+///
+/// ```no_run
+/// use rayon::iter::ParallelIterator;
+///
+/// let paths = vec!["src/App.vue", "src/components/Button.vue"];
+/// let errors = tree_sitter_vue::parse_files(paths)
+///     .filter(|(_, file)| match file {
+///         Ok(file) => file.tree.root_node().has_error(),
+///         Err(_) => true,
+///     })
+///     .count();
+/// ```
+pub fn parse_files<I, P>(
+    paths: I,
+) -> impl ParallelIterator<Item = (PathBuf, io::Result<ParsedFile>)>
+where
+    I: IntoParallelIterator<Item = P>,
+    P: Into<PathBuf>,
+{
+    paths.into_par_iter().map(|path| {
+        let path = path.into();
+        let file = fs::read(&path).map(|source| {
+            let tree = PARSER
+                .with(|parser| parser.borrow_mut().parse(&source, None))
+                .expect("parsing without a timeout or cancellation flag always returns a tree");
+            ParsedFile { source, tree }
+        });
+        (path, file)
+    })
+}
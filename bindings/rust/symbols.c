@@ -0,0 +1,33 @@
+// Prints the symbol table of the compiled language, one symbol per line in ID
+// order, for generate_nodes.rs:
+//
+//   public_id visible named supertype name
+//
+// build.rs compiles it for the host together with parser.c and scanner.c, so
+// the IDs come from the parser itself rather than from its source text.
+
+#include <stdio.h>
+#include <tree_sitter/parser.h>
+
+const TSLanguage *tree_sitter_vue3(void);
+
+int main(void) {
+  const TSLanguage *language = tree_sitter_vue3();
+  uint32_t count = language->symbol_count + language->alias_count;
+  for (uint32_t id = 0; id < count; id++) {
+    TSSymbolMetadata metadata = language->symbol_metadata[id];
+    printf("%u %d %d %d ", (unsigned)language->public_symbol_map[id], metadata.visible, metadata.named,
+           metadata.supertype);
+    for (const char *c = language->symbol_names[id]; *c; c++) {
+      if (*c == '\n') {
+        fputs("\\n", stdout);
+      } else if (*c == '\\') {
+        fputs("\\\\", stdout);
+      } else {
+        putchar(*c);
+      }
+    }
+    putchar('\n');
+  }
+  return 0;
+}
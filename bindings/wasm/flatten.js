@@ -0,0 +1,33 @@
+// Flattens a web-tree-sitter tree into the layout that
+// bindings/node/flat_tree.h describes, so that a worker can transfer the
+// buffer and the receiver can read it with FlatTree without parsing again.
+
+const {
+  flattenCursor,
+  FlatTree,
+  layout: { NONE, ERROR_SYMBOL, NAMED, MISSING, HAS_ERROR },
+} = require("../node/flat_tree");
+
+// The cursor of web-tree-sitter 0.20 does not tell whether a node is extra,
+// so EXTRA is never set. This grammar's only extra is whitespace, which makes
+// no nodes. HAS_ERROR is worked out from the ERROR and MISSING nodes.
+function webTreeSitterFlags(cursor) {
+  return (cursor.nodeIsNamed ? NAMED : 0) | (cursor.nodeIsMissing ? MISSING : 0);
+}
+
+function flattenWebTree(tree) {
+  const buffer = flattenCursor(tree.walk(), webTreeSitterFlags, ArrayBuffer);
+
+  // Children come after their parents, so one backward pass carries errors
+  // up to the root.
+  const { nodeCount, types, flags, parents } = new FlatTree(buffer, []);
+  for (let i = nodeCount - 1; i >= 0; i--) {
+    if (types[i] === ERROR_SYMBOL || flags[i] & (MISSING | HAS_ERROR)) {
+      flags[i] |= HAS_ERROR;
+      if (parents[i] !== NONE) flags[parents[i]] |= HAS_ERROR;
+    }
+  }
+  return buffer;
+}
+
+module.exports = { flattenWebTree };
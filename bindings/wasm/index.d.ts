@@ -0,0 +1,41 @@
+type FlatTree = ReturnType<typeof import("../node")["openFlatTree"]>;
+
+/** Anything with postMessage and terminate: a Node or a Web Worker. */
+type PoolWorker = {
+  postMessage(message: unknown): void;
+  terminate(): unknown;
+};
+
+type ParserPoolOptions = {
+  /**
+   * Path or URL of the grammar. In Node, defaults to the checked-in
+   * tree-sitter-vue3.wasm.
+   */
+  wasm?: string;
+  /** Defaults to the number of CPUs. */
+  size?: number;
+  /** Defaults to a worker_threads Worker running worker.js. */
+  createWorker?: () => PoolWorker;
+};
+
+type PoolParseResult = {
+  hasError: boolean;
+  /** The flat tree, for openFlatTree(); absent if `flatten` was false. */
+  tree?: ArrayBuffer;
+};
+
+export declare class ParserPool {
+  private constructor();
+  readonly size: number;
+  /** Type names by symbol id. */
+  readonly symbolNames: string[];
+  parse(source: string, options?: { flatten?: boolean }): Promise<PoolParseResult>;
+  openFlatTree(buffer: ArrayBuffer): FlatTree;
+  /** Terminates the workers and rejects the parses still waiting. */
+  close(): Promise<unknown>;
+}
+
+export declare function createParserPool(options?: ParserPoolOptions): Promise<ParserPool>;
+
+/** Flattens a web-tree-sitter tree into the layout of openFlatTree(). */
+export declare function flattenWebTree(tree: unknown): ArrayBuffer;
@@ -0,0 +1,7 @@
+// The WebAssembly build of the grammar, parsed on a pool of workers. See
+// script/build-wasm.js for the builds and bench/wasm.js for their timings.
+
+const { createParserPool, ParserPool } = require("./pool");
+const { flattenWebTree } = require("./flatten");
+
+module.exports = { createParserPool, ParserPool, flattenWebTree };
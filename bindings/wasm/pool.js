@@ -0,0 +1,141 @@
+// Spreads parses over a pool of workers, each with its own web-tree-sitter
+// parser. Trees cannot leave a worker, so each parse comes back as the
+// flat tree buffer of bindings/node/flat_tree.h, transferred without a copy,
+// or only as whether it has errors.
+
+const { FlatTree } = require("../node/flat_tree");
+
+function defaultWasm() {
+  const path = require("path");
+  return path.resolve(__dirname, "..", "..", "tree-sitter-vue3.wasm");
+}
+
+function defaultSize() {
+  if (typeof navigator !== "undefined" && navigator.hardwareConcurrency) {
+    return navigator.hardwareConcurrency;
+  }
+  const os = require("os");
+  return os.availableParallelism ? os.availableParallelism() : os.cpus().length;
+}
+
+function createNodeWorker() {
+  const { Worker } = require("worker_threads");
+  return new Worker(require("path").join(__dirname, "worker.js"));
+}
+
+// Node's Worker is an EventEmitter and a Web Worker an EventTarget.
+function on(worker, type, listener) {
+  if (typeof worker.on === "function") {
+    worker.on(type, listener);
+  } else {
+    worker.addEventListener(type, (event) => listener(type === "message" ? event.data : event));
+  }
+}
+
+class ParserPool {
+  constructor(workers) {
+    this.workers = workers;
+    this.symbolNames = null;
+    this.idle = [];
+    this.queue = [];
+    this.jobs = new Map();
+    this.closed = false;
+  }
+
+  get size() {
+    return this.workers.length;
+  }
+
+  // Resolves to {hasError, tree}, where `tree` is an ArrayBuffer for
+  // openFlatTree(), or to {hasError} alone if `flatten` is false.
+  parse(source, { flatten = true } = {}) {
+    if (this.closed) return Promise.reject(new Error("the parser pool is closed"));
+    return new Promise((resolve, reject) => {
+      this.queue.push({ message: { type: "parse", source, flatten }, resolve, reject });
+      this.dispatch();
+    });
+  }
+
+  openFlatTree(buffer) {
+    return new FlatTree(buffer, this.symbolNames);
+  }
+
+  // Terminates the workers and rejects the parses still waiting.
+  close() {
+    this.closed = true;
+    const error = new Error("the parser pool is closed");
+    for (const job of this.queue) job.reject(error);
+    for (const job of this.jobs.values()) job.reject(error);
+    this.queue = [];
+    this.jobs.clear();
+    return Promise.all(this.workers.map((worker) => worker.terminate()));
+  }
+
+  dispatch() {
+    while (this.idle.length > 0 && this.queue.length > 0) {
+      const worker = this.idle.pop();
+      const job = this.queue.shift();
+      this.jobs.set(worker, job);
+      worker.postMessage(job.message);
+    }
+  }
+
+  settle(worker, settle) {
+    const job = this.jobs.get(worker);
+    if (!job) return;
+    this.jobs.delete(worker);
+    settle(job);
+  }
+
+  listen(worker) {
+    on(worker, "message", (message) => {
+      if (message.type === "error") {
+        this.settle(worker, (job) => job.reject(new Error(message.message)));
+      } else if (message.type === "ready") {
+        this.settle(worker, (job) => job.resolve(message));
+      } else {
+        this.settle(worker, (job) => job.resolve({ hasError: message.hasError, tree: message.tree }));
+      }
+      if (!this.closed) {
+        this.idle.push(worker);
+        this.dispatch();
+      }
+    });
+    // A worker that crashed does not come back to the pool.
+    on(worker, "error", (error) => {
+      this.settle(worker, (job) => job.reject(error));
+      this.workers = this.workers.filter((other) => other !== worker);
+      if (this.workers.length === 0) this.close();
+    });
+  }
+}
+
+// Starts `size` workers that load `wasm`, by default the checked-in
+// tree-sitter-vue3.wasm, and resolves once all of them are ready. A build
+// from script/build-wasm.js, such as the SIMD one, is only used when passed
+// as `wasm`, since not every engine can load it. In a browser, pass
+// `wasm` as a URL and `createWorker` returning a Web Worker that runs a
+// bundle of worker.js.
+async function createParserPool({ wasm, size, createWorker = createNodeWorker } = {}) {
+  wasm = wasm || defaultWasm();
+  size = size || defaultSize();
+  const workers = Array.from({ length: size }, () => createWorker());
+  const pool = new ParserPool(workers);
+  const ready = workers.map(
+    (worker) =>
+      new Promise((resolve, reject) => {
+        pool.jobs.set(worker, { resolve, reject });
+        pool.listen(worker);
+        worker.postMessage({ type: "init", wasm });
+      }),
+  );
+  try {
+    pool.symbolNames = (await Promise.all(ready))[0].symbolNames;
+  } catch (error) {
+    await pool.close();
+    throw error;
+  }
+  return pool;
+}
+
+module.exports = { createParserPool, ParserPool };
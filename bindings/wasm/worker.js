@@ -0,0 +1,55 @@
+// A pool worker: loads the grammar into web-tree-sitter and parses what
+// ParserPool sends it, one source at a time. It runs as a Node worker_threads
+// Worker or, bundled, as a Web Worker.
+
+const Parser = require("web-tree-sitter");
+const { flattenWebTree } = require("./flatten");
+
+let port = null;
+try {
+  port = require("worker_threads").parentPort;
+} catch (_) {}
+
+const post = port
+  ? (message, transfer) => port.postMessage(message, transfer)
+  : (message, transfer) => self.postMessage(message, transfer);
+const listen = port
+  ? (listener) => port.on("message", listener)
+  : (listener) => self.addEventListener("message", (event) => listener(event.data));
+
+let parser = null;
+
+async function init({ wasm }) {
+  await Parser.init();
+  const language = await Parser.Language.load(wasm);
+  parser = new Parser();
+  parser.setLanguage(language);
+  const symbolNames = [];
+  for (let i = 0; i < language.nodeTypeCount; i++) symbolNames.push(language.nodeTypeForId(i));
+  return { type: "ready", symbolNames };
+}
+
+function parse({ source, flatten }) {
+  const tree = parser.parse(source);
+  try {
+    const hasError = tree.rootNode.hasError();
+    if (!flatten) return [{ type: "result", hasError }, []];
+    const buffer = flattenWebTree(tree);
+    return [{ type: "result", hasError, tree: buffer }, [buffer]];
+  } finally {
+    tree.delete();
+  }
+}
+
+listen(async (message) => {
+  try {
+    if (message.type === "init") {
+      post(await init(message), []);
+    } else {
+      const [reply, transfer] = parse(message);
+      post(reply, transfer);
+    }
+  } catch (error) {
+    post({ type: "error", message: String((error && error.stack) || error) }, []);
+  }
+});
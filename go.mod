@@ -0,0 +1,3 @@
+module github.com/xiaoxin-sky/tree-sitter-vue
+
+go 1.18
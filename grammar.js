@@ -1,5 +1,5 @@
 module.exports = grammar({
-  name: "vue",
+  name: "vue3",
   externals: ($) => [
     $._text_fragment,
     $._interpolation_text,
@@ -17,6 +17,14 @@ module.exports = grammar({
 
   extras: ($) => [/\s+/],
 
+  // Built-in directives are keywords of `directive_name`, so they get their
+  // own symbols without adding states to the main lexer. Each one needs the
+  // same precedence as `directive_name`, or that token would always win and
+  // the keyword could never be produced.
+  word: ($) => $.directive_name,
+
+  supertypes: ($) => [$._node, $._attribute],
+
   rules: {
     component: ($) =>
       repeat(
@@ -72,7 +80,7 @@ module.exports = grammar({
       seq(
         "<",
         alias($._start_tag_name, $.tag_name),
-        repeat(choice($.attribute, $.directive_attribute)),
+        repeat($._attribute),
         ">"
       ),
 
@@ -80,7 +88,7 @@ module.exports = grammar({
       seq(
         "<",
         alias($._template_start_tag_name, $.tag_name),
-        repeat(choice($.attribute, $.directive_attribute)),
+        repeat($._attribute),
         ">"
       ),
 
@@ -88,7 +96,7 @@ module.exports = grammar({
       seq(
         "<",
         alias($._script_start_tag_name, $.tag_name),
-        repeat(choice($.attribute, $.directive_attribute)),
+        repeat($._attribute),
         ">"
       ),
 
@@ -96,7 +104,7 @@ module.exports = grammar({
       seq(
         "<",
         alias($._style_start_tag_name, $.tag_name),
-        repeat(choice($.attribute, $.directive_attribute)),
+        repeat($._attribute),
         ">"
       ),
 
@@ -104,7 +112,7 @@ module.exports = grammar({
       seq(
         "<",
         alias($._start_tag_name, $.tag_name),
-        repeat(choice($.attribute, $.directive_attribute)),
+        repeat($._attribute),
         "/>"
       ),
 
@@ -112,6 +120,8 @@ module.exports = grammar({
 
     erroneous_end_tag: ($) => seq("</", $.erroneous_end_tag_name, ">"),
 
+    _attribute: ($) => choice($.attribute, $.directive_attribute),
+
     attribute: ($) =>
       seq(
         $.attribute_name,
@@ -137,7 +147,7 @@ module.exports = grammar({
       seq(
         choice(
           seq(
-            $.directive_name,
+            $._directive_name,
             optional(
               seq(
                 token.immediate(prec(1, ":")),
@@ -153,6 +163,30 @@ module.exports = grammar({
         optional($.directive_modifiers),
         optional(seq("=", choice($.attribute_value, $.quoted_attribute_value)))
       ),
+    _directive_name: ($) =>
+      choice(
+        $.v_if,
+        $.v_else_if,
+        $.v_else,
+        $.v_for,
+        $.v_show,
+        $.v_model,
+        $.v_on,
+        $.v_bind,
+        $.v_slot,
+        $.v_html,
+        $.directive_name
+      ),
+    v_if: ($) => token(prec(1, "v-if")),
+    v_else_if: ($) => token(prec(1, "v-else-if")),
+    v_else: ($) => token(prec(1, "v-else")),
+    v_for: ($) => token(prec(1, "v-for")),
+    v_show: ($) => token(prec(1, "v-show")),
+    v_model: ($) => token(prec(1, "v-model")),
+    v_on: ($) => token(prec(1, "v-on")),
+    v_bind: ($) => token(prec(1, "v-bind")),
+    v_slot: ($) => token(prec(1, "v-slot")),
+    v_html: ($) => token(prec(1, "v-html")),
     directive_name: ($) => token(prec(1, /v-[^<>'"=/\s:.]+/)),
     directive_shorthand: ($) => token(prec(1, choice(":", "@", "#"))),
     directive_argument: ($) => token.immediate(/[^<>"'/=\s.]+/),
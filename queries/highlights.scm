@@ -27,6 +27,19 @@
   (directive_argument)
 ] @method
 
+[
+  (v_if)
+  (v_else_if)
+  (v_else)
+  (v_for)
+  (v_show)
+  (v_model)
+  (v_on)
+  (v_bind)
+  (v_slot)
+  (v_html)
+] @keyword
+
 "=" @operator
 
 [
@@ -0,0 +1,125 @@
+#!/usr/bin/env node
+// Builds the grammar to WebAssembly with each of PROFILES and records what
+// each build costs in size, in bench/wasm_sizes.json, which is checked in.
+// bench/wasm.js times them against the checked-in tree-sitter-vue3.wasm,
+// which is the `os` build.
+//
+//   node script/build-wasm.js [profile...]
+//
+// The compiler is emcc from the emscripten/emsdk image at EMSDK_VERSION, run
+// through docker, so that a build is reproducible byte for byte. Set
+// EMCC=emcc to use a local emsdk instead; the version is recorded either way.
+
+const { execFileSync } = require("child_process");
+const crypto = require("crypto");
+const fs = require("fs");
+const path = require("path");
+
+const root = path.resolve(__dirname, "..");
+const outputDir = path.join(root, "build", "wasm");
+const SIZES_PATH = path.join(root, "bench", "wasm_sizes.json");
+const CHECKED_IN = path.join(root, "tree-sitter-vue3.wasm");
+const EMSDK_VERSION = "3.1.29";
+
+// Only the grammar is compiled here; the runtime comes from web-tree-sitter.
+// `-flto` lets the linker inline across parser.c and the scanner, and drop
+// what tree_sitter_vue3() does not reach. `-msimd128` lets clang use vector
+// instructions where it can vectorize; engines without SIMD (Node < 16,
+// Safari < 16.4) fail to load that build, so the checked-in one stays scalar
+// and nothing loads the SIMD build unless asked to.
+const PROFILES = {
+  os: {
+    description: "-Os, as tree-sitter build-wasm builds tree-sitter-vue3.wasm",
+    flags: ["-Os"],
+    output: path.join(outputDir, "tree-sitter-vue3.os.wasm"),
+  },
+  o3: {
+    description: "-O3 with link-time optimization",
+    flags: ["-O3", "-flto"],
+    output: path.join(outputDir, "tree-sitter-vue3.o3.wasm"),
+  },
+  simd: {
+    description: "-O3 with link-time optimization and SIMD128",
+    flags: ["-O3", "-flto", "-msimd128"],
+    output: path.join(outputDir, "tree-sitter-vue3.simd.wasm"),
+  },
+};
+
+const COMMON_FLAGS = [
+  "-s", "WASM=1",
+  "-s", "SIDE_MODULE=2",
+  "-s", 'EXPORTED_FUNCTIONS=["_tree_sitter_vue3"]',
+  "-fno-exceptions",
+  "-I", "src",
+  "src/parser.c",
+  "src/scanner.c",
+];
+
+function emcc(args) {
+  if (process.env.EMCC) {
+    return execFileSync(process.env.EMCC, args, { cwd: root, encoding: "utf8" });
+  }
+  const user = process.getuid ? ["-u", `${process.getuid()}:${process.getgid()}`] : [];
+  return execFileSync(
+    "docker",
+    ["run", "--rm", "-v", `${root}:/src`, "-w", "/src", ...user, `emscripten/emsdk:${EMSDK_VERSION}`, "emcc", ...args],
+    { encoding: "utf8" },
+  );
+}
+
+function build(name) {
+  const profile = PROFILES[name];
+  const output = path.relative(root, profile.output);
+  const started = process.hrtime.bigint();
+  emcc(["-o", output, ...profile.flags, ...COMMON_FLAGS]);
+  const seconds = Number(process.hrtime.bigint() - started) / 1e9;
+  const contents = fs.readFileSync(profile.output);
+  return {
+    profile: name,
+    description: profile.description,
+    flags: profile.flags,
+    output,
+    bytes: contents.length,
+    sha256: crypto.createHash("sha256").update(contents).digest("hex"),
+    buildSeconds: Number(seconds.toFixed(1)),
+  };
+}
+
+function main() {
+  const names = process.argv.slice(2);
+  for (const name of names) {
+    if (!PROFILES[name]) {
+      console.error(`unknown profile ${name}; the profiles are ${Object.keys(PROFILES).join(", ")}`);
+      process.exit(1);
+    }
+  }
+  fs.mkdirSync(outputDir, { recursive: true });
+  const version = emcc(["--version"]).split("\n")[0];
+
+  const previous = fs.existsSync(SIZES_PATH) ? JSON.parse(fs.readFileSync(SIZES_PATH, "utf8")).builds : [];
+  const builds = previous.filter((entry) => PROFILES[entry.profile]);
+  for (const name of names.length ? names : Object.keys(PROFILES)) {
+    const entry = build(name);
+    console.log(`${name.padEnd(5)} ${String(entry.bytes).padStart(8)} bytes  ${entry.output}`);
+    const index = builds.findIndex((other) => other.profile === name);
+    if (index < 0) builds.push(entry);
+    else builds[index] = entry;
+  }
+  const checkedIn = fs.readFileSync(CHECKED_IN);
+  console.log(`(checked-in tree-sitter-vue3.wasm: ${checkedIn.length} bytes)`);
+  fs.writeFileSync(SIZES_PATH, JSON.stringify({ emcc: version, builds }, null, 2) + "\n");
+
+  // The checked-in build is the reference bench/wasm.js compares trees with,
+  // so it has to follow parser.c and the scanner.
+  const os = builds.find((entry) => entry.profile === "os");
+  if (os && fs.existsSync(PROFILES.os.output)) {
+    const sha256 = crypto.createHash("sha256").update(checkedIn).digest("hex");
+    if (sha256 !== os.sha256) {
+      console.warn(`tree-sitter-vue3.wasm is not the os build; copy ${os.output} over it to update it`);
+    }
+  }
+}
+
+module.exports = { PROFILES, SIZES_PATH, CHECKED_IN };
+
+if (require.main === module) main();
@@ -0,0 +1,206 @@
+#!/usr/bin/env node
+// Checks queries/*.scm against src/node-types.json and src/parser.c, for the
+// mistakes that make ts_query_new fail: a node type, anonymous token or field
+// the grammar does not have (TSQueryErrorNodeType, TSQueryErrorField), and a
+// child pattern that can never appear under its parent
+// (TSQueryErrorStructure). A type that node-types.json lists but parser.c has
+// no symbol for means parser.c is older than the grammar. It needs neither
+// libtree-sitter nor the CLI, so it can run right after `tree-sitter generate`.
+//
+//   node script/check-queries.js [file.scm ...]
+//
+// Exits non-zero and prints each problem with its line if any query fails.
+
+const fs = require("fs");
+const path = require("path");
+
+const root = path.resolve(__dirname, "..");
+const nodeTypes = JSON.parse(fs.readFileSync(path.join(root, "src", "node-types.json"), "utf8"));
+
+const key = (type, named) => `${named ? "" : '"'}${type}`;
+const types = new Map(nodeTypes.map((entry) => [key(entry.type, entry.named), entry]));
+
+function addTypes(set, list) {
+  for (const entry of list || []) {
+    set.add(key(entry.type, entry.named));
+    for (const subtype of (types.get(key(entry.type, entry.named)) || {}).subtypes || []) {
+      addTypes(set, [subtype]);
+    }
+  }
+}
+
+// Every type that can be a direct child of `type`, with supertypes expanded,
+// and the types allowed under each of its fields.
+function childTypes(type) {
+  const entry = types.get(type);
+  const children = new Set();
+  const fields = new Map();
+  if (!entry) return { children, fields };
+  addTypes(children, entry.children && entry.children.types);
+  for (const [name, field] of Object.entries(entry.fields || {})) {
+    const fieldTypes = new Set();
+    addTypes(fieldTypes, field.types);
+    fields.set(name, fieldTypes);
+    for (const fieldType of fieldTypes) children.add(fieldType);
+  }
+  return { children, fields };
+}
+
+const anyNodeTypes = new Set();
+for (const entry of nodeTypes) {
+  anyNodeTypes.add(key(entry.type, entry.named));
+  addTypes(anyNodeTypes, entry.children && entry.children.types);
+  for (const field of Object.values(entry.fields || {})) addTypes(anyNodeTypes, field.types);
+}
+const fieldNames = new Set(nodeTypes.flatMap((entry) => Object.keys(entry.fields || {})));
+
+// The names ts_query_new resolves against: ts_symbol_names and ts_field_names.
+const parserSource = fs.readFileSync(path.join(root, "src", "parser.c"), "utf8");
+function parserNames(table) {
+  const body = parserSource.match(new RegExp(`static const char \\* const ${table}\\[\\] = \\{([\\s\\S]*?)\\n\\};`));
+  return new Set(body ? [...body[1].matchAll(/= "((?:[^"\\]|\\.)*)"/g)].map((match) => JSON.parse(`"${match[1]}"`)) : []);
+}
+const parserSymbols = parserNames("ts_symbol_names");
+const parserFields = parserNames("ts_field_names");
+
+function tokenize(source) {
+  const tokens = [];
+  const pattern = /\s+|;[^\n]*|"(?:[^"\\]|\\.)*"|[()[\]]|[@#][\w.?!-]*|[\w.-]+:|[^\s()[\]";]+/g;
+  let line = 1;
+  for (const match of source.matchAll(pattern)) {
+    const text = match[0];
+    if (!/^\s|^;/.test(text)) tokens.push({ text, line });
+    line += text.split("\n").length - 1;
+  }
+  return tokens;
+}
+
+// Parses the tokens into patterns: {node, named, line, children} for a node,
+// {alternatives} for `[...]`, and null for anything the checks skip
+// (predicates, wildcards, grouping parentheses around sibling patterns).
+function parse(tokens) {
+  let index = 0;
+  // Reads up to the closing `end`, which must come before the input does.
+  function until(end, item) {
+    const open = tokens[index - 1];
+    while (index < tokens.length && tokens[index].text !== end) item();
+    if (index === tokens.length) throw new SyntaxError(`${open.line}: unclosed ${open.text}`);
+    index++;
+  }
+  function parseOne() {
+    const token = tokens[index++];
+    let result = null;
+    if (token.text === "(") {
+      const head = tokens[index];
+      if (head.text === "(" || head.text === "[" || head.text.startsWith('"')) {
+        const group = [];
+        until(")", () => group.push(parseField()));
+        result = { group };
+      } else if (head.text.startsWith("#")) {
+        until(")", parseOne);
+      } else {
+        index++;
+        const children = [];
+        until(")", () => children.push(parseField()));
+        const name = head.text;
+        result = name === "_" || name === "ERROR" || name === "MISSING" ? null : { node: name, named: true, line: head.line, children };
+      }
+    } else if (token.text === "[") {
+      const alternatives = [];
+      until("]", () => alternatives.push(parseField()));
+      result = { alternatives };
+    } else if (token.text.startsWith('"')) {
+      result = { node: JSON.parse(token.text), named: false, line: token.line, children: [] };
+    } else if (token.text === ")" || token.text === "]") {
+      throw new SyntaxError(`${token.line}: unexpected ${token.text}`);
+    }
+    // Captures and quantifiers follow the pattern they apply to.
+    while (index < tokens.length && /^(@|[*+?]$)/.test(tokens[index].text)) index++;
+    return result;
+  }
+  function parseField() {
+    const token = tokens[index];
+    if (/^[\w-]+:$/.test(token.text)) {
+      index++;
+      const pattern = parseField();
+      return pattern && { ...pattern, field: token.text.slice(0, -1), fieldLine: token.line };
+    }
+    if (token.text === "." || token.text.startsWith("!")) {
+      index++;
+      return null;
+    }
+    return parseOne();
+  }
+  const patterns = [];
+  while (index < tokens.length) patterns.push(parseField());
+  return patterns;
+}
+
+// The named or anonymous node types a pattern can match at its top level.
+function heads(pattern) {
+  if (!pattern) return [];
+  if (pattern.alternatives) return pattern.alternatives.flatMap(heads);
+  if (pattern.group) return pattern.group.flatMap(heads);
+  return [pattern];
+}
+
+function check(file) {
+  const problems = [];
+  const report = (line, message) => problems.push(`${path.relative(root, file)}:${line}: ${message}`);
+
+  function visit(pattern, parent) {
+    for (const node of heads(pattern)) {
+      const type = key(node.node, node.named);
+      const label = node.named ? node.node : JSON.stringify(node.node);
+      if (!anyNodeTypes.has(type)) {
+        report(node.line, `unknown ${node.named ? "node type" : "token"} ${label}`);
+      } else if (!parserSymbols.has(node.node)) {
+        report(node.line, `${label} is in node-types.json but not in src/parser.c; regenerate the parser`);
+      } else if (node.field && !fieldNames.has(node.field)) {
+        report(node.fieldLine, `unknown field ${node.field}`);
+      } else if (node.field && !parserFields.has(node.field)) {
+        report(node.fieldLine, `field ${node.field} is not in src/parser.c; regenerate the parser`);
+      } else if (parent && types.has(parent.type)) {
+        const allowed = childTypes(parent.type);
+        if (node.field && !allowed.fields.has(node.field)) {
+          report(node.fieldLine, `${parent.name} has no field ${node.field}`);
+        } else if (node.field ? !allowed.fields.get(node.field).has(type) : !allowed.children.has(type)) {
+          report(node.line, `${label} cannot appear under ${parent.name}`);
+        }
+      }
+      // Supertypes match any of their subtypes, so their children are not
+      // checked against the supertype itself.
+      const entry = types.get(type);
+      const scope = entry && !entry.subtypes ? { type, name: node.node } : null;
+      for (const child of node.children || []) visit(child, scope);
+    }
+  }
+
+  let patterns = [];
+  try {
+    patterns = parse(tokenize(fs.readFileSync(file, "utf8")));
+  } catch (error) {
+    if (!(error instanceof SyntaxError)) throw error;
+    const [line, message] = error.message.split(": ");
+    report(line, `syntax error: ${message}`);
+  }
+  for (const pattern of patterns) visit(pattern, null);
+  return problems;
+}
+
+const files = process.argv.slice(2);
+if (files.length === 0) {
+  const queries = path.join(root, "queries");
+  for (const name of fs.readdirSync(queries).sort()) {
+    if (name.endsWith(".scm")) files.push(path.join(queries, name));
+  }
+}
+
+let failed = false;
+for (const file of files) {
+  const problems = check(file);
+  for (const problem of problems) console.error(problem);
+  failed = failed || problems.length > 0;
+  if (problems.length === 0) console.log(`${path.relative(root, file)}: ok`);
+}
+process.exit(failed ? 1 : 0);
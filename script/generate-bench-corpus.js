@@ -0,0 +1,1231 @@
+#!/usr/bin/env node
+// Writes bench-corpus/, the benchmark corpus of production-shaped single-file
+// components, and its manifest.json.
+//
+// The components are written from scratch by this script, so the corpus has
+// no third-party license. They are modeled on what real applications contain:
+// Options API and `<script setup lang="ts">` components, large data tables,
+// form-heavy pages, SVG icons, i18n blocks, and scoped, module and
+// preprocessor styles. Sizes follow a long-tailed distribution like real
+// code bases. The output is deterministic; re-running the script reproduces
+// the checked-in files byte for byte.
+
+const fs = require("fs");
+const path = require("path");
+
+const root = path.resolve(__dirname, "..");
+const outputDir = path.join(root, "bench-corpus");
+const FILES_PER_CATEGORY = 50;
+
+// mulberry32
+function createRandom(seed) {
+  let state = seed >>> 0;
+  const next = () => {
+    state = (state + 0x6d2b79f5) >>> 0;
+    let t = state;
+    t = Math.imul(t ^ (t >>> 15), t | 1);
+    t ^= t + Math.imul(t ^ (t >>> 7), t | 61);
+    return ((t ^ (t >>> 14)) >>> 0) / 4294967296;
+  };
+  return {
+    next,
+    int: (min, max) => min + Math.floor(next() * (max - min + 1)),
+    pick: (items) => items[Math.floor(next() * items.length)],
+    chance: (p) => next() < p,
+    // Long-tailed: most values near `min`, a few close to `max`.
+    skewed: (min, max) => min + Math.floor(Math.pow(next(), 2.5) * (max - min + 1)),
+    sample: (items, count) => {
+      const copy = items.slice();
+      const result = [];
+      while (result.length < count && copy.length) {
+        result.push(copy.splice(Math.floor(next() * copy.length), 1)[0]);
+      }
+      return result;
+    },
+  };
+}
+
+const ENTITIES = [
+  "user", "order", "product", "invoice", "customer", "project", "task", "ticket", "report", "payment",
+  "shipment", "account", "device", "article", "comment", "supplier", "warehouse", "employee", "contract", "campaign",
+];
+
+const FIELDS = [
+  "id", "name", "email", "status", "createdAt", "updatedAt", "amount", "price", "quantity", "owner", "title",
+  "description", "category", "priority", "dueDate", "phone", "address", "city", "country", "tags", "code",
+  "region", "discount", "currency", "score", "version", "source", "assignee", "department", "remark",
+];
+
+const STATUSES = ["active", "pending", "archived", "draft", "failed", "approved", "rejected"];
+const LIBRARIES = ["element", "vuetify", "antd"];
+const STYLE_COLORS = ["#409eff", "#67c23a", "#e6a23c", "#f56c6c", "#909399", "#303133", "#1f2d3d", "#6b778c"];
+
+const pascal = (text) => text.replace(/(^|[-_ ])(\w)/g, (_, __, c) => c.toUpperCase());
+const kebab = (text) => text.replace(/[A-Z]/g, (c) => "-" + c.toLowerCase()).replace(/^-/, "");
+const title = (text) => kebab(text).split("-").map((word) => word[0].toUpperCase() + word.slice(1)).join(" ");
+const indent = (text, level) =>
+  text
+    .split("\n")
+    .map((line) => (line ? "  ".repeat(level) + line : line))
+    .join("\n");
+
+function tsType(field) {
+  if (["id", "amount", "price", "quantity", "discount", "score", "version"].includes(field)) return "number";
+  if (field === "tags") return "string[]";
+  return "string";
+}
+
+function sampleValue(random, field, index) {
+  switch (tsType(field)) {
+    case "number":
+      return String(random.int(1, 9999) + index);
+    case "string[]":
+      return `["${random.pick(STATUSES)}", "${random.pick(ENTITIES)}"]`;
+    default:
+      if (field === "status") return `"${random.pick(STATUSES)}"`;
+      if (field.endsWith("At") || field === "dueDate") {
+        return `"2023-${String(random.int(1, 12)).padStart(2, "0")}-${String(random.int(1, 28)).padStart(2, "0")}"`;
+      }
+      return `"${title(field)} ${index}"`;
+  }
+}
+
+// Styles -------------------------------------------------------------------
+
+function styleRules(random, block, count) {
+  const rules = [];
+  for (let i = 0; i < count; i++) {
+    const element = random.pick(["header", "body", "footer", "item", "title", "actions", "cell", "label", "icon"]);
+    const color = random.pick(STYLE_COLORS);
+    const lines = [
+      `.${block}__${element}${i ? "--" + random.pick(["active", "disabled", "compact", "wide"]) + i : ""} {`,
+      `  display: ${random.pick(["flex", "block", "grid", "inline-flex"])};`,
+      `  padding: ${random.int(0, 24)}px ${random.int(0, 32)}px;`,
+      `  color: ${color};`,
+    ];
+    if (random.chance(0.4)) lines.push(`  border-bottom: 1px solid ${random.pick(STYLE_COLORS)};`);
+    if (random.chance(0.3)) lines.push(`  transition: all ${random.int(1, 5) / 10}s ease-in-out;`);
+    lines.push("}");
+    rules.push(lines.join("\n"));
+  }
+  return rules.join("\n\n");
+}
+
+function scssRules(random, block, count) {
+  const nested = [];
+  for (let i = 0; i < count; i++) {
+    const element = random.pick(["header", "body", "item", "title", "toolbar", "cell", "footer"]);
+    nested.push(
+      [
+        `  &__${element} {`,
+        `    margin: 0 $spacing * ${random.int(1, 4)};`,
+        `    color: darken($primary, ${random.int(2, 20)}%);`,
+        `    &:hover {`,
+        `      background: rgba($primary, 0.${random.int(1, 9)});`,
+        `    }`,
+        random.chance(0.4) ? `    @include respond-to(${random.pick(["sm", "md", "lg"])}) {\n      display: none;\n    }` : null,
+        `  }`,
+      ]
+        .filter(Boolean)
+        .join("\n"),
+    );
+  }
+  return [
+    `$primary: ${random.pick(STYLE_COLORS)};`,
+    `$spacing: ${random.int(4, 12)}px;`,
+    "",
+    `@mixin respond-to($size) {`,
+    `  @media (max-width: map-get((sm: 576px, md: 768px, lg: 992px), $size)) {`,
+    `    @content;`,
+    `  }`,
+    `}`,
+    "",
+    `.${block} {`,
+    nested.join("\n\n"),
+    random.chance(0.5) ? `\n  :deep(.el-input__inner) {\n    height: ${random.int(28, 40)}px;\n  }` : "",
+    `}`,
+  ].join("\n");
+}
+
+// Returns [text, features] for the style blocks of one component.
+function styleBlocks(random, block, size, forced) {
+  const kind = forced || random.pick(["scoped", "scoped-scss", "module", "plain", "scoped-less", "none", "scoped"]);
+  const count = Math.max(1, Math.round(size / 2));
+  switch (kind) {
+    case "none":
+      return ["", []];
+    case "plain":
+      return [`\n<style>\n${styleRules(random, block, count)}\n</style>\n`, ["plain-style"]];
+    case "module":
+      return [
+        `\n<style module>\n${styleRules(random, block, count)}\n</style>\n`,
+        ["module-style"],
+      ];
+    case "scoped-scss":
+      return [`\n<style lang="scss" scoped>\n${scssRules(random, block, count)}\n</style>\n`, ["scoped-style", "scss"]];
+    case "scoped-less":
+      return [
+        `\n<style lang="less" scoped>\n@primary: ${random.pick(STYLE_COLORS)};\n\n${styleRules(random, block, count)
+          .replace(/color: #[0-9a-f]+;/g, "color: @primary;")}\n</style>\n`,
+        ["scoped-style", "less"],
+      ];
+    case "scoped-vbind":
+      return [
+        `\n<style scoped>\n.${block} {\n  color: v-bind(color);\n  font-size: v-bind("size + 'px'");\n}\n\n${styleRules(
+          random,
+          block,
+          count,
+        )}\n</style>\n`,
+        ["scoped-style", "css-v-bind"],
+      ];
+    default:
+      return [`\n<style scoped>\n${styleRules(random, block, count)}\n</style>\n`, ["scoped-style"]];
+  }
+}
+
+// Options API ------------------------------------------------------------------
+
+function optionsApi(random, index) {
+  const entity = random.pick(ENTITIES);
+  const Entity = pascal(entity);
+  const fields = random.sample(FIELDS.slice(1), random.int(3, 10));
+  const sections = random.skewed(1, 14);
+  const block = `${kebab(entity)}-list`;
+  const features = ["options-api"];
+
+  const itemFields = fields
+    .map(
+      (field) =>
+        `        <span class="${block}__${kebab(field)}" :title="item.${field}">{{ format${pascal(field)}(item.${field}) }}</span>`,
+    )
+    .join("\n");
+
+  const sectionsMarkup = [];
+  for (let i = 0; i < sections; i++) {
+    const status = random.pick(STATUSES);
+    sectionsMarkup.push(
+      [
+        `    <section v-show="visibleSections.includes('${status}${i}')" class="${block}__section">`,
+        `      <h3 @click="toggleSection('${status}${i}')">{{ sectionTitle('${status}') }} ({{ countBy('${status}') }})</h3>`,
+        `      <ul>`,
+        `        <li`,
+        `          v-for="(item, index) in itemsBy('${status}')"`,
+        `          :key="item.id"`,
+        `          :class="{ active: item.id === selectedId, odd: index % 2 === 1 }"`,
+        `          @click="select(item)"`,
+        `        >`,
+        indent(itemFields, 1),
+        random.chance(0.5)
+          ? `          <button type="button" class="link" @click.stop="$emit('remove', item.id)">Remove</button>`
+          : `          <router-link :to="{ name: '${entity}-detail', params: { id: item.id } }">Open</router-link>`,
+        `        </li>`,
+        `      </ul>`,
+        `    </section>`,
+      ].join("\n"),
+    );
+  }
+
+  const children = random.sample(["BasePagination", "SearchBox", "ConfirmDialog", "EmptyState", "UserAvatar"], random.int(0, 3));
+  if (children.length) features.push("components");
+  const childMarkup = children
+    .map((child) =>
+      child === "SearchBox"
+        ? `    <SearchBox v-model="query" placeholder="Search ${entity}s" @search="refresh" />`
+        : child === "BasePagination"
+        ? `    <BasePagination v-model:page="page" :total="total" :page-size="pageSize" />`
+        : child === "ConfirmDialog"
+        ? `    <ConfirmDialog v-if="confirming" :message="'Delete ' + selected.name + '?'" @confirm="remove" @cancel="confirming = false" />`
+        : `    <${child} />`,
+    )
+    .join("\n");
+
+  const template = [
+    `<template>`,
+    `  <div class="${block}" :class="{ 'is-loading': loading }">`,
+    `    <header class="${block}__header">`,
+    `      <h2>{{ title }}</h2>`,
+    `      <button type="button" :disabled="loading" @click="refresh">Refresh</button>`,
+    `    </header>`,
+    childMarkup,
+    `    <p v-if="error" class="${block}__error">{{ error.message }}</p>`,
+    `    <template v-else-if="items.length">`,
+    indent(sectionsMarkup.join("\n"), 1),
+    `    </template>`,
+    `    <p v-else>No ${entity}s yet.</p>`,
+    `  </div>`,
+    `</template>`,
+  ]
+    .filter((line) => line !== "")
+    .join("\n");
+
+  const methods = fields
+    .map((field) =>
+      tsType(field) === "number"
+        ? `    format${pascal(field)}(value) {\n      return value == null ? "-" : Number(value).toLocaleString();\n    },`
+        : `    format${pascal(field)}(value) {\n      return value ? String(value).trim() : "-";\n    },`,
+    )
+    .join("\n");
+
+  const script = [
+    `<script>`,
+    `import { fetch${Entity}s, remove${Entity} } from "@/api/${entity}";`,
+    children.map((child) => `import ${child} from "@/components/${child}.vue";`).join("\n"),
+    ``,
+    `export default {`,
+    `  name: "${Entity}List",`,
+    children.length ? `  components: { ${children.join(", ")} },` : null,
+    `  props: {`,
+    `    title: { type: String, default: "${title(entity)}s" },`,
+    `    pageSize: { type: Number, default: ${random.pick([10, 20, 50])} },`,
+    `  },`,
+    `  emits: ["select", "remove"],`,
+    `  data() {`,
+    `    return {`,
+    `      items: [],`,
+    `      loading: false,`,
+    `      error: null,`,
+    `      query: "",`,
+    `      page: 1,`,
+    `      total: 0,`,
+    `      selectedId: null,`,
+    `      confirming: false,`,
+    `      visibleSections: [],`,
+    `    };`,
+    `  },`,
+    `  computed: {`,
+    `    selected() {`,
+    `      return this.items.find((item) => item.id === this.selectedId) || null;`,
+    `    },`,
+    `  },`,
+    `  watch: {`,
+    `    page: "refresh",`,
+    `    query(value, previous) {`,
+    `      if (value !== previous && value.length > 2) this.refresh();`,
+    `    },`,
+    `  },`,
+    `  mounted() {`,
+    `    this.refresh();`,
+    `  },`,
+    `  methods: {`,
+    `    async refresh() {`,
+    `      this.loading = true;`,
+    `      try {`,
+    `        const { data, total } = await fetch${Entity}s({ q: this.query, page: this.page, size: this.pageSize });`,
+    `        this.items = data;`,
+    `        this.total = total;`,
+    `      } catch (error) {`,
+    `        this.error = error;`,
+    `      } finally {`,
+    `        this.loading = false;`,
+    `      }`,
+    `    },`,
+    `    itemsBy(status) {`,
+    `      return this.items.filter((item) => item.status === status);`,
+    `    },`,
+    `    countBy(status) {`,
+    `      return this.itemsBy(status).length;`,
+    `    },`,
+    `    sectionTitle(status) {`,
+    `      return status.charAt(0).toUpperCase() + status.slice(1);`,
+    `    },`,
+    `    toggleSection(key) {`,
+    `      const index = this.visibleSections.indexOf(key);`,
+    `      index < 0 ? this.visibleSections.push(key) : this.visibleSections.splice(index, 1);`,
+    `    },`,
+    `    select(item) {`,
+    `      this.selectedId = item.id;`,
+    `      this.$emit("select", item);`,
+    `    },`,
+    `    async remove() {`,
+    `      await remove${Entity}(this.selectedId);`,
+    `      this.confirming = false;`,
+    `      this.refresh();`,
+    `    },`,
+    methods,
+    `  },`,
+    `};`,
+    `</script>`,
+  ]
+    .filter((line) => line !== null && line !== "")
+    .join("\n");
+
+  const [style, styleFeatures] = styleBlocks(random, block, random.skewed(2, 20));
+  return { name: `${kebab(entity)}-list-${index}`, text: `${template}\n\n${script}\n${style}`, features: features.concat(styleFeatures) };
+}
+
+// <script setup lang="ts"> ------------------------------------------------------
+
+function scriptSetup(random, index) {
+  const entity = random.pick(ENTITIES);
+  const Entity = pascal(entity);
+  const fields = ["id"].concat(random.sample(FIELDS.slice(1), random.int(3, 12)));
+  const cards = random.skewed(1, 16);
+  const block = `${kebab(entity)}-overview`;
+  const features = ["script-setup", "typescript"];
+
+  const cardMarkup = [];
+  for (let i = 0; i < cards; i++) {
+    const field = random.pick(fields.slice(1));
+    cardMarkup.push(
+      [
+        `    <BaseCard :title="t('${entity}.${field}')" :loading="pending" class="${block}__card">`,
+        `      <template #header="{ collapsed }">`,
+        `        <span :class="['badge', \`badge--\${${entity}.value?.status ?? 'unknown'}\`]">{{ collapsed ? '+' : '-' }}</span>`,
+        `      </template>`,
+        `      <dl>`,
+        ...random.sample(fields, random.int(2, 6)).map(
+          (f) => `        <dt>${title(f)}</dt>\n        <dd>{{ ${entity}?.${f} ?? '-' }}</dd>`,
+        ),
+        `      </dl>`,
+        random.chance(0.4)
+          ? `      <template #footer>\n        <button v-if="canEdit" type="button" @click="emit('edit', ${entity}!.id)">Edit</button>\n      </template>`
+          : null,
+        `    </BaseCard>`,
+      ]
+        .filter(Boolean)
+        .join("\n"),
+    );
+  }
+
+  const template = [
+    `<template>`,
+    `  <div class="${block}">`,
+    `    <Teleport to="body">`,
+    `      <Transition name="fade">`,
+    `        <div v-if="pending" class="${block}__overlay" />`,
+    `      </Transition>`,
+    `    </Teleport>`,
+    `    <Suspense>`,
+    `      <template #default>`,
+    `        <KeepAlive :max="${random.int(2, 10)}">`,
+    `          <component :is="activeTab" v-bind="tabProps" @update:model-value="onTabUpdate" />`,
+    `        </KeepAlive>`,
+    `      </template>`,
+    `      <template #fallback>Loading…</template>`,
+    `    </Suspense>`,
+    cardMarkup.join("\n"),
+    `    <input ref="inputRef" v-model.trim="search" type="search" :placeholder="t('common.search')" @keydown.enter.prevent="submit" />`,
+    `  </div>`,
+    `</template>`,
+  ].join("\n");
+
+  const interfaceFields = fields.map((field) => `  ${field}${field === "id" ? "" : "?"}: ${tsType(field)};`).join("\n");
+  const script = [
+    `<script setup lang="ts">`,
+    `import { computed, onMounted, ref, shallowRef, watch, type Component } from "vue";`,
+    `import { useI18n } from "vue-i18n";`,
+    `import { useRoute, useRouter } from "vue-router";`,
+    `import BaseCard from "@/components/BaseCard.vue";`,
+    `import { use${Entity}Store } from "@/stores/${entity}";`,
+    ``,
+    `export interface ${Entity} {`,
+    interfaceFields,
+    `}`,
+    ``,
+    `const props = withDefaults(`,
+    `  defineProps<{`,
+    `    id: number;`,
+    `    canEdit?: boolean;`,
+    `    tabs?: Record<string, Component>;`,
+    `  }>(),`,
+    `  { canEdit: false, tabs: () => ({}) },`,
+    `);`,
+    ``,
+    `const emit = defineEmits<{`,
+    `  (event: "edit", id: number): void;`,
+    `  (event: "loaded", value: ${Entity}): void;`,
+    `}>();`,
+    ``,
+    `const { t } = useI18n();`,
+    `const route = useRoute();`,
+    `const router = useRouter();`,
+    `const store = use${Entity}Store();`,
+    `const inputRef = ref<HTMLInputElement | null>(null);`,
+    `const search = ref<string>((route.query.q as string) ?? "");`,
+    `const pending = ref(false);`,
+    `const activeTab = shallowRef<Component | null>(null);`,
+    `const ${entity} = computed<${Entity} | undefined>(() => store.byId.get(props.id));`,
+    `const tabProps = computed(() => ({ ${entity}: ${entity}.value, readonly: !props.canEdit }));`,
+    ``,
+    `watch(`,
+    `  () => props.id,`,
+    `  async (id, previous) => {`,
+    `    if (id === previous) return;`,
+    `    pending.value = true;`,
+    `    try {`,
+    `      const value = await store.load(id);`,
+    `      if (value) emit("loaded", value);`,
+    `    } finally {`,
+    `      pending.value = false;`,
+    `    }`,
+    `  },`,
+    `  { immediate: true },`,
+    `);`,
+    ``,
+    `function onTabUpdate(value: unknown): void {`,
+    `  store.patch(props.id, value as Partial<${Entity}>);`,
+    `}`,
+    ``,
+    `async function submit(): Promise<void> {`,
+    `  await router.push({ query: { ...route.query, q: search.value || undefined } });`,
+    `}`,
+    ``,
+    `onMounted(() => inputRef.value?.focus());`,
+    ...Array.from({ length: random.skewed(0, 12) }, (_, i) => {
+      const field = random.pick(fields);
+      return `\nconst ${field}Label${i} = computed(() => \`\${t("${entity}.${field}")}: \${${entity}.value?.${field} ?? "-"}\`);`;
+    }),
+    `</script>`,
+  ].join("\n");
+
+  const [style, styleFeatures] = styleBlocks(random, block, random.skewed(1, 16), random.chance(0.15) ? "scoped-vbind" : null);
+  return { name: `${kebab(entity)}-overview-${index}`, text: `${template}\n\n${script}\n${style}`, features: features.concat(styleFeatures) };
+}
+
+// Data tables --------------------------------------------------------------------
+
+function dataTable(random, index) {
+  const entity = random.pick(ENTITIES);
+  const Entity = pascal(entity);
+  const library = random.pick(LIBRARIES);
+  const columnCount = random.skewed(6, 60);
+  const columns = [];
+  for (let i = 0; i < columnCount; i++) {
+    const field = i < FIELDS.length ? FIELDS[i] : `${random.pick(FIELDS)}${i}`;
+    columns.push(field);
+  }
+  const features = ["data-table", `ui-${library}`];
+  const block = `${kebab(entity)}-table`;
+  const useSetup = random.chance(0.6);
+  features.push(useSetup ? "script-setup" : "options-api");
+  if (useSetup) features.push("typescript");
+
+  let table;
+  if (library === "element") {
+    const columnMarkup = columns.map((field, i) => {
+      const attrs = `prop="${field}" label="${title(field)}"${random.chance(0.5) ? ` width="${random.int(80, 240)}"` : ""}${
+        random.chance(0.3) ? " sortable" : ""
+      }${i === 0 ? ' fixed="left"' : ""}`;
+      if (field === "status") {
+        return `      <el-table-column ${attrs}>\n        <template #default="{ row }">\n          <el-tag :type="statusType(row.status)" size="small">{{ row.status }}</el-tag>\n        </template>\n      </el-table-column>`;
+      }
+      if (random.chance(0.25)) {
+        return `      <el-table-column ${attrs} show-overflow-tooltip>\n        <template #default="scope">\n          <span :class="{ muted: !scope.row.${field} }">{{ scope.row.${field} ?? '-' }}</span>\n        </template>\n      </el-table-column>`;
+      }
+      return `      <el-table-column ${attrs} />`;
+    });
+    table = [
+      `    <el-table`,
+      `      v-loading="loading"`,
+      `      :data="rows"`,
+      `      border`,
+      `      stripe`,
+      `      height="100%"`,
+      `      row-key="id"`,
+      `      @selection-change="onSelectionChange"`,
+      `      @sort-change="onSortChange"`,
+      `    >`,
+      `      <el-table-column type="selection" width="48" />`,
+      ...columnMarkup,
+      `      <el-table-column label="Actions" fixed="right" width="160">`,
+      `        <template #default="{ row, $index }">`,
+      `          <el-button link type="primary" @click="edit(row)">Edit</el-button>`,
+      `          <el-popconfirm title="Delete this row?" @confirm="remove(row, $index)">`,
+      `            <template #reference>`,
+      `              <el-button link type="danger">Delete</el-button>`,
+      `            </template>`,
+      `          </el-popconfirm>`,
+      `        </template>`,
+      `      </el-table-column>`,
+      `    </el-table>`,
+      `    <el-pagination`,
+      `      v-model:current-page="page"`,
+      `      v-model:page-size="pageSize"`,
+      `      :total="total"`,
+      `      layout="total, sizes, prev, pager, next, jumper"`,
+      `      :page-sizes="[10, 20, 50, 100]"`,
+      `    />`,
+    ].join("\n");
+  } else if (library === "vuetify") {
+    table = [
+      `    <v-data-table`,
+      `      v-model="selected"`,
+      `      :headers="headers"`,
+      `      :items="rows"`,
+      `      :loading="loading"`,
+      `      :items-per-page="pageSize"`,
+      `      item-value="id"`,
+      `      show-select`,
+      `      density="compact"`,
+      `    >`,
+      ...columns
+        .filter(() => random.chance(0.3))
+        .map(
+          (field) =>
+            `      <template #item.${field}="{ item }">\n        <v-chip v-if="item.${field}" size="small" label>{{ item.${field} }}</v-chip>\n        <span v-else class="text-disabled">-</span>\n      </template>`,
+        ),
+      `      <template #item.actions="{ item }">`,
+      `        <v-icon size="small" class="me-2" @click="edit(item)">mdi-pencil</v-icon>`,
+      `        <v-icon size="small" @click="remove(item)">mdi-delete</v-icon>`,
+      `      </template>`,
+      `    </v-data-table>`,
+    ].join("\n");
+  } else {
+    table = [
+      `    <a-table`,
+      `      :columns="columns"`,
+      `      :data-source="rows"`,
+      `      :loading="loading"`,
+      `      :row-selection="{ selectedRowKeys: selected, onChange: onSelectionChange }"`,
+      `      :pagination="{ current: page, pageSize, total }"`,
+      `      row-key="id"`,
+      `      :scroll="{ x: ${columnCount * 120} }"`,
+      `      @change="onTableChange"`,
+      `    >`,
+      `      <template #bodyCell="{ column, record }">`,
+      ...columns
+        .filter(() => random.chance(0.25))
+        .map(
+          (field, i) =>
+            `        <template ${i ? "v-else-if" : "v-if"}="column.dataIndex === '${field}'">\n          <a-tag :color="record.${field} ? 'green' : 'default'">{{ record.${field} }}</a-tag>\n        </template>`,
+        ),
+      `      </template>`,
+      `    </a-table>`,
+    ].join("\n");
+  }
+
+  const template = [
+    `<template>`,
+    `  <div class="${block}">`,
+    `    <div class="${block}__toolbar">`,
+    `      <input v-model="filters.keyword" type="search" placeholder="Filter ${entity}s" />`,
+    `      <select v-model="filters.status">`,
+    `        <option value="">All</option>`,
+    `        <option v-for="status in statuses" :key="status" :value="status">{{ status }}</option>`,
+    `      </select>`,
+    `      <button type="button" :disabled="!selected.length" @click="exportRows">Export ({{ selected.length }})</button>`,
+    `    </div>`,
+    table,
+    `  </div>`,
+    `</template>`,
+  ].join("\n");
+
+  const columnDefinitions = columns
+    .map((field) => `  { title: "${title(field)}", dataIndex: "${field}", key: "${field}", sorter: ${random.chance(0.3)} },`)
+    .join("\n");
+  const sampleRows = Array.from({ length: random.skewed(0, 40) }, (_, i) =>
+    `  { ${columns.slice(0, Math.min(columns.length, 8)).map((field) => `${field}: ${sampleValue(random, field, i)}`).join(", ")} },`,
+  ).join("\n");
+
+  const script = useSetup
+    ? [
+        `<script setup lang="ts">`,
+        `import { reactive, ref, watch } from "vue";`,
+        `import { fetch${Entity}Page, remove${Entity}, export${Entity}s } from "@/api/${entity}";`,
+        ``,
+        `type Row = Record<string, unknown> & { id: number };`,
+        ``,
+        `const statuses = ${JSON.stringify(STATUSES)} as const;`,
+        `const columns = [`,
+        columnDefinitions,
+        `];`,
+        `const headers = columns.map(({ title, key }) => ({ title, key }));`,
+        `const placeholderRows: Row[] = [`,
+        sampleRows,
+        `];`,
+        ``,
+        `const rows = ref<Row[]>(placeholderRows);`,
+        `const selected = ref<number[]>([]);`,
+        `const loading = ref(false);`,
+        `const page = ref(1);`,
+        `const pageSize = ref(20);`,
+        `const total = ref(0);`,
+        `const filters = reactive({ keyword: "", status: "" });`,
+        `const sort = ref<{ prop?: string; order?: "ascending" | "descending" | null }>({});`,
+        ``,
+        `async function load(): Promise<void> {`,
+        `  loading.value = true;`,
+        `  try {`,
+        `    const result = await fetch${Entity}Page({ ...filters, page: page.value, size: pageSize.value, sort: sort.value });`,
+        `    rows.value = result.items;`,
+        `    total.value = result.total;`,
+        `  } finally {`,
+        `    loading.value = false;`,
+        `  }`,
+        `}`,
+        ``,
+        `function statusType(status: string): "success" | "warning" | "danger" | "info" {`,
+        `  return status === "active" ? "success" : status === "pending" ? "warning" : status === "failed" ? "danger" : "info";`,
+        `}`,
+        ``,
+        `const onSelectionChange = (value: Row[] | number[]) => {`,
+        `  selected.value = value.map((row) => (typeof row === "number" ? row : row.id));`,
+        `};`,
+        `const onSortChange = (value: typeof sort.value) => (sort.value = value);`,
+        `const onTableChange = (pagination: { current: number; pageSize: number }) => {`,
+        `  page.value = pagination.current;`,
+        `  pageSize.value = pagination.pageSize;`,
+        `};`,
+        `const edit = (row: Row) => window.dispatchEvent(new CustomEvent("edit-${entity}", { detail: row.id }));`,
+        `const remove = async (row: Row) => {`,
+        `  await remove${Entity}(row.id);`,
+        `  await load();`,
+        `};`,
+        `const exportRows = () => export${Entity}s(selected.value);`,
+        ``,
+        `watch([page, pageSize, sort, () => filters.status], load, { immediate: true });`,
+        `</script>`,
+      ].join("\n")
+    : [
+        `<script>`,
+        `import { fetch${Entity}Page, remove${Entity}, export${Entity}s } from "@/api/${entity}";`,
+        ``,
+        `const columns = [`,
+        columnDefinitions,
+        `];`,
+        ``,
+        `export default {`,
+        `  name: "${Entity}Table",`,
+        `  data() {`,
+        `    return {`,
+        `      columns,`,
+        `      headers: columns.map(({ title, key }) => ({ title, key })),`,
+        `      statuses: ${JSON.stringify(STATUSES)},`,
+        `      rows: [`,
+        indent(sampleRows, 2),
+        `      ],`,
+        `      selected: [],`,
+        `      loading: false,`,
+        `      page: 1,`,
+        `      pageSize: 20,`,
+        `      total: 0,`,
+        `      filters: { keyword: "", status: "" },`,
+        `      sort: {},`,
+        `    };`,
+        `  },`,
+        `  watch: {`,
+        `    page: "load",`,
+        `    pageSize: "load",`,
+        `    "filters.status": "load",`,
+        `  },`,
+        `  created() {`,
+        `    this.load();`,
+        `  },`,
+        `  methods: {`,
+        `    async load() {`,
+        `      this.loading = true;`,
+        `      const result = await fetch${Entity}Page({ ...this.filters, page: this.page, size: this.pageSize, sort: this.sort });`,
+        `      this.rows = result.items;`,
+        `      this.total = result.total;`,
+        `      this.loading = false;`,
+        `    },`,
+        `    statusType(status) {`,
+        `      return { active: "success", pending: "warning", failed: "danger" }[status] || "info";`,
+        `    },`,
+        `    onSelectionChange(value) {`,
+        `      this.selected = value.map((row) => (typeof row === "number" ? row : row.id));`,
+        `    },`,
+        `    onSortChange(value) {`,
+        `      this.sort = value;`,
+        `      this.load();`,
+        `    },`,
+        `    onTableChange({ current, pageSize }) {`,
+        `      this.page = current;`,
+        `      this.pageSize = pageSize;`,
+        `    },`,
+        `    edit(row) {`,
+        `      this.$router.push({ name: "${entity}-edit", params: { id: row.id } });`,
+        `    },`,
+        `    async remove(row) {`,
+        `      await remove${Entity}(row.id);`,
+        `      this.load();`,
+        `    },`,
+        `    exportRows() {`,
+        `      return export${Entity}s(this.selected);`,
+        `    },`,
+        `  },`,
+        `};`,
+        `</script>`,
+      ].join("\n");
+
+  const [style, styleFeatures] = styleBlocks(random, block, random.skewed(1, 10));
+  return { name: `${kebab(entity)}-table-${index}`, text: `${template}\n\n${script}\n${style}`, features: features.concat(styleFeatures) };
+}
+
+// Forms --------------------------------------------------------------------------
+
+function formPage(random, index) {
+  const entity = random.pick(ENTITIES);
+  const Entity = pascal(entity);
+  const fieldCount = random.skewed(6, 80);
+  const fields = Array.from({ length: fieldCount }, (_, i) => (i < FIELDS.length - 1 ? FIELDS[i + 1] : `${random.pick(FIELDS)}${i}`));
+  const block = `${kebab(entity)}-form`;
+  const features = ["form", "script-setup", "typescript"];
+  const native = random.chance(0.35);
+  features.push(native ? "native-inputs" : "ui-element");
+
+  const items = fields.map((field, i) => {
+    const kind = random.pick(["input", "input", "select", "date", "textarea", "checkbox", "radio", "number"]);
+    if (native) {
+      const id = `${block}-${kebab(field)}`;
+      const control =
+        kind === "select"
+          ? `<select id="${id}" v-model="form.${field}" :disabled="readonly" required>\n        <option disabled value="">Choose…</option>\n        <option v-for="option in options.${field}" :key="option.value" :value="option.value">{{ option.label }}</option>\n      </select>`
+          : kind === "textarea"
+          ? `<textarea id="${id}" v-model.trim="form.${field}" rows="${random.int(2, 8)}" maxlength="${random.int(100, 2000)}"></textarea>`
+          : kind === "checkbox"
+          ? `<input id="${id}" v-model="form.${field}" type="checkbox" true-value="yes" false-value="no">`
+          : kind === "radio"
+          ? STATUSES.slice(0, 3)
+              .map((status) => `<label><input v-model="form.${field}" type="radio" value="${status}"> ${title(status)}</label>`)
+              .join("\n      ")
+          : kind === "date"
+          ? `<input id="${id}" v-model="form.${field}" type="date" :min="today">`
+          : kind === "number"
+          ? `<input id="${id}" v-model.number="form.${field}" type="number" step="0.01" min="0">`
+          : `<input id="${id}" v-model.trim="form.${field}" type="text" autocomplete="off" :aria-invalid="!!errors.${field}">`;
+      return [
+        `    <div class="${block}__field" :class="{ 'has-error': errors.${field} }">`,
+        `      <label for="${id}">${title(field)}${i % 3 === 0 ? ' <abbr title="required">*</abbr>' : ""}</label>`,
+        `      ${control}`,
+        `      <p v-if="errors.${field}" class="${block}__error">{{ errors.${field} }}</p>`,
+        `    </div>`,
+      ].join("\n");
+    }
+    const control =
+      kind === "select"
+        ? `<el-select v-model="form.${field}" filterable clearable placeholder="Select">\n          <el-option v-for="option in options.${field}" :key="option.value" :label="option.label" :value="option.value" />\n        </el-select>`
+        : kind === "textarea"
+        ? `<el-input v-model="form.${field}" type="textarea" :rows="${random.int(2, 6)}" show-word-limit maxlength="500" />`
+        : kind === "checkbox"
+        ? `<el-checkbox-group v-model="form.${field}">\n          <el-checkbox v-for="tag in tags" :key="tag" :label="tag" />\n        </el-checkbox-group>`
+        : kind === "radio"
+        ? `<el-radio-group v-model="form.${field}">\n          <el-radio-button v-for="status in statuses" :key="status" :label="status" />\n        </el-radio-group>`
+        : kind === "date"
+        ? `<el-date-picker v-model="form.${field}" type="date" value-format="YYYY-MM-DD" :disabled-date="isPast" />`
+        : kind === "number"
+        ? `<el-input-number v-model="form.${field}" :min="0" :precision="2" controls-position="right" />`
+        : `<el-input v-model.trim="form.${field}" clearable placeholder="${title(field)}" />`;
+    return `      <el-form-item label="${title(field)}" prop="${field}"${i % 4 === 0 ? " required" : ""}>\n        ${control}\n      </el-form-item>`;
+  });
+
+  const template = native
+    ? [
+        `<template>`,
+        `  <form class="${block}" novalidate @submit.prevent="submit">`,
+        `    <fieldset :disabled="saving">`,
+        `      <legend>{{ isNew ? 'New ${entity}' : 'Edit ${entity}' }}</legend>`,
+        items.join("\n"),
+        `    </fieldset>`,
+        `    <footer class="${block}__actions">`,
+        `      <button type="reset" @click="reset">Reset</button>`,
+        `      <button type="submit" :disabled="!dirty || saving">{{ saving ? 'Saving…' : 'Save' }}</button>`,
+        `    </footer>`,
+        `  </form>`,
+        `</template>`,
+      ].join("\n")
+    : [
+        `<template>`,
+        `  <el-form`,
+        `    ref="formRef"`,
+        `    :model="form"`,
+        `    :rules="rules"`,
+        `    label-width="${random.int(100, 180)}px"`,
+        `    label-position="${random.pick(["left", "right", "top"])}"`,
+        `    class="${block}"`,
+        `    @submit.prevent`,
+        `  >`,
+        `    <el-row :gutter="16">`,
+        `      <el-col :span="24">`,
+        items.join("\n"),
+        `      </el-col>`,
+        `    </el-row>`,
+        `    <el-form-item>`,
+        `      <el-button type="primary" :loading="saving" @click="submit">Save</el-button>`,
+        `      <el-button @click="reset">Reset</el-button>`,
+        `    </el-form-item>`,
+        `  </el-form>`,
+        `</template>`,
+      ].join("\n");
+
+  const rules = fields
+    .filter((_, i) => i % 4 === 0 || random.chance(0.2))
+    .map((field) =>
+      field.includes("mail")
+        ? `  ${field}: [\n    { required: true, message: "${title(field)} is required", trigger: "blur" },\n    { type: "email", message: "Enter a valid address", trigger: ["blur", "change"] },\n  ],`
+        : `  ${field}: [{ required: true, message: "${title(field)} is required", trigger: "blur" }],`,
+    )
+    .join("\n");
+
+  const script = [
+    `<script setup lang="ts">`,
+    `import { computed, reactive, ref } from "vue";`,
+    native ? null : `import type { FormInstance, FormRules } from "element-plus";`,
+    `import { save${Entity} } from "@/api/${entity}";`,
+    ``,
+    `const props = defineProps<{ initial?: Partial<Record<string, unknown>> }>();`,
+    `const emit = defineEmits<{ saved: [id: number] }>();`,
+    ``,
+    `const empty = {`,
+    fields.map((field) => `  ${field}: ${tsType(field) === "number" ? "0" : tsType(field) === "string[]" ? "[] as string[]" : '""'},`).join("\n"),
+    `};`,
+    ``,
+    `const form = reactive({ ...empty, ...props.initial });`,
+    `const errors = reactive<Record<string, string>>({});`,
+    `const saving = ref(false);`,
+    `const formRef = ref${native ? "<HTMLFormElement>" : "<FormInstance>"}();`,
+    `const isNew = computed(() => !props.initial);`,
+    `const dirty = computed(() => JSON.stringify(form) !== JSON.stringify({ ...empty, ...props.initial }));`,
+    `const today = new Date().toISOString().slice(0, 10);`,
+    `const statuses = ${JSON.stringify(STATUSES.slice(0, 4))};`,
+    `const tags = ${JSON.stringify(random.sample(ENTITIES, 5))};`,
+    `const options: Record<string, { label: string; value: string }[]> = {};`,
+    ``,
+    `const rules${native ? "" : ": FormRules"} = {`,
+    rules,
+    `};`,
+    ``,
+    `function isPast(date: Date): boolean {`,
+    `  return date.getTime() < Date.now() - 86_400_000;`,
+    `}`,
+    ``,
+    `function validate(): boolean {`,
+    `  for (const key of Object.keys(errors)) delete errors[key];`,
+    `  for (const [key, list] of Object.entries(rules)) {`,
+    `    const value = (form as Record<string, unknown>)[key];`,
+    `    if (list.some((rule) => "required" in rule && rule.required) && (value === "" || value == null)) {`,
+    `      errors[key] = list[0].message as string;`,
+    `    }`,
+    `  }`,
+    `  return Object.keys(errors).length === 0;`,
+    `}`,
+    ``,
+    `async function submit(): Promise<void> {`,
+    native ? `  if (!validate()) return;` : `  if (!(await formRef.value?.validate().catch(() => false)) || !validate()) return;`,
+    `  saving.value = true;`,
+    `  try {`,
+    `    const { id } = await save${Entity}({ ...form });`,
+    `    emit("saved", id);`,
+    `  } finally {`,
+    `    saving.value = false;`,
+    `  }`,
+    `}`,
+    ``,
+    `function reset(): void {`,
+    `  Object.assign(form, empty, props.initial);`,
+    native ? null : `  formRef.value?.clearValidate();`,
+    `}`,
+    `</script>`,
+  ]
+    .filter((line) => line !== null)
+    .join("\n");
+
+  const [style, styleFeatures] = styleBlocks(random, block, random.skewed(1, 12));
+  return { name: `${kebab(entity)}-form-${index}`, text: `${template}\n\n${script}\n${style}`, features: features.concat(styleFeatures) };
+}
+
+// SVG icons ----------------------------------------------------------------------
+
+function svgPath(random, commands) {
+  const parts = [`M${random.int(0, 24)}.${random.int(0, 99)} ${random.int(0, 24)}.${random.int(0, 99)}`];
+  for (let i = 0; i < commands; i++) {
+    const command = random.pick(["L", "l", "C", "c", "H", "V", "Q", "A", "s"]);
+    const n = () => `${random.chance(0.3) ? "-" : ""}${random.int(0, 24)}.${random.int(0, 999)}`;
+    switch (command) {
+      case "C":
+      case "c":
+        parts.push(`${command}${n()} ${n()} ${n()} ${n()} ${n()} ${n()}`);
+        break;
+      case "Q":
+      case "s":
+        parts.push(`${command}${n()} ${n()} ${n()} ${n()}`);
+        break;
+      case "A":
+        parts.push(`A${n()} ${n()} 0 ${random.int(0, 1)} ${random.int(0, 1)} ${n()} ${n()}`);
+        break;
+      case "H":
+      case "V":
+        parts.push(`${command}${n()}`);
+        break;
+      default:
+        parts.push(`${command}${n()} ${n()}`);
+    }
+  }
+  return parts.join("") + "z";
+}
+
+function svgIcon(random, index) {
+  const name = `${random.pick(["arrow", "chart", "cloud", "cart", "bell", "user", "shield", "globe", "file", "map"])}-${random.pick([
+    "outline",
+    "filled",
+    "duotone",
+    "sharp",
+  ])}`;
+  const sprite = random.chance(0.3);
+  const icons = sprite ? random.skewed(4, 60) : 1;
+  const features = ["svg"];
+  if (sprite) features.push("svg-sprite");
+
+  const symbols = [];
+  for (let i = 0; i < icons; i++) {
+    const paths = Array.from(
+      { length: random.skewed(1, 12) },
+      () => `<path${random.chance(0.3) ? ' fill-rule="evenodd" clip-rule="evenodd"' : ""} d="${svgPath(random, random.skewed(4, 80))}" />`,
+    );
+    const gradient = random.chance(0.25);
+    const body = [
+      gradient
+        ? `<defs>\n  <linearGradient :id="\`${name}-${i}-\${uid}\`" x1="0" y1="0" x2="1" y2="1">\n    <stop offset="0%" stop-color="currentColor" stop-opacity="0.8" />\n    <stop offset="100%" :stop-color="accent" />\n  </linearGradient>\n</defs>`
+        : null,
+      `<g :fill="${gradient ? `\`url(#${name}-${i}-\${uid})\`` : "color"}" stroke-width="${random.int(1, 3)}" stroke-linecap="round">`,
+      ...paths.map((path) => "  " + path),
+      random.chance(0.3) ? `  <circle cx="${random.int(2, 22)}" cy="${random.int(2, 22)}" r="${random.int(1, 6)}" />` : null,
+      `</g>`,
+    ]
+      .filter(Boolean)
+      .join("\n");
+    symbols.push(
+      sprite
+        ? `      <symbol id="icon-${name}-${i}" viewBox="0 0 24 24">\n${indent(body, 4)}\n      </symbol>`
+        : indent(body, 2),
+    );
+  }
+
+  const template = sprite
+    ? [
+        `<template>`,
+        `  <div class="icon-sprite" aria-hidden="true">`,
+        `    <svg xmlns="http://www.w3.org/2000/svg" style="display: none">`,
+        symbols.join("\n"),
+        `    </svg>`,
+        `    <slot />`,
+        `  </div>`,
+        `</template>`,
+      ].join("\n")
+    : [
+        `<template>`,
+        `  <svg`,
+        `    xmlns="http://www.w3.org/2000/svg"`,
+        `    viewBox="0 0 24 24"`,
+        `    :width="size"`,
+        `    :height="size"`,
+        `    :class="['icon', \`icon--${name}\`, { 'icon--spin': spin }]"`,
+        `    role="img"`,
+        `    :aria-label="label"`,
+        `  >`,
+        `    <title v-if="label">{{ label }}</title>`,
+        symbols.join("\n"),
+        `  </svg>`,
+        `</template>`,
+      ].join("\n");
+
+  const script = random.chance(0.5)
+    ? [
+        `<script setup lang="ts">`,
+        `import { getCurrentInstance } from "vue";`,
+        ``,
+        `withDefaults(defineProps<{ size?: number | string; color?: string; accent?: string; label?: string; spin?: boolean }>(), {`,
+        `  size: 24,`,
+        `  color: "currentColor",`,
+        `  accent: "${random.pick(STYLE_COLORS)}",`,
+        `  label: "",`,
+        `  spin: false,`,
+        `});`,
+        ``,
+        `const uid = getCurrentInstance()?.uid ?? 0;`,
+        `</script>`,
+      ].join("\n")
+    : [
+        `<script>`,
+        `let nextId = 0;`,
+        ``,
+        `export default {`,
+        `  name: "Icon${pascal(name)}",`,
+        `  props: {`,
+        `    size: { type: [Number, String], default: 24 },`,
+        `    color: { type: String, default: "currentColor" },`,
+        `    accent: { type: String, default: "${random.pick(STYLE_COLORS)}" },`,
+        `    label: { type: String, default: "" },`,
+        `    spin: Boolean,`,
+        `  },`,
+        `  data: () => ({ uid: nextId++ }),`,
+        `};`,
+        `</script>`,
+      ].join("\n");
+  features.push(script.includes("setup") ? "script-setup" : "options-api");
+
+  const [style, styleFeatures] = random.chance(0.5)
+    ? [`\n<style scoped>\n.icon {\n  display: inline-block;\n  vertical-align: middle;\n}\n\n.icon--spin {\n  animation: spin 1s linear infinite;\n}\n\n@keyframes spin {\n  to {\n    transform: rotate(360deg);\n  }\n}\n</style>\n`, ["scoped-style"]]
+    : ["", []];
+  return { name: `icon-${name}-${index}`, text: `${template}\n\n${script}\n${style}`, features: features.concat(styleFeatures) };
+}
+
+// i18n ---------------------------------------------------------------------------
+
+function i18nPage(random, index) {
+  const entity = random.pick(ENTITIES);
+  const block = `${kebab(entity)}-page`;
+  const keyCount = random.skewed(5, 120);
+  const keys = Array.from({ length: keyCount }, (_, i) => `${random.pick(["title", "label", "hint", "error", "action", "empty"])}${pascal(random.pick(FIELDS))}${i}`);
+  const locales = random.sample(["en", "zh-CN", "ja", "de", "fr", "es", "pt-BR", "ko"], random.int(2, 5));
+  const features = ["i18n"];
+  const yaml = random.chance(0.35);
+  features.push(yaml ? "i18n-yaml" : "i18n-json");
+
+  const phrase = (locale, key) => {
+    const words = {
+      en: ["Show", "the", "current", "value", "for", "this", "item", "please", "try", "again"],
+      "zh-CN": ["显示", "当前", "的", "数值", "请", "稍后", "再试", "项目", "列表", "详情"],
+      ja: ["表示", "現在", "の", "値", "もう一度", "お試し", "ください", "項目", "一覧"],
+      de: ["Zeige", "den", "aktuellen", "Wert", "für", "diesen", "Eintrag", "bitte", "erneut"],
+      fr: ["Afficher", "la", "valeur", "actuelle", "pour", "cet", "élément", "veuillez", "réessayer"],
+      es: ["Mostrar", "el", "valor", "actual", "para", "este", "elemento", "inténtelo", "de", "nuevo"],
+      "pt-BR": ["Mostrar", "o", "valor", "atual", "deste", "item", "tente", "novamente"],
+      ko: ["현재", "값", "을", "표시", "다시", "시도", "하세요", "항목"],
+    }[locale];
+    const text = Array.from({ length: random.int(2, 8) }, () => random.pick(words)).join(locale.startsWith("zh") || locale === "ja" ? "" : " ");
+    return random.chance(0.2) ? `${text} {count}` : random.chance(0.1) ? `${text} @:common.${key.slice(0, 5)}` : text;
+  };
+
+  const messages = yaml
+    ? locales.map((locale) => `${locale}:\n${keys.map((key) => `  ${key}: "${phrase(locale, key)}"`).join("\n")}`).join("\n")
+    : "{\n" +
+      locales
+        .map((locale) => `  "${locale}": {\n${keys.map((key) => `    "${key}": "${phrase(locale, key)}"`).join(",\n")}\n  }`)
+        .join(",\n") +
+      "\n}";
+
+  const usages = keys.slice(0, Math.min(keys.length, random.int(5, 60))).map((key, i) => {
+    switch (i % 5) {
+      case 0:
+        return `    <h3>{{ t('${key}') }}</h3>`;
+      case 1:
+        return `    <p :title="t('${key}')">{{ t('${key}', { count: items.length }) }}</p>`;
+      case 2:
+        return `    <i18n-t keypath="${key}" tag="p" scope="global">\n      <template #count>\n        <strong>{{ n(items.length) }}</strong>\n      </template>\n    </i18n-t>`;
+      case 3:
+        return `    <button type="button" :aria-label="$t('${key}')" @click="act('${key}')">{{ $t('${key}') }}</button>`;
+      default:
+        return `    <span v-t="'${key}'" />`;
+    }
+  });
+
+  const template = [
+    `<template>`,
+    `  <section class="${block}" :lang="locale">`,
+    `    <select v-model="locale">`,
+    `      <option v-for="code in availableLocales" :key="code" :value="code">{{ code }}</option>`,
+    `    </select>`,
+    usages.join("\n"),
+    `    <p>{{ d(updatedAt, 'long') }}</p>`,
+    `  </section>`,
+    `</template>`,
+  ].join("\n");
+
+  const script = [
+    `<script setup lang="ts">`,
+    `import { ref } from "vue";`,
+    `import { useI18n } from "vue-i18n";`,
+    ``,
+    `const { t, n, d, locale, availableLocales } = useI18n({ useScope: "local", inheritLocale: true });`,
+    `const items = ref<string[]>([]);`,
+    `const updatedAt = new Date();`,
+    ``,
+    `function act(key: string): void {`,
+    `  console.info("action", key, locale.value);`,
+    `}`,
+    `</script>`,
+  ].join("\n");
+  features.push("script-setup", "typescript");
+
+  const i18n = `\n<i18n lang="${yaml ? "yaml" : "json"}">\n${messages}\n</i18n>\n`;
+  const [style, styleFeatures] = styleBlocks(random, block, random.skewed(1, 6));
+  return {
+    name: `${kebab(entity)}-i18n-${index}`,
+    text: `${template}\n\n${script}\n${i18n}${style}`,
+    features: features.concat(styleFeatures),
+  };
+}
+
+// Style-heavy layout components ------------------------------------------------
+
+function styledLayout(random, index) {
+  const name = random.pick(["app-shell", "sidebar", "dashboard", "card-grid", "landing-hero", "pricing", "navbar", "modal"]);
+  const block = name;
+  const features = ["style-heavy"];
+  const slots = random.sample(["header", "sidebar", "default", "footer", "actions", "aside"], random.int(2, 5));
+
+  const template = [
+    `<template>`,
+    `  <div :class="[$style.root, { [$style.collapsed]: collapsed }]" class="${block}">`,
+    ...slots.map((slot) =>
+      slot === "default"
+        ? `    <main class="${block}__main">\n      <slot />\n    </main>`
+        : `    <div v-if="$slots.${slot}" class="${block}__${slot}">\n      <slot name="${slot}" :collapsed="collapsed" :toggle="toggle" />\n    </div>`,
+    ),
+    `  </div>`,
+    `</template>`,
+  ].join("\n");
+
+  const script = random.chance(0.5)
+    ? `<script setup lang="ts">\nimport { ref, useCssModule } from "vue";\n\nconst $style = useCssModule();\nconst collapsed = ref(false);\nconst color = ref("${random.pick(STYLE_COLORS)}");\nconst size = ref(${random.int(12, 18)});\nconst toggle = () => (collapsed.value = !collapsed.value);\n</script>`
+    : `<script>\nexport default {\n  name: "${pascal(name)}",\n  data: () => ({ collapsed: false, color: "${random.pick(STYLE_COLORS)}", size: ${random.int(12, 18)} }),\n  methods: {\n    toggle() {\n      this.collapsed = !this.collapsed;\n    },\n  },\n};\n</script>`;
+  features.push(script.includes("setup") ? "script-setup" : "options-api");
+
+  const blocks = [
+    `\n<style module>\n.root {\n  display: grid;\n  grid-template-columns: ${random.int(180, 280)}px 1fr;\n  min-height: 100vh;\n}\n\n.collapsed {\n  grid-template-columns: ${random.int(48, 72)}px 1fr;\n}\n\n${styleRules(random, block, random.skewed(2, 30))}\n</style>\n`,
+  ];
+  features.push("module-style");
+  if (random.chance(0.7)) {
+    blocks.push(`\n<style lang="scss" scoped>\n${scssRules(random, block, random.skewed(2, 40))}\n</style>\n`);
+    features.push("scoped-style", "scss");
+  }
+  if (random.chance(0.4)) {
+    blocks.push(`\n<style scoped>\n.${block} {\n  color: v-bind(color);\n  font-size: v-bind("size + 'px'");\n}\n</style>\n`);
+    features.push("css-v-bind");
+  }
+  if (random.chance(0.3)) {
+    blocks.push(`\n<style>\n:root {\n${Array.from({ length: random.int(4, 30) }, (_, i) => `  --${block}-color-${i}: ${random.pick(STYLE_COLORS)};`).join("\n")}\n}\n</style>\n`);
+    features.push("plain-style");
+  }
+  return { name: `${name}-${index}`, text: `${template}\n\n${script}\n${blocks.join("")}`, features: [...new Set(features)] };
+}
+
+// ------------------------------------------------------------------------------
+
+const CATEGORIES = [
+  ["options-api", optionsApi],
+  ["script-setup", scriptSetup],
+  ["data-table", dataTable],
+  ["form", formPage],
+  ["svg", svgIcon],
+  ["i18n", i18nPage],
+  ["styles", styledLayout],
+];
+
+fs.rmSync(outputDir, { recursive: true, force: true });
+const manifest = [];
+CATEGORIES.forEach(([category, generate], categoryIndex) => {
+  const random = createRandom(0x5fc + categoryIndex * 7919);
+  fs.mkdirSync(path.join(outputDir, category), { recursive: true });
+  for (let i = 1; i <= FILES_PER_CATEGORY; i++) {
+    const component = generate(random, String(i).padStart(3, "0"));
+    const file = `${category}/${component.name}.vue`;
+    const text = component.text.replace(/\n{3,}/g, "\n\n").replace(/\s*$/, "\n");
+    fs.writeFileSync(path.join(outputDir, file), text);
+    manifest.push({
+      file,
+      category,
+      bytes: Buffer.byteLength(text),
+      lines: text.split("\n").length - 1,
+      features: [...new Set(component.features)].sort(),
+    });
+  }
+});
+
+fs.writeFileSync(
+  path.join(outputDir, "manifest.json"),
+  "[\n" + manifest.map((entry) => "  " + JSON.stringify(entry)).join(",\n") + "\n]\n",
+);
+const totalBytes = manifest.reduce((sum, entry) => sum + entry.bytes, 0);
+console.log(`wrote ${manifest.length} components (${(totalBytes / 1024).toFixed(0)} KB) to ${path.relative(root, outputDir)}/`);
@@ -0,0 +1,182 @@
+#!/usr/bin/env node
+// Builds src/lex_table.h, the dense transition table used by
+// src/parser_table_lexer.c, from the `ts_lex` function in src/parser.c.
+//
+// Every lex state is evaluated against each ASCII byte and against EOF, so
+// the table reproduces the generated `if (lookahead ...)` chains exactly.
+// Bytes whose columns are identical in every state share a byte class.
+// Re-run this after `tree-sitter generate`.
+
+const fs = require("fs");
+const path = require("path");
+
+const root = path.resolve(__dirname, "..");
+const parserPath = path.join(root, "src", "parser.c");
+const outputPath = path.join(root, "src", "lex_table.h");
+
+const ASCII_COUNT = 128;
+const SKIP_FLAG = 0x8000;
+
+const source = fs.readFileSync(parserPath, "utf8");
+
+function cCharToNumber(literal) {
+  const body = literal.slice(1, -1);
+  if (body[0] !== "\\") return body.codePointAt(0);
+  const escapes = { n: 10, r: 13, t: 9, v: 11, f: 12, b: 8, a: 7, 0: 0, "\\": 92, "'": 39, '"': 34, "?": 63 };
+  if (body[1] === "x") return parseInt(body.slice(2), 16);
+  if (body[1] === "u" || body[1] === "U") return parseInt(body.slice(2), 16);
+  if (/^[0-7]+$/.test(body.slice(1))) return parseInt(body.slice(1), 8);
+  if (body[1] in escapes) return escapes[body[1]];
+  throw new Error(`unsupported character literal ${literal}`);
+}
+
+// Turns a C condition over `lookahead`/`eof` into an equivalent JS expression.
+function toJs(expression) {
+  return expression
+    .replace(/L?'(?:\\.[0-9a-fA-F]*|[^'\\])'/g, (literal) => String(cCharToNumber(literal.replace(/^L/, ""))))
+    .replace(/\b(0x[0-9a-fA-F]+|\d+)[uUlL]*\b/g, "$1");
+}
+
+// Character-set helpers emitted above `ts_lex`, in both the inline-function
+// and the `set_contains` range-table forms.
+const helpers = {};
+for (const match of source.matchAll(/static inline bool (\w+)\(int32_t c\) \{\s*return ([\s\S]*?);\s*\}/g)) {
+  helpers[match[1]] = new Function("c", `return (${toJs(match[2])});`);
+}
+for (const match of source.matchAll(/static (?:const )?TSCharacterRange (\w+)\[\] = \{([\s\S]*?)\};/g)) {
+  const ranges = [...match[2].matchAll(/\{\s*([^,]+?)\s*,\s*([^}]+?)\s*\}/g)].map((range) =>
+    [range[1], range[2]].map((bound) => Number(toJs(bound))),
+  );
+  helpers[match[1]] = ranges;
+}
+const setContains = (ranges, _count, c) => ranges.some(([start, end]) => start <= c && c <= end);
+
+const lexMatch = source.match(/static bool ts_lex\(TSLexer \*lexer, TSStateId state\) \{\n([\s\S]*?)\n\}\n/);
+if (!lexMatch) {
+  throw new Error("could not find ts_lex in src/parser.c");
+}
+
+const caseRegex = /^    case (\d+):\n([\s\S]*?)(?=^    case \d+:|^    default:)/gm;
+const states = [];
+for (const match of lexMatch[1].matchAll(caseRegex)) {
+  states[Number(match[1])] = parseState(Number(match[1]), match[2]);
+}
+for (let i = 0; i < states.length; i++) {
+  if (!states[i]) throw new Error(`lex state ${i} is missing`);
+}
+
+function parseState(id, body) {
+  const state = { accept: null, rules: [] };
+  const statements = body.replace(/\s+/g, " ").trim();
+  const statementRegex =
+    /ACCEPT_TOKEN\((\w+)\);|END_STATE\(\);|ADVANCE_MAP\(([^)]*)\);|(?:if \(((?:[^()]|\((?:[^()]|\([^()]*\))*\))*)\) )?(ADVANCE|SKIP)\((\d+)\);?/gy;
+  let offset = 0;
+  while (offset < statements.length) {
+    statementRegex.lastIndex = offset;
+    const match = statementRegex.exec(statements);
+    if (!match) {
+      throw new Error(`lex state ${id}: cannot parse "${statements.slice(offset, offset + 60)}"`);
+    }
+    offset = statementRegex.lastIndex;
+    while (statements[offset] === " ") offset++;
+
+    if (match[1]) {
+      state.accept = match[1];
+    } else if (match[2] !== undefined) {
+      const items = match[2].split(",").map((item) => item.trim());
+      for (let i = 0; i + 1 < items.length; i += 2) {
+        const c = Number(toJs(items[i]));
+        state.rules.push({ test: (lookahead) => lookahead === c, skip: false, target: Number(items[i + 1]) });
+      }
+    } else if (match[4]) {
+      const condition = match[3] === undefined ? "true" : toJs(match[3]);
+      const test = new Function(
+        "lookahead",
+        "eof",
+        "helpers",
+        "set_contains",
+        `with (helpers) { return (${condition}); }`,
+      );
+      state.rules.push({
+        test: (lookahead, eof) => test(lookahead, eof, helpers, setContains),
+        skip: match[4] === "SKIP",
+        target: Number(match[5]),
+      });
+    } else {
+      break;
+    }
+  }
+  return state;
+}
+
+function action(state, lookahead, eof) {
+  for (const rule of state.rules) {
+    if (rule.test(lookahead, eof)) {
+      return (rule.target + 1) | (rule.skip ? SKIP_FLAG : 0);
+    }
+  }
+  return 0;
+}
+
+// columns[c] is the action of every state for byte c; the last column is EOF.
+const columns = [];
+for (let c = 0; c < ASCII_COUNT; c++) {
+  columns.push(states.map((state) => action(state, c, false)));
+}
+columns.push(states.map((state) => action(state, 0, true)));
+
+const classIds = new Map();
+const classColumns = [];
+const byteClasses = columns.slice(0, ASCII_COUNT).map((column) => {
+  const key = column.join(",");
+  if (!classIds.has(key)) {
+    classIds.set(key, classColumns.length);
+    classColumns.push(column);
+  }
+  return classIds.get(key);
+});
+const eofClass = classColumns.length;
+classColumns.push(columns[ASCII_COUNT]);
+
+if (classColumns.length > 256) {
+  throw new Error(`${classColumns.length} byte classes do not fit in uint8_t`);
+}
+
+const hex = (value) => `0x${value.toString(16).padStart(4, "0")}`;
+const lines = [];
+lines.push("// Generated by script/generate-lex-table.js from src/parser.c. Do not edit.");
+lines.push("");
+lines.push("#ifndef TREE_SITTER_VUE3_LEX_TABLE_H_");
+lines.push("#define TREE_SITTER_VUE3_LEX_TABLE_H_");
+lines.push("");
+lines.push(`#define LEX_TABLE_STATE_COUNT ${states.length}`);
+lines.push(`#define LEX_TABLE_CLASS_COUNT ${classColumns.length}`);
+lines.push(`#define LEX_TABLE_EOF_CLASS ${eofClass}`);
+lines.push(`#define LEX_TABLE_SKIP ${hex(SKIP_FLAG)}`);
+lines.push("");
+lines.push("static const uint8_t ts_lex_table_classes[128] = {");
+for (let c = 0; c < ASCII_COUNT; c += 16) {
+  lines.push(`  ${byteClasses.slice(c, c + 16).join(", ")},`);
+}
+lines.push("};");
+lines.push("");
+lines.push("static const TSSymbol ts_lex_table_accept[LEX_TABLE_STATE_COUNT] = {");
+states.forEach((state, id) => {
+  lines.push(`  [${id}] = ${state.accept || "ts_builtin_sym_error"},`);
+});
+lines.push("};");
+lines.push("");
+lines.push("// 0 ends the token; otherwise the next state plus one, with LEX_TABLE_SKIP");
+lines.push("// set when the character is skipped rather than advanced over.");
+lines.push("static const uint16_t ts_lex_table_actions[LEX_TABLE_STATE_COUNT][LEX_TABLE_CLASS_COUNT] = {");
+states.forEach((_, id) => {
+  const row = classColumns.map((column) => (column[id] ? hex(column[id]) : "0"));
+  lines.push(`  [${id}] = {${row.join(", ")}},`);
+});
+lines.push("};");
+lines.push("");
+lines.push("#endif");
+lines.push("");
+
+fs.writeFileSync(outputPath, lines.join("\n"));
+console.log(`${path.relative(root, outputPath)}: ${states.length} states, ${classColumns.length} byte classes`);
@@ -0,0 +1,53 @@
+import shlex
+import subprocess
+import warnings
+
+from setuptools import Extension, find_packages, setup
+
+
+# The tree-sitter runtime comes from the system through pkg-config, as for the
+# benchmarks in bench/. If pkg-config cannot find it, the extension still
+# links -ltree-sitter, and its paths have to be passed in CFLAGS and LDFLAGS.
+def pkg_config(option, fallback):
+    try:
+        output = subprocess.check_output(["pkg-config", option, "tree-sitter"], text=True)
+    except (OSError, subprocess.CalledProcessError):
+        warnings.warn(
+            f"pkg-config {option} tree-sitter failed; using {' '.join(fallback) or 'no flags'}. "
+            "Set PKG_CONFIG_PATH, or pass the paths of libtree-sitter in CFLAGS and LDFLAGS."
+        )
+        return fallback
+    return shlex.split(output)
+
+
+setup(
+    packages=find_packages("bindings/python"),
+    package_dir={"": "bindings/python"},
+    package_data={
+        "tree_sitter_vue": ["*.pyi", "py.typed"],
+    },
+    ext_package="tree_sitter_vue",
+    ext_modules=[
+        Extension(
+            name="_binding",
+            sources=[
+                "bindings/python/tree_sitter_vue/binding.cc",
+                "bindings/node/extract.cc",
+                "src/parser.c",
+                "src/scanner.c",
+            ],
+            include_dirs=["src", "bindings/node"],
+            # Also listed in MANIFEST.in, so that they reach the sdist.
+            depends=[
+                "bindings/node/extract.h",
+                "src/scanner_stats.h",
+                "src/tree_sitter/parser.h",
+                "src/tree_sitter_html/scanner.cc",
+                "src/tree_sitter_html/tag.h",
+            ],
+            extra_compile_args=["-O3", *pkg_config("--cflags", [])],
+            extra_link_args=pkg_config("--libs", ["-ltree-sitter"]),
+        )
+    ],
+    zip_safe=False,
+)
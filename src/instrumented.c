@@ -0,0 +1,170 @@
+#include <tree_sitter/parser.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <time.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+#include "instrumented.h"
+
+const TSLanguage *tree_sitter_vue3(void);
+
+typedef struct {
+  atomic_uint_fast64_t calls;
+  atomic_uint_fast64_t ticks;
+} PhaseCounters;
+
+static PhaseCounters phase_counters[TS_VUE3_PHASE_COUNT];
+
+static const char *const PHASE_NAMES[TS_VUE3_PHASE_COUNT] = {
+  [TS_VUE3_PHASE_LEX] = "lex",
+  [TS_VUE3_PHASE_KEYWORD_LEX] = "keyword_lex",
+  [TS_VUE3_PHASE_SCANNER_CREATE] = "scanner_create",
+  [TS_VUE3_PHASE_SCANNER_DESTROY] = "scanner_destroy",
+  [TS_VUE3_PHASE_SCANNER_SCAN] = "scanner_scan",
+  [TS_VUE3_PHASE_SCANNER_SERIALIZE] = "scanner_serialize",
+  [TS_VUE3_PHASE_SCANNER_DESERIALIZE] = "scanner_deserialize",
+};
+
+static inline uint64_t ticks_now(void) {
+#if defined(__x86_64__) || defined(__i386__)
+  return __rdtsc();
+#elif defined(__aarch64__)
+  uint64_t value;
+  __asm__ __volatile__("mrs %0, cntvct_el0" : "=r"(value));
+  return value;
+#else
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+#endif
+}
+
+static inline void phase_record(TSVue3Phase phase, uint64_t start) {
+  uint64_t elapsed = ticks_now() - start;
+  atomic_fetch_add_explicit(&phase_counters[phase].calls, 1, memory_order_relaxed);
+  atomic_fetch_add_explicit(&phase_counters[phase].ticks, elapsed, memory_order_relaxed);
+}
+
+static bool instrumented_lex(TSLexer *lexer, TSStateId state) {
+  uint64_t start = ticks_now();
+  bool result = tree_sitter_vue3()->lex_fn(lexer, state);
+  phase_record(TS_VUE3_PHASE_LEX, start);
+  return result;
+}
+
+static bool instrumented_keyword_lex(TSLexer *lexer, TSStateId state) {
+  uint64_t start = ticks_now();
+  bool result = tree_sitter_vue3()->keyword_lex_fn(lexer, state);
+  phase_record(TS_VUE3_PHASE_KEYWORD_LEX, start);
+  return result;
+}
+
+static void *instrumented_scanner_create(void) {
+  uint64_t start = ticks_now();
+  void *payload = tree_sitter_vue3()->external_scanner.create();
+  phase_record(TS_VUE3_PHASE_SCANNER_CREATE, start);
+  return payload;
+}
+
+static void instrumented_scanner_destroy(void *payload) {
+  uint64_t start = ticks_now();
+  tree_sitter_vue3()->external_scanner.destroy(payload);
+  phase_record(TS_VUE3_PHASE_SCANNER_DESTROY, start);
+}
+
+static bool instrumented_scanner_scan(void *payload, TSLexer *lexer, const bool *valid_symbols) {
+  uint64_t start = ticks_now();
+  bool result = tree_sitter_vue3()->external_scanner.scan(payload, lexer, valid_symbols);
+  phase_record(TS_VUE3_PHASE_SCANNER_SCAN, start);
+  return result;
+}
+
+static unsigned instrumented_scanner_serialize(void *payload, char *buffer) {
+  uint64_t start = ticks_now();
+  unsigned length = tree_sitter_vue3()->external_scanner.serialize(payload, buffer);
+  phase_record(TS_VUE3_PHASE_SCANNER_SERIALIZE, start);
+  return length;
+}
+
+static void instrumented_scanner_deserialize(void *payload, const char *buffer, unsigned length) {
+  uint64_t start = ticks_now();
+  tree_sitter_vue3()->external_scanner.deserialize(payload, buffer, length);
+  phase_record(TS_VUE3_PHASE_SCANNER_DESERIALIZE, start);
+}
+
+static TSLanguage instrumented_language;
+static atomic_int instrumented_language_state;
+
+const TSLanguage *tree_sitter_vue3_instrumented(void) {
+  enum { UNINITIALIZED, INITIALIZING, READY };
+
+  int state = atomic_load_explicit(&instrumented_language_state, memory_order_acquire);
+  if (state == READY) return &instrumented_language;
+
+  int expected = UNINITIALIZED;
+  if (atomic_compare_exchange_strong(&instrumented_language_state, &expected, INITIALIZING)) {
+    const TSLanguage *base = tree_sitter_vue3();
+    instrumented_language = *base;
+    instrumented_language.lex_fn = instrumented_lex;
+    if (base->keyword_lex_fn) {
+      instrumented_language.keyword_lex_fn = instrumented_keyword_lex;
+    }
+    if (base->external_scanner.create) {
+      instrumented_language.external_scanner.create = instrumented_scanner_create;
+      instrumented_language.external_scanner.destroy = instrumented_scanner_destroy;
+      instrumented_language.external_scanner.scan = instrumented_scanner_scan;
+      instrumented_language.external_scanner.serialize = instrumented_scanner_serialize;
+      instrumented_language.external_scanner.deserialize = instrumented_scanner_deserialize;
+    }
+    atomic_store_explicit(&instrumented_language_state, READY, memory_order_release);
+  } else {
+    while (atomic_load_explicit(&instrumented_language_state, memory_order_acquire) != READY) {
+    }
+  }
+
+  return &instrumented_language;
+}
+
+void tree_sitter_vue3_instrumented_stats(TSVue3Stats *stats) {
+  if (!stats) return;
+  for (unsigned i = 0; i < TS_VUE3_PHASE_COUNT; i++) {
+    stats->phases[i].calls = atomic_load_explicit(&phase_counters[i].calls, memory_order_relaxed);
+    stats->phases[i].ticks = atomic_load_explicit(&phase_counters[i].ticks, memory_order_relaxed);
+  }
+}
+
+void tree_sitter_vue3_instrumented_reset(void) {
+  for (unsigned i = 0; i < TS_VUE3_PHASE_COUNT; i++) {
+    atomic_store_explicit(&phase_counters[i].calls, 0, memory_order_relaxed);
+    atomic_store_explicit(&phase_counters[i].ticks, 0, memory_order_relaxed);
+  }
+}
+
+double tree_sitter_vue3_instrumented_ticks_per_second(void) {
+  static _Atomic double ticks_per_second;
+  double rate = atomic_load_explicit(&ticks_per_second, memory_order_relaxed);
+  if (rate > 0) return rate;
+
+  struct timespec start_time, now;
+  clock_gettime(CLOCK_MONOTONIC, &start_time);
+  uint64_t start = ticks_now();
+  uint64_t elapsed_ns = 0;
+  do {
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    elapsed_ns = (uint64_t)(now.tv_sec - start_time.tv_sec) * 1000000000u +
+                 (uint64_t)(now.tv_nsec - start_time.tv_nsec);
+  } while (elapsed_ns < 10000000);
+  rate = (double)(ticks_now() - start) * 1e9 / (double)elapsed_ns;
+
+  atomic_store_explicit(&ticks_per_second, rate, memory_order_relaxed);
+  return rate;
+}
+
+const char *tree_sitter_vue3_phase_name(TSVue3Phase phase) {
+  if ((unsigned)phase >= TS_VUE3_PHASE_COUNT) return NULL;
+  return PHASE_NAMES[phase];
+}
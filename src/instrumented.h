@@ -0,0 +1,55 @@
+#ifndef TREE_SITTER_VUE3_INSTRUMENTED_H_
+#define TREE_SITTER_VUE3_INSTRUMENTED_H_
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct TSLanguage TSLanguage;
+
+// The phases of a parse that tree_sitter_vue3_instrumented() times. Whatever
+// is left of the total parse time is spent in the parser itself.
+typedef enum {
+  TS_VUE3_PHASE_LEX,
+  TS_VUE3_PHASE_KEYWORD_LEX,
+  TS_VUE3_PHASE_SCANNER_CREATE,
+  TS_VUE3_PHASE_SCANNER_DESTROY,
+  TS_VUE3_PHASE_SCANNER_SCAN,
+  TS_VUE3_PHASE_SCANNER_SERIALIZE,
+  TS_VUE3_PHASE_SCANNER_DESERIALIZE,
+  TS_VUE3_PHASE_COUNT,
+} TSVue3Phase;
+
+typedef struct {
+  uint64_t calls;
+  uint64_t ticks;
+} TSVue3PhaseStats;
+
+typedef struct {
+  TSVue3PhaseStats phases[TS_VUE3_PHASE_COUNT];
+} TSVue3Stats;
+
+// Returns a copy of tree_sitter_vue3() whose lexer and external scanner
+// callbacks count their calls and the timer ticks spent inside them. The
+// counters are process-wide and shared by every parser using this language.
+const TSLanguage *tree_sitter_vue3_instrumented(void);
+
+// Copies the current counters into `stats`.
+void tree_sitter_vue3_instrumented_stats(TSVue3Stats *stats);
+
+// Zeroes all counters.
+void tree_sitter_vue3_instrumented_reset(void);
+
+// Ticks are CPU timestamp-counter cycles where one is available and
+// nanoseconds otherwise. Returns the measured tick rate.
+double tree_sitter_vue3_instrumented_ticks_per_second(void);
+
+const char *tree_sitter_vue3_phase_name(TSVue3Phase phase);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
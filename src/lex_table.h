@@ -0,0 +1,114 @@
+// Generated by script/generate-lex-table.js from src/parser.c. Do not edit.
+
+#ifndef TREE_SITTER_VUE3_LEX_TABLE_H_
+#define TREE_SITTER_VUE3_LEX_TABLE_H_
+
+#define LEX_TABLE_STATE_COUNT 42
+#define LEX_TABLE_CLASS_COUNT 19
+#define LEX_TABLE_EOF_CLASS 18
+#define LEX_TABLE_SKIP 0x8000
+
+static const uint8_t ts_lex_table_classes[128] = {
+  0, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 1, 1, 2, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  2, 1, 3, 4, 1, 1, 1, 5, 1, 1, 1, 1, 1, 6, 7, 8,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 9, 1, 10, 11, 12, 1,
+  4, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 13, 1, 14, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 15, 1, 1, 1, 1, 16, 1, 17, 1, 1,
+};
+
+static const TSSymbol ts_lex_table_accept[LEX_TABLE_STATE_COUNT] = {
+  [0] = ts_builtin_sym_error,
+  [1] = ts_builtin_sym_error,
+  [2] = ts_builtin_sym_error,
+  [3] = ts_builtin_sym_error,
+  [4] = ts_builtin_sym_error,
+  [5] = ts_builtin_sym_error,
+  [6] = ts_builtin_sym_error,
+  [7] = ts_builtin_sym_error,
+  [8] = ts_builtin_sym_error,
+  [9] = ts_builtin_sym_error,
+  [10] = ts_builtin_sym_error,
+  [11] = ts_builtin_sym_error,
+  [12] = ts_builtin_sym_error,
+  [13] = ts_builtin_sym_error,
+  [14] = ts_builtin_sym_error,
+  [15] = ts_builtin_sym_error,
+  [16] = ts_builtin_sym_end,
+  [17] = anon_sym_LT,
+  [18] = anon_sym_GT,
+  [19] = anon_sym_SLASH_GT,
+  [20] = anon_sym_LT_SLASH,
+  [21] = anon_sym_EQ,
+  [22] = sym_attribute_name,
+  [23] = sym_attribute_name,
+  [24] = sym_attribute_name,
+  [25] = sym_attribute_value,
+  [26] = anon_sym_SQUOTE,
+  [27] = aux_sym_quoted_attribute_value_token1,
+  [28] = aux_sym_quoted_attribute_value_token1,
+  [29] = anon_sym_DQUOTE,
+  [30] = aux_sym_quoted_attribute_value_token2,
+  [31] = aux_sym_quoted_attribute_value_token2,
+  [32] = anon_sym_LBRACE_LBRACE,
+  [33] = anon_sym_RBRACE_RBRACE,
+  [34] = anon_sym_COLON,
+  [35] = sym_directive_name,
+  [36] = sym_directive_shorthand,
+  [37] = aux_sym_directive_argument_token1,
+  [38] = anon_sym_LBRACK,
+  [39] = anon_sym_RBRACK,
+  [40] = sym_directive_dynamic_argument_value,
+  [41] = anon_sym_DOT,
+};
+
+// 0 ends the token; otherwise the next state plus one, with LEX_TABLE_SKIP
+// set when the character is skipped rather than advanced over.
+static const uint16_t ts_lex_table_actions[LEX_TABLE_STATE_COUNT][LEX_TABLE_CLASS_COUNT] = {
+  [0] = {0, 0, 0x8010, 0x001e, 0x0025, 0x001b, 0, 0x002a, 0x0006, 0x0023, 0x0012, 0x0016, 0x0013, 0x0027, 0x0028, 0x0005, 0x0009, 0x000a, 0x0011},
+  [1] = {0, 0x001a, 0x8002, 0x001e, 0x001a, 0x001b, 0x001a, 0x001a, 0x001a, 0x001a, 0, 0, 0, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0},
+  [2] = {0, 0x0020, 0x001f, 0x001e, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0},
+  [3] = {0, 0x001d, 0x001c, 0x001d, 0x001d, 0x001b, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d, 0},
+  [4] = {0, 0, 0, 0, 0, 0, 0x000e, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+  [5] = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x0014, 0, 0, 0, 0, 0, 0},
+  [6] = {0, 0x0026, 0, 0, 0x0026, 0, 0x0026, 0, 0, 0x0026, 0, 0, 0, 0x0027, 0x0026, 0x0026, 0x0026, 0x0026, 0},
+  [7] = {0, 0x0029, 0, 0, 0x0029, 0, 0x0029, 0x0029, 0, 0x0029, 0, 0, 0, 0x0029, 0x0028, 0x0029, 0x0029, 0x0029, 0},
+  [8] = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x0021, 0, 0},
+  [9] = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x0022, 0},
+  [10] = {0, 0x0019, 0x800d, 0, 0x0025, 0, 0x0019, 0x002a, 0x0006, 0x0023, 0, 0x0016, 0x0013, 0x0019, 0x0019, 0x0017, 0x0019, 0x0019, 0},
+  [11] = {0, 0x0019, 0x800d, 0, 0x0025, 0, 0x0019, 0x002a, 0x0006, 0x0025, 0, 0x0016, 0x0013, 0x0019, 0x0019, 0x0017, 0x0019, 0x0019, 0},
+  [12] = {0, 0x0019, 0x800d, 0, 0x0025, 0, 0x0019, 0x0019, 0x0006, 0x0025, 0, 0x0016, 0x0013, 0x0019, 0x0019, 0x0017, 0x0019, 0x0019, 0},
+  [13] = {0, 0x0024, 0, 0, 0x0024, 0, 0x0024, 0, 0, 0, 0, 0, 0, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0},
+  [14] = {0, 0x0026, 0, 0, 0x0026, 0, 0x0026, 0, 0, 0x0026, 0, 0, 0, 0x0026, 0x0026, 0x0026, 0x0026, 0x0026, 0},
+  [15] = {0, 0, 0x8010, 0x001e, 0x0025, 0x001b, 0, 0, 0x0006, 0x0025, 0x0012, 0x0016, 0x0013, 0, 0, 0x0005, 0x0009, 0x000a, 0x0011},
+  [16] = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+  [17] = {0, 0, 0, 0, 0, 0, 0, 0, 0x0015, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+  [18] = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+  [19] = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+  [20] = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+  [21] = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+  [22] = {0, 0x0019, 0, 0, 0x0019, 0, 0x0018, 0x0019, 0, 0x0019, 0, 0, 0, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0},
+  [23] = {0, 0x0024, 0, 0, 0x0024, 0, 0x0024, 0x0019, 0, 0x0019, 0, 0, 0, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0},
+  [24] = {0, 0x0019, 0, 0, 0x0019, 0, 0x0019, 0x0019, 0, 0x0019, 0, 0, 0, 0x0019, 0x0019, 0x0019, 0x0019, 0x0019, 0},
+  [25] = {0, 0x001a, 0, 0, 0x001a, 0, 0x001a, 0x001a, 0x001a, 0x001a, 0, 0, 0, 0x001a, 0x001a, 0x001a, 0x001a, 0x001a, 0},
+  [26] = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+  [27] = {0, 0x001d, 0x001c, 0x001d, 0x001d, 0, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d, 0},
+  [28] = {0, 0x001d, 0x001d, 0x001d, 0x001d, 0, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d, 0x001d, 0},
+  [29] = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+  [30] = {0, 0x0020, 0x001f, 0, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0},
+  [31] = {0, 0x0020, 0x0020, 0, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0},
+  [32] = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+  [33] = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+  [34] = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+  [35] = {0, 0x0024, 0, 0, 0x0024, 0, 0x0024, 0, 0, 0, 0, 0, 0, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0},
+  [36] = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+  [37] = {0, 0x0026, 0, 0, 0x0026, 0, 0x0026, 0, 0, 0x0026, 0, 0, 0, 0x0026, 0x0026, 0x0026, 0x0026, 0x0026, 0},
+  [38] = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+  [39] = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+  [40] = {0, 0x0029, 0, 0, 0x0029, 0, 0x0029, 0x0029, 0, 0x0029, 0, 0, 0, 0x0029, 0, 0x0029, 0x0029, 0x0029, 0},
+  [41] = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+};
+
+#endif
@@ -6,79 +6,92 @@
 #endif
 
 #define LANGUAGE_VERSION 14
-#define STATE_COUNT 190
+#define STATE_COUNT 194
 #define LARGE_STATE_COUNT 2
-#define SYMBOL_COUNT 59
+#define SYMBOL_COUNT 71
 #define ALIAS_COUNT 0
-#define TOKEN_COUNT 33
+#define TOKEN_COUNT 43
 #define EXTERNAL_TOKEN_COUNT 12
 #define FIELD_COUNT 0
 #define MAX_ALIAS_SEQUENCE_LENGTH 6
 #define PRODUCTION_ID_COUNT 1
 
 enum {
-  anon_sym_LT = 1,
-  anon_sym_GT = 2,
-  anon_sym_SLASH_GT = 3,
-  anon_sym_LT_SLASH = 4,
-  anon_sym_EQ = 5,
-  sym_attribute_name = 6,
-  sym_attribute_value = 7,
-  anon_sym_SQUOTE = 8,
-  aux_sym_quoted_attribute_value_token1 = 9,
-  anon_sym_DQUOTE = 10,
-  aux_sym_quoted_attribute_value_token2 = 11,
-  anon_sym_LBRACE_LBRACE = 12,
-  anon_sym_RBRACE_RBRACE = 13,
-  anon_sym_COLON = 14,
-  sym_directive_name = 15,
-  sym_directive_shorthand = 16,
-  aux_sym_directive_argument_token1 = 17,
-  anon_sym_LBRACK = 18,
-  anon_sym_RBRACK = 19,
-  sym_directive_dynamic_argument_value = 20,
-  anon_sym_DOT = 21,
-  sym__text_fragment = 22,
-  sym__interpolation_text = 23,
-  sym__start_tag_name = 24,
-  sym__template_start_tag_name = 25,
-  sym__script_start_tag_name = 26,
-  sym__style_start_tag_name = 27,
-  sym__end_tag_name = 28,
-  sym_erroneous_end_tag_name = 29,
-  sym__implicit_end_tag = 30,
-  sym_raw_text = 31,
-  sym_comment = 32,
-  sym_component = 33,
-  sym__node = 34,
-  sym_element = 35,
-  sym_template_element = 36,
-  sym_script_element = 37,
-  sym_style_element = 38,
-  sym_start_tag = 39,
-  sym_template_start_tag = 40,
-  sym_script_start_tag = 41,
-  sym_style_start_tag = 42,
-  sym_self_closing_tag = 43,
-  sym_end_tag = 44,
-  sym_erroneous_end_tag = 45,
-  sym_attribute = 46,
-  sym_quoted_attribute_value = 47,
-  sym_text = 48,
-  sym_interpolation = 49,
-  sym_directive_attribute = 50,
-  sym_directive_argument = 51,
-  sym_directive_dynamic_argument = 52,
-  sym_directive_modifiers = 53,
-  sym_directive_modifier = 54,
-  aux_sym_component_repeat1 = 55,
-  aux_sym_element_repeat1 = 56,
-  aux_sym_start_tag_repeat1 = 57,
-  aux_sym_directive_modifiers_repeat1 = 58,
+  sym_directive_name = 1,
+  anon_sym_LT = 2,
+  anon_sym_GT = 3,
+  anon_sym_SLASH_GT = 4,
+  anon_sym_LT_SLASH = 5,
+  anon_sym_EQ = 6,
+  sym_attribute_name = 7,
+  sym_attribute_value = 8,
+  anon_sym_SQUOTE = 9,
+  aux_sym_quoted_attribute_value_token1 = 10,
+  anon_sym_DQUOTE = 11,
+  aux_sym_quoted_attribute_value_token2 = 12,
+  anon_sym_LBRACE_LBRACE = 13,
+  anon_sym_RBRACE_RBRACE = 14,
+  anon_sym_COLON = 15,
+  sym_v_if = 16,
+  sym_v_else_if = 17,
+  sym_v_else = 18,
+  sym_v_for = 19,
+  sym_v_show = 20,
+  sym_v_model = 21,
+  sym_v_on = 22,
+  sym_v_bind = 23,
+  sym_v_slot = 24,
+  sym_v_html = 25,
+  sym_directive_shorthand = 26,
+  aux_sym_directive_argument_token1 = 27,
+  anon_sym_LBRACK = 28,
+  anon_sym_RBRACK = 29,
+  sym_directive_dynamic_argument_value = 30,
+  anon_sym_DOT = 31,
+  sym__text_fragment = 32,
+  sym__interpolation_text = 33,
+  sym__start_tag_name = 34,
+  sym__template_start_tag_name = 35,
+  sym__script_start_tag_name = 36,
+  sym__style_start_tag_name = 37,
+  sym__end_tag_name = 38,
+  sym_erroneous_end_tag_name = 39,
+  sym__implicit_end_tag = 40,
+  sym_raw_text = 41,
+  sym_comment = 42,
+  sym_component = 43,
+  sym__node = 44,
+  sym_element = 45,
+  sym_template_element = 46,
+  sym_script_element = 47,
+  sym_style_element = 48,
+  sym_start_tag = 49,
+  sym_template_start_tag = 50,
+  sym_script_start_tag = 51,
+  sym_style_start_tag = 52,
+  sym_self_closing_tag = 53,
+  sym_end_tag = 54,
+  sym_erroneous_end_tag = 55,
+  sym__attribute = 56,
+  sym_attribute = 57,
+  sym_quoted_attribute_value = 58,
+  sym_text = 59,
+  sym_interpolation = 60,
+  sym_directive_attribute = 61,
+  sym__directive_name = 62,
+  sym_directive_argument = 63,
+  sym_directive_dynamic_argument = 64,
+  sym_directive_modifiers = 65,
+  sym_directive_modifier = 66,
+  aux_sym_component_repeat1 = 67,
+  aux_sym_element_repeat1 = 68,
+  aux_sym_start_tag_repeat1 = 69,
+  aux_sym_directive_modifiers_repeat1 = 70,
 };
 
 static const char * const ts_symbol_names[] = {
   [ts_builtin_sym_end] = "end",
+  [sym_directive_name] = "directive_name",
   [anon_sym_LT] = "<",
   [anon_sym_GT] = ">",
   [anon_sym_SLASH_GT] = "/>",
@@ -93,7 +106,16 @@ static const char * const ts_symbol_names[] = {
   [anon_sym_LBRACE_LBRACE] = "{{",
   [anon_sym_RBRACE_RBRACE] = "}}",
   [anon_sym_COLON] = ":",
-  [sym_directive_name] = "directive_name",
+  [sym_v_if] = "v_if",
+  [sym_v_else_if] = "v_else_if",
+  [sym_v_else] = "v_else",
+  [sym_v_for] = "v_for",
+  [sym_v_show] = "v_show",
+  [sym_v_model] = "v_model",
+  [sym_v_on] = "v_on",
+  [sym_v_bind] = "v_bind",
+  [sym_v_slot] = "v_slot",
+  [sym_v_html] = "v_html",
   [sym_directive_shorthand] = "directive_name",
   [aux_sym_directive_argument_token1] = "directive_argument_token1",
   [anon_sym_LBRACK] = "[",
@@ -124,11 +146,13 @@ static const char * const ts_symbol_names[] = {
   [sym_self_closing_tag] = "self_closing_tag",
   [sym_end_tag] = "end_tag",
   [sym_erroneous_end_tag] = "erroneous_end_tag",
+  [sym__attribute] = "_attribute",
   [sym_attribute] = "attribute",
   [sym_quoted_attribute_value] = "quoted_attribute_value",
   [sym_text] = "text",
   [sym_interpolation] = "interpolation",
   [sym_directive_attribute] = "directive_attribute",
+  [sym__directive_name] = "_directive_name",
   [sym_directive_argument] = "directive_argument",
   [sym_directive_dynamic_argument] = "directive_dynamic_argument",
   [sym_directive_modifiers] = "directive_modifiers",
@@ -141,6 +165,7 @@ static const char * const ts_symbol_names[] = {
 
 static const TSSymbol ts_symbol_map[] = {
   [ts_builtin_sym_end] = ts_builtin_sym_end,
+  [sym_directive_name] = sym_directive_name,
   [anon_sym_LT] = anon_sym_LT,
   [anon_sym_GT] = anon_sym_GT,
   [anon_sym_SLASH_GT] = anon_sym_SLASH_GT,
@@ -155,7 +180,16 @@ static const TSSymbol ts_symbol_map[] = {
   [anon_sym_LBRACE_LBRACE] = anon_sym_LBRACE_LBRACE,
   [anon_sym_RBRACE_RBRACE] = anon_sym_RBRACE_RBRACE,
   [anon_sym_COLON] = anon_sym_COLON,
-  [sym_directive_name] = sym_directive_name,
+  [sym_v_if] = sym_v_if,
+  [sym_v_else_if] = sym_v_else_if,
+  [sym_v_else] = sym_v_else,
+  [sym_v_for] = sym_v_for,
+  [sym_v_show] = sym_v_show,
+  [sym_v_model] = sym_v_model,
+  [sym_v_on] = sym_v_on,
+  [sym_v_bind] = sym_v_bind,
+  [sym_v_slot] = sym_v_slot,
+  [sym_v_html] = sym_v_html,
   [sym_directive_shorthand] = sym_directive_name,
   [aux_sym_directive_argument_token1] = aux_sym_directive_argument_token1,
   [anon_sym_LBRACK] = anon_sym_LBRACK,
@@ -186,11 +220,13 @@ static const TSSymbol ts_symbol_map[] = {
   [sym_self_closing_tag] = sym_self_closing_tag,
   [sym_end_tag] = sym_end_tag,
   [sym_erroneous_end_tag] = sym_erroneous_end_tag,
+  [sym__attribute] = sym__attribute,
   [sym_attribute] = sym_attribute,
   [sym_quoted_attribute_value] = sym_quoted_attribute_value,
   [sym_text] = sym_text,
   [sym_interpolation] = sym_interpolation,
   [sym_directive_attribute] = sym_directive_attribute,
+  [sym__directive_name] = sym__directive_name,
   [sym_directive_argument] = sym_directive_argument,
   [sym_directive_dynamic_argument] = sym_directive_dynamic_argument,
   [sym_directive_modifiers] = sym_directive_modifiers,
@@ -206,6 +242,10 @@ static const TSSymbolMetadata ts_symbol_metadata[] = {
     .visible = false,
     .named = true,
   },
+  [sym_directive_name] = {
+    .visible = true,
+    .named = true,
+  },
   [anon_sym_LT] = {
     .visible = true,
     .named = false,
@@ -262,7 +302,43 @@ static const TSSymbolMetadata ts_symbol_metadata[] = {
     .visible = true,
     .named = false,
   },
-  [sym_directive_name] = {
+  [sym_v_if] = {
+    .visible = true,
+    .named = true,
+  },
+  [sym_v_else_if] = {
+    .visible = true,
+    .named = true,
+  },
+  [sym_v_else] = {
+    .visible = true,
+    .named = true,
+  },
+  [sym_v_for] = {
+    .visible = true,
+    .named = true,
+  },
+  [sym_v_show] = {
+    .visible = true,
+    .named = true,
+  },
+  [sym_v_model] = {
+    .visible = true,
+    .named = true,
+  },
+  [sym_v_on] = {
+    .visible = true,
+    .named = true,
+  },
+  [sym_v_bind] = {
+    .visible = true,
+    .named = true,
+  },
+  [sym_v_slot] = {
+    .visible = true,
+    .named = true,
+  },
+  [sym_v_html] = {
     .visible = true,
     .named = true,
   },
@@ -341,6 +417,7 @@ static const TSSymbolMetadata ts_symbol_metadata[] = {
   [sym__node] = {
     .visible = false,
     .named = true,
+    .supertype = true,
   },
   [sym_element] = {
     .visible = true,
@@ -386,6 +463,11 @@ static const TSSymbolMetadata ts_symbol_metadata[] = {
     .visible = true,
     .named = true,
   },
+  [sym__attribute] = {
+    .visible = false,
+    .named = true,
+    .supertype = true,
+  },
   [sym_attribute] = {
     .visible = true,
     .named = true,
@@ -406,6 +488,10 @@ static const TSSymbolMetadata ts_symbol_metadata[] = {
     .visible = true,
     .named = true,
   },
+  [sym__directive_name] = {
+    .visible = false,
+    .named = true,
+  },
   [sym_directive_argument] = {
     .visible = true,
     .named = true,
@@ -452,59 +538,59 @@ static const TSStateId ts_primary_state_ids[STATE_COUNT] = {
   [0] = 0,
   [1] = 1,
   [2] = 2,
-  [3] = 3,
-  [4] = 3,
-  [5] = 2,
+  [3] = 2,
+  [4] = 4,
+  [5] = 4,
   [6] = 2,
-  [7] = 3,
+  [7] = 4,
   [8] = 8,
-  [9] = 8,
+  [9] = 9,
   [10] = 10,
   [11] = 11,
-  [12] = 10,
-  [13] = 8,
-  [14] = 10,
-  [15] = 11,
-  [16] = 16,
-  [17] = 17,
-  [18] = 18,
-  [19] = 18,
+  [12] = 12,
+  [13] = 13,
+  [14] = 11,
+  [15] = 8,
+  [16] = 10,
+  [17] = 11,
+  [18] = 8,
+  [19] = 10,
   [20] = 20,
-  [21] = 21,
-  [22] = 22,
-  [23] = 23,
-  [24] = 20,
+  [21] = 20,
+  [22] = 20,
+  [23] = 9,
+  [24] = 12,
   [25] = 25,
   [26] = 26,
-  [27] = 27,
-  [28] = 22,
-  [29] = 22,
-  [30] = 26,
-  [31] = 21,
-  [32] = 26,
+  [27] = 13,
+  [28] = 28,
+  [29] = 29,
+  [30] = 30,
+  [31] = 31,
+  [32] = 32,
   [33] = 33,
-  [34] = 34,
-  [35] = 27,
+  [34] = 28,
+  [35] = 35,
   [36] = 36,
-  [37] = 37,
+  [37] = 26,
   [38] = 38,
-  [39] = 25,
+  [39] = 39,
   [40] = 40,
-  [41] = 33,
+  [41] = 35,
   [42] = 42,
-  [43] = 43,
+  [43] = 36,
   [44] = 44,
   [45] = 45,
-  [46] = 46,
-  [47] = 23,
-  [48] = 48,
-  [49] = 49,
-  [50] = 50,
+  [46] = 42,
+  [47] = 47,
+  [48] = 39,
+  [49] = 40,
+  [50] = 44,
   [51] = 51,
-  [52] = 52,
+  [52] = 38,
   [53] = 53,
-  [54] = 43,
-  [55] = 55,
+  [54] = 53,
+  [55] = 51,
   [56] = 56,
   [57] = 57,
   [58] = 58,
@@ -512,133 +598,137 @@ static const TSStateId ts_primary_state_ids[STATE_COUNT] = {
   [60] = 60,
   [61] = 61,
   [62] = 62,
-  [63] = 63,
-  [64] = 64,
+  [63] = 45,
+  [64] = 47,
   [65] = 65,
-  [66] = 44,
-  [67] = 67,
-  [68] = 68,
-  [69] = 69,
-  [70] = 45,
-  [71] = 40,
-  [72] = 72,
-  [73] = 42,
+  [66] = 58,
+  [67] = 59,
+  [68] = 60,
+  [69] = 61,
+  [70] = 56,
+  [71] = 57,
+  [72] = 65,
+  [73] = 62,
   [74] = 74,
   [75] = 75,
-  [76] = 56,
-  [77] = 52,
-  [78] = 59,
+  [76] = 76,
+  [77] = 76,
+  [78] = 78,
   [79] = 79,
-  [80] = 49,
-  [81] = 51,
+  [80] = 80,
+  [81] = 81,
   [82] = 82,
-  [83] = 50,
-  [84] = 55,
-  [85] = 60,
+  [83] = 83,
+  [84] = 84,
+  [85] = 85,
   [86] = 86,
   [87] = 87,
   [88] = 88,
-  [89] = 61,
+  [89] = 89,
   [90] = 90,
-  [91] = 53,
-  [92] = 62,
+  [91] = 91,
+  [92] = 92,
   [93] = 93,
-  [94] = 63,
-  [95] = 67,
-  [96] = 68,
-  [97] = 74,
-  [98] = 72,
-  [99] = 99,
-  [100] = 58,
-  [101] = 69,
-  [102] = 102,
-  [103] = 65,
-  [104] = 64,
-  [105] = 105,
-  [106] = 106,
-  [107] = 107,
-  [108] = 108,
-  [109] = 108,
-  [110] = 110,
-  [111] = 111,
+  [94] = 94,
+  [95] = 95,
+  [96] = 96,
+  [97] = 86,
+  [98] = 87,
+  [99] = 80,
+  [100] = 94,
+  [101] = 89,
+  [102] = 83,
+  [103] = 79,
+  [104] = 85,
+  [105] = 84,
+  [106] = 90,
+  [107] = 81,
+  [108] = 96,
+  [109] = 95,
+  [110] = 93,
+  [111] = 92,
   [112] = 112,
-  [113] = 105,
-  [114] = 110,
-  [115] = 93,
-  [116] = 79,
-  [117] = 107,
+  [113] = 82,
+  [114] = 78,
+  [115] = 115,
+  [116] = 116,
+  [117] = 117,
   [118] = 118,
-  [119] = 112,
-  [120] = 111,
-  [121] = 106,
-  [122] = 108,
-  [123] = 82,
-  [124] = 90,
-  [125] = 86,
-  [126] = 118,
-  [127] = 87,
-  [128] = 88,
-  [129] = 68,
-  [130] = 49,
-  [131] = 51,
-  [132] = 59,
-  [133] = 133,
+  [119] = 118,
+  [120] = 120,
+  [121] = 121,
+  [122] = 122,
+  [123] = 118,
+  [124] = 124,
+  [125] = 117,
+  [126] = 121,
+  [127] = 116,
+  [128] = 128,
+  [129] = 128,
+  [130] = 120,
+  [131] = 122,
+  [132] = 124,
+  [133] = 93,
   [134] = 134,
-  [135] = 56,
-  [136] = 134,
-  [137] = 133,
-  [138] = 67,
-  [139] = 50,
-  [140] = 60,
-  [141] = 55,
-  [142] = 61,
-  [143] = 62,
-  [144] = 133,
-  [145] = 134,
-  [146] = 63,
-  [147] = 147,
-  [148] = 148,
-  [149] = 149,
-  [150] = 149,
+  [135] = 135,
+  [136] = 92,
+  [137] = 134,
+  [138] = 135,
+  [139] = 94,
+  [140] = 86,
+  [141] = 83,
+  [142] = 79,
+  [143] = 84,
+  [144] = 95,
+  [145] = 89,
+  [146] = 90,
+  [147] = 81,
+  [148] = 96,
+  [149] = 135,
+  [150] = 134,
   [151] = 151,
   [152] = 152,
   [153] = 153,
-  [154] = 149,
+  [154] = 153,
   [155] = 155,
-  [156] = 156,
-  [157] = 147,
-  [158] = 158,
-  [159] = 149,
-  [160] = 148,
+  [156] = 152,
+  [157] = 152,
+  [158] = 152,
+  [159] = 159,
+  [160] = 151,
   [161] = 161,
   [162] = 152,
-  [163] = 158,
-  [164] = 151,
-  [165] = 165,
-  [166] = 148,
-  [167] = 156,
-  [168] = 149,
-  [169] = 156,
-  [170] = 149,
+  [163] = 153,
+  [164] = 159,
+  [165] = 155,
+  [166] = 161,
+  [167] = 167,
+  [168] = 168,
+  [169] = 167,
+  [170] = 170,
   [171] = 171,
-  [172] = 172,
-  [173] = 173,
+  [172] = 155,
+  [173] = 152,
   [174] = 174,
-  [175] = 172,
+  [175] = 175,
   [176] = 176,
-  [177] = 173,
+  [177] = 177,
   [178] = 178,
   [179] = 179,
   [180] = 180,
-  [181] = 174,
-  [182] = 178,
+  [181] = 181,
+  [182] = 182,
   [183] = 183,
-  [184] = 176,
-  [185] = 180,
-  [186] = 183,
-  [187] = 180,
-  [188] = 183,
-  [189] = 171,
+  [184] = 180,
+  [185] = 176,
+  [186] = 182,
+  [187] = 177,
+  [188] = 175,
+  [189] = 179,
+  [190] = 177,
+  [191] = 180,
+  [192] = 181,
+  [193] = 178,
 };
 
 static inline bool sym_directive_name_character_set_1(int32_t c) {
@@ -995,6 +1085,139 @@ static bool ts_lex(TSLexer *lexer, TSStateId state) {
   }
 }
 
+static bool ts_lex_keywords(TSLexer *lexer, TSStateId state) {
+  START_LEXER();
+  eof = lexer->eof(lexer);
+  switch (state) {
+    case 0:
+      if (lookahead == 'v') ADVANCE(1);
+      if (lookahead == '\t' ||
+          lookahead == '\n' ||
+          lookahead == '\r' ||
+          lookahead == ' ') SKIP(0)
+      END_STATE();
+    case 1:
+      if (lookahead == '-') ADVANCE(2);
+      END_STATE();
+    case 2:
+      if (lookahead == 'b') ADVANCE(3);
+      if (lookahead == 'e') ADVANCE(4);
+      if (lookahead == 'f') ADVANCE(5);
+      if (lookahead == 'h') ADVANCE(6);
+      if (lookahead == 'i') ADVANCE(7);
+      if (lookahead == 'm') ADVANCE(8);
+      if (lookahead == 'o') ADVANCE(9);
+      if (lookahead == 's') ADVANCE(10);
+      END_STATE();
+    case 3:
+      if (lookahead == 'i') ADVANCE(11);
+      END_STATE();
+    case 4:
+      if (lookahead == 'l') ADVANCE(12);
+      END_STATE();
+    case 5:
+      if (lookahead == 'o') ADVANCE(13);
+      END_STATE();
+    case 6:
+      if (lookahead == 't') ADVANCE(14);
+      END_STATE();
+    case 7:
+      if (lookahead == 'f') ADVANCE(15);
+      END_STATE();
+    case 8:
+      if (lookahead == 'o') ADVANCE(16);
+      END_STATE();
+    case 9:
+      if (lookahead == 'n') ADVANCE(17);
+      END_STATE();
+    case 10:
+      if (lookahead == 'h') ADVANCE(18);
+      if (lookahead == 'l') ADVANCE(19);
+      END_STATE();
+    case 11:
+      if (lookahead == 'n') ADVANCE(20);
+      END_STATE();
+    case 12:
+      if (lookahead == 's') ADVANCE(21);
+      END_STATE();
+    case 13:
+      if (lookahead == 'r') ADVANCE(22);
+      END_STATE();
+    case 14:
+      if (lookahead == 'm') ADVANCE(23);
+      END_STATE();
+    case 15:
+      ACCEPT_TOKEN(sym_v_if);
+      END_STATE();
+    case 16:
+      if (lookahead == 'd') ADVANCE(24);
+      END_STATE();
+    case 17:
+      ACCEPT_TOKEN(sym_v_on);
+      END_STATE();
+    case 18:
+      if (lookahead == 'o') ADVANCE(25);
+      END_STATE();
+    case 19:
+      if (lookahead == 'o') ADVANCE(26);
+      END_STATE();
+    case 20:
+      if (lookahead == 'd') ADVANCE(27);
+      END_STATE();
+    case 21:
+      if (lookahead == 'e') ADVANCE(28);
+      END_STATE();
+    case 22:
+      ACCEPT_TOKEN(sym_v_for);
+      END_STATE();
+    case 23:
+      if (lookahead == 'l') ADVANCE(29);
+      END_STATE();
+    case 24:
+      if (lookahead == 'e') ADVANCE(30);
+      END_STATE();
+    case 25:
+      if (lookahead == 'w') ADVANCE(31);
+      END_STATE();
+    case 26:
+      if (lookahead == 't') ADVANCE(32);
+      END_STATE();
+    case 27:
+      ACCEPT_TOKEN(sym_v_bind);
+      END_STATE();
+    case 28:
+      ACCEPT_TOKEN(sym_v_else);
+      if (lookahead == '-') ADVANCE(33);
+      END_STATE();
+    case 29:
+      ACCEPT_TOKEN(sym_v_html);
+      END_STATE();
+    case 30:
+      if (lookahead == 'l') ADVANCE(34);
+      END_STATE();
+    case 31:
+      ACCEPT_TOKEN(sym_v_show);
+      END_STATE();
+    case 32:
+      ACCEPT_TOKEN(sym_v_slot);
+      END_STATE();
+    case 33:
+      if (lookahead == 'i') ADVANCE(35);
+      END_STATE();
+    case 34:
+      ACCEPT_TOKEN(sym_v_model);
+      END_STATE();
+    case 35:
+      if (lookahead == 'f') ADVANCE(36);
+      END_STATE();
+    case 36:
+      ACCEPT_TOKEN(sym_v_else_if);
+      END_STATE();
+    default:
+      return false;
+  }
+}
+
 static const TSLexMode ts_lex_modes[STATE_COUNT] = {
   [0] = {.lex_state = 0, .external_lex_state = 1},
   [1] = {.lex_state = 0, .external_lex_state = 2},
@@ -1005,187 +1228,191 @@ static const TSLexMode ts_lex_modes[STATE_COUNT] = {
   [6] = {.lex_state = 0, .external_lex_state = 3},
   [7] = {.lex_state = 0, .external_lex_state = 3},
   [8] = {.lex_state = 0, .external_lex_state = 4},
-  [9] = {.lex_state = 0, .external_lex_state = 4},
-  [10] = {.lex_state = 0, .external_lex_state = 4},
-  [11] = {.lex_state = 0, .external_lex_state = 3},
-  [12] = {.lex_state = 0, .external_lex_state = 4},
-  [13] = {.lex_state = 0, .external_lex_state = 4},
-  [14] = {.lex_state = 0, .external_lex_state = 4},
+  [9] = {.lex_state = 0, .external_lex_state = 3},
+  [10] = {.lex_state = 12, .external_lex_state = 5},
+  [11] = {.lex_state = 12, .external_lex_state = 5},
+  [12] = {.lex_state = 10, .external_lex_state = 5},
+  [13] = {.lex_state = 12, .external_lex_state = 5},
+  [14] = {.lex_state = 12, .external_lex_state = 5},
   [15] = {.lex_state = 0, .external_lex_state = 4},
-  [16] = {.lex_state = 0, .external_lex_state = 2},
-  [17] = {.lex_state = 0, .external_lex_state = 2},
-  [18] = {.lex_state = 10, .external_lex_state = 5},
-  [19] = {.lex_state = 10},
-  [20] = {.lex_state = 11, .external_lex_state = 5},
-  [21] = {.lex_state = 11, .external_lex_state = 5},
-  [22] = {.lex_state = 12, .external_lex_state = 5},
-  [23] = {.lex_state = 11, .external_lex_state = 5},
-  [24] = {.lex_state = 11},
-  [25] = {.lex_state = 11, .external_lex_state = 5},
-  [26] = {.lex_state = 12, .external_lex_state = 5},
-  [27] = {.lex_state = 0, .external_lex_state = 6},
-  [28] = {.lex_state = 12, .external_lex_state = 5},
-  [29] = {.lex_state = 12, .external_lex_state = 5},
-  [30] = {.lex_state = 12, .external_lex_state = 5},
-  [31] = {.lex_state = 11},
-  [32] = {.lex_state = 12, .external_lex_state = 5},
-  [33] = {.lex_state = 12, .external_lex_state = 5},
-  [34] = {.lex_state = 12},
-  [35] = {.lex_state = 0, .external_lex_state = 7},
-  [36] = {.lex_state = 12},
-  [37] = {.lex_state = 12},
-  [38] = {.lex_state = 12},
-  [39] = {.lex_state = 11},
+  [16] = {.lex_state = 12, .external_lex_state = 5},
+  [17] = {.lex_state = 12, .external_lex_state = 5},
+  [18] = {.lex_state = 0, .external_lex_state = 4},
+  [19] = {.lex_state = 12, .external_lex_state = 5},
+  [20] = {.lex_state = 0, .external_lex_state = 4},
+  [21] = {.lex_state = 0, .external_lex_state = 4},
+  [22] = {.lex_state = 0, .external_lex_state = 4},
+  [23] = {.lex_state = 0, .external_lex_state = 4},
+  [24] = {.lex_state = 10},
+  [25] = {.lex_state = 12},
+  [26] = {.lex_state = 11, .external_lex_state = 5},
+  [27] = {.lex_state = 12},
+  [28] = {.lex_state = 11, .external_lex_state = 5},
+  [29] = {.lex_state = 12},
+  [30] = {.lex_state = 12},
+  [31] = {.lex_state = 12},
+  [32] = {.lex_state = 12},
+  [33] = {.lex_state = 12},
+  [34] = {.lex_state = 11},
+  [35] = {.lex_state = 11, .external_lex_state = 5},
+  [36] = {.lex_state = 11, .external_lex_state = 5},
+  [37] = {.lex_state = 11},
+  [38] = {.lex_state = 11, .external_lex_state = 5},
+  [39] = {.lex_state = 11, .external_lex_state = 5},
   [40] = {.lex_state = 11, .external_lex_state = 5},
-  [41] = {.lex_state = 12},
+  [41] = {.lex_state = 11},
   [42] = {.lex_state = 11, .external_lex_state = 5},
-  [43] = {.lex_state = 11, .external_lex_state = 5},
+  [43] = {.lex_state = 11},
   [44] = {.lex_state = 11, .external_lex_state = 5},
-  [45] = {.lex_state = 11, .external_lex_state = 5},
-  [46] = {.lex_state = 12},
-  [47] = {.lex_state = 11},
-  [48] = {.lex_state = 12},
-  [49] = {.lex_state = 0, .external_lex_state = 3},
-  [50] = {.lex_state = 0, .external_lex_state = 3},
-  [51] = {.lex_state = 0, .external_lex_state = 3},
-  [52] = {.lex_state = 12, .external_lex_state = 5},
-  [53] = {.lex_state = 0, .external_lex_state = 3},
-  [54] = {.lex_state = 11},
-  [55] = {.lex_state = 0, .external_lex_state = 3},
-  [56] = {.lex_state = 0, .external_lex_state = 3},
-  [57] = {.lex_state = 0, .external_lex_state = 3},
-  [58] = {.lex_state = 0, .external_lex_state = 3},
-  [59] = {.lex_state = 0, .external_lex_state = 3},
-  [60] = {.lex_state = 0, .external_lex_state = 3},
-  [61] = {.lex_state = 0, .external_lex_state = 3},
-  [62] = {.lex_state = 0, .external_lex_state = 3},
-  [63] = {.lex_state = 0, .external_lex_state = 3},
-  [64] = {.lex_state = 0, .external_lex_state = 3},
-  [65] = {.lex_state = 0, .external_lex_state = 3},
-  [66] = {.lex_state = 11},
-  [67] = {.lex_state = 0, .external_lex_state = 3},
-  [68] = {.lex_state = 0, .external_lex_state = 3},
-  [69] = {.lex_state = 12, .external_lex_state = 5},
-  [70] = {.lex_state = 11},
-  [71] = {.lex_state = 11},
-  [72] = {.lex_state = 12, .external_lex_state = 5},
-  [73] = {.lex_state = 11},
-  [74] = {.lex_state = 12, .external_lex_state = 5},
-  [75] = {.lex_state = 0, .external_lex_state = 3},
-  [76] = {.lex_state = 0, .external_lex_state = 4},
-  [77] = {.lex_state = 12},
-  [78] = {.lex_state = 0, .external_lex_state = 4},
-  [79] = {.lex_state = 12, .external_lex_state = 5},
-  [80] = {.lex_state = 0, .external_lex_state = 4},
-  [81] = {.lex_state = 0, .external_lex_state = 4},
-  [82] = {.lex_state = 12, .external_lex_state = 5},
-  [83] = {.lex_state = 0, .external_lex_state = 4},
-  [84] = {.lex_state = 0, .external_lex_state = 4},
-  [85] = {.lex_state = 0, .external_lex_state = 4},
-  [86] = {.lex_state = 12, .external_lex_state = 5},
-  [87] = {.lex_state = 12, .external_lex_state = 5},
-  [88] = {.lex_state = 12, .external_lex_state = 5},
-  [89] = {.lex_state = 0, .external_lex_state = 4},
-  [90] = {.lex_state = 12, .external_lex_state = 5},
-  [91] = {.lex_state = 0, .external_lex_state = 4},
-  [92] = {.lex_state = 0, .external_lex_state = 4},
-  [93] = {.lex_state = 12, .external_lex_state = 5},
-  [94] = {.lex_state = 0, .external_lex_state = 4},
-  [95] = {.lex_state = 0, .external_lex_state = 4},
-  [96] = {.lex_state = 0, .external_lex_state = 4},
-  [97] = {.lex_state = 12},
-  [98] = {.lex_state = 12},
+  [45] = {.lex_state = 12, .external_lex_state = 5},
+  [46] = {.lex_state = 11},
+  [47] = {.lex_state = 12, .external_lex_state = 5},
+  [48] = {.lex_state = 11},
+  [49] = {.lex_state = 11},
+  [50] = {.lex_state = 11},
+  [51] = {.lex_state = 12, .external_lex_state = 5},
+  [52] = {.lex_state = 11},
+  [53] = {.lex_state = 12, .external_lex_state = 5},
+  [54] = {.lex_state = 12},
+  [55] = {.lex_state = 12},
+  [56] = {.lex_state = 12, .external_lex_state = 5},
+  [57] = {.lex_state = 12, .external_lex_state = 5},
+  [58] = {.lex_state = 12, .external_lex_state = 5},
+  [59] = {.lex_state = 12, .external_lex_state = 5},
+  [60] = {.lex_state = 12, .external_lex_state = 5},
+  [61] = {.lex_state = 12, .external_lex_state = 5},
+  [62] = {.lex_state = 12, .external_lex_state = 5},
+  [63] = {.lex_state = 12},
+  [64] = {.lex_state = 12},
+  [65] = {.lex_state = 12, .external_lex_state = 5},
+  [66] = {.lex_state = 12},
+  [67] = {.lex_state = 12},
+  [68] = {.lex_state = 12},
+  [69] = {.lex_state = 12},
+  [70] = {.lex_state = 12},
+  [71] = {.lex_state = 12},
+  [72] = {.lex_state = 12},
+  [73] = {.lex_state = 12},
+  [74] = {.lex_state = 0, .external_lex_state = 2},
+  [75] = {.lex_state = 0, .external_lex_state = 2},
+  [76] = {.lex_state = 0, .external_lex_state = 6},
+  [77] = {.lex_state = 0, .external_lex_state = 7},
+  [78] = {.lex_state = 0, .external_lex_state = 3},
+  [79] = {.lex_state = 0, .external_lex_state = 3},
+  [80] = {.lex_state = 0, .external_lex_state = 3},
+  [81] = {.lex_state = 0, .external_lex_state = 3},
+  [82] = {.lex_state = 0, .external_lex_state = 3},
+  [83] = {.lex_state = 0, .external_lex_state = 3},
+  [84] = {.lex_state = 0, .external_lex_state = 3},
+  [85] = {.lex_state = 0, .external_lex_state = 3},
+  [86] = {.lex_state = 0, .external_lex_state = 3},
+  [87] = {.lex_state = 0, .external_lex_state = 3},
+  [88] = {.lex_state = 0, .external_lex_state = 3},
+  [89] = {.lex_state = 0, .external_lex_state = 3},
+  [90] = {.lex_state = 0, .external_lex_state = 3},
+  [91] = {.lex_state = 0, .external_lex_state = 3},
+  [92] = {.lex_state = 0, .external_lex_state = 3},
+  [93] = {.lex_state = 0, .external_lex_state = 3},
+  [94] = {.lex_state = 0, .external_lex_state = 3},
+  [95] = {.lex_state = 0, .external_lex_state = 3},
+  [96] = {.lex_state = 0, .external_lex_state = 3},
+  [97] = {.lex_state = 0, .external_lex_state = 4},
+  [98] = {.lex_state = 0, .external_lex_state = 4},
   [99] = {.lex_state = 0, .external_lex_state = 4},
   [100] = {.lex_state = 0, .external_lex_state = 4},
-  [101] = {.lex_state = 12},
+  [101] = {.lex_state = 0, .external_lex_state = 4},
   [102] = {.lex_state = 0, .external_lex_state = 4},
   [103] = {.lex_state = 0, .external_lex_state = 4},
   [104] = {.lex_state = 0, .external_lex_state = 4},
-  [105] = {.lex_state = 6},
-  [106] = {.lex_state = 1},
-  [107] = {.lex_state = 1},
-  [108] = {.lex_state = 0, .external_lex_state = 8},
-  [109] = {.lex_state = 0, .external_lex_state = 8},
-  [110] = {.lex_state = 1},
-  [111] = {.lex_state = 1},
-  [112] = {.lex_state = 1},
-  [113] = {.lex_state = 6},
-  [114] = {.lex_state = 1},
-  [115] = {.lex_state = 12},
-  [116] = {.lex_state = 12},
+  [105] = {.lex_state = 0, .external_lex_state = 4},
+  [106] = {.lex_state = 0, .external_lex_state = 4},
+  [107] = {.lex_state = 0, .external_lex_state = 4},
+  [108] = {.lex_state = 0, .external_lex_state = 4},
+  [109] = {.lex_state = 0, .external_lex_state = 4},
+  [110] = {.lex_state = 0, .external_lex_state = 4},
+  [111] = {.lex_state = 0, .external_lex_state = 4},
+  [112] = {.lex_state = 0, .external_lex_state = 4},
+  [113] = {.lex_state = 0, .external_lex_state = 4},
+  [114] = {.lex_state = 0, .external_lex_state = 4},
+  [115] = {.lex_state = 0, .external_lex_state = 4},
+  [116] = {.lex_state = 1},
   [117] = {.lex_state = 1},
-  [118] = {.lex_state = 6},
-  [119] = {.lex_state = 1},
-  [120] = {.lex_state = 1},
+  [118] = {.lex_state = 0, .external_lex_state = 8},
+  [119] = {.lex_state = 0, .external_lex_state = 8},
+  [120] = {.lex_state = 6},
   [121] = {.lex_state = 1},
-  [122] = {.lex_state = 0, .external_lex_state = 8},
-  [123] = {.lex_state = 12},
-  [124] = {.lex_state = 12},
-  [125] = {.lex_state = 12},
-  [126] = {.lex_state = 6},
-  [127] = {.lex_state = 12},
-  [128] = {.lex_state = 12},
-  [129] = {.lex_state = 0, .external_lex_state = 2},
-  [130] = {.lex_state = 0, .external_lex_state = 2},
-  [131] = {.lex_state = 0, .external_lex_state = 2},
-  [132] = {.lex_state = 0, .external_lex_state = 2},
-  [133] = {.lex_state = 0, .external_lex_state = 9},
+  [122] = {.lex_state = 1},
+  [123] = {.lex_state = 0, .external_lex_state = 8},
+  [124] = {.lex_state = 1},
+  [125] = {.lex_state = 1},
+  [126] = {.lex_state = 1},
+  [127] = {.lex_state = 1},
+  [128] = {.lex_state = 6},
+  [129] = {.lex_state = 6},
+  [130] = {.lex_state = 6},
+  [131] = {.lex_state = 1},
+  [132] = {.lex_state = 1},
+  [133] = {.lex_state = 0, .external_lex_state = 2},
   [134] = {.lex_state = 0, .external_lex_state = 9},
-  [135] = {.lex_state = 0, .external_lex_state = 2},
-  [136] = {.lex_state = 0, .external_lex_state = 9},
+  [135] = {.lex_state = 0, .external_lex_state = 9},
+  [136] = {.lex_state = 0, .external_lex_state = 2},
   [137] = {.lex_state = 0, .external_lex_state = 9},
-  [138] = {.lex_state = 0, .external_lex_state = 2},
+  [138] = {.lex_state = 0, .external_lex_state = 9},
   [139] = {.lex_state = 0, .external_lex_state = 2},
   [140] = {.lex_state = 0, .external_lex_state = 2},
   [141] = {.lex_state = 0, .external_lex_state = 2},
   [142] = {.lex_state = 0, .external_lex_state = 2},
   [143] = {.lex_state = 0, .external_lex_state = 2},
-  [144] = {.lex_state = 0, .external_lex_state = 9},
-  [145] = {.lex_state = 0, .external_lex_state = 9},
+  [144] = {.lex_state = 0, .external_lex_state = 2},
+  [145] = {.lex_state = 0, .external_lex_state = 2},
   [146] = {.lex_state = 0, .external_lex_state = 2},
-  [147] = {.lex_state = 3},
-  [148] = {.lex_state = 0},
-  [149] = {.lex_state = 0, .external_lex_state = 10},
-  [150] = {.lex_state = 0, .external_lex_state = 10},
-  [151] = {.lex_state = 14},
-  [152] = {.lex_state = 7},
-  [153] = {.lex_state = 0, .external_lex_state = 9},
-  [154] = {.lex_state = 0, .external_lex_state = 10},
-  [155] = {.lex_state = 0, .external_lex_state = 9},
-  [156] = {.lex_state = 0},
-  [157] = {.lex_state = 3},
-  [158] = {.lex_state = 2},
-  [159] = {.lex_state = 0, .external_lex_state = 10},
-  [160] = {.lex_state = 0},
-  [161] = {.lex_state = 0, .external_lex_state = 9},
-  [162] = {.lex_state = 7},
-  [163] = {.lex_state = 2},
+  [147] = {.lex_state = 0, .external_lex_state = 2},
+  [148] = {.lex_state = 0, .external_lex_state = 2},
+  [149] = {.lex_state = 0, .external_lex_state = 9},
+  [150] = {.lex_state = 0, .external_lex_state = 9},
+  [151] = {.lex_state = 7},
+  [152] = {.lex_state = 0, .external_lex_state = 10},
+  [153] = {.lex_state = 0},
+  [154] = {.lex_state = 0},
+  [155] = {.lex_state = 0},
+  [156] = {.lex_state = 0, .external_lex_state = 10},
+  [157] = {.lex_state = 0, .external_lex_state = 10},
+  [158] = {.lex_state = 0, .external_lex_state = 10},
+  [159] = {.lex_state = 14},
+  [160] = {.lex_state = 7},
+  [161] = {.lex_state = 3},
+  [162] = {.lex_state = 0, .external_lex_state = 10},
+  [163] = {.lex_state = 0},
   [164] = {.lex_state = 14},
-  [165] = {.lex_state = 0, .external_lex_state = 9},
-  [166] = {.lex_state = 0},
-  [167] = {.lex_state = 0},
-  [168] = {.lex_state = 0, .external_lex_state = 10},
-  [169] = {.lex_state = 0},
-  [170] = {.lex_state = 0, .external_lex_state = 10},
-  [171] = {.lex_state = 0},
+  [165] = {.lex_state = 0},
+  [166] = {.lex_state = 3},
+  [167] = {.lex_state = 2},
+  [168] = {.lex_state = 0, .external_lex_state = 9},
+  [169] = {.lex_state = 2},
+  [170] = {.lex_state = 0, .external_lex_state = 9},
+  [171] = {.lex_state = 0, .external_lex_state = 9},
   [172] = {.lex_state = 0},
-  [173] = {.lex_state = 0},
-  [174] = {.lex_state = 0},
+  [173] = {.lex_state = 0, .external_lex_state = 10},
+  [174] = {.lex_state = 0, .external_lex_state = 9},
   [175] = {.lex_state = 0},
   [176] = {.lex_state = 0, .external_lex_state = 11},
-  [177] = {.lex_state = 0},
+  [177] = {.lex_state = 0, .external_lex_state = 12},
   [178] = {.lex_state = 0},
   [179] = {.lex_state = 0},
   [180] = {.lex_state = 0},
   [181] = {.lex_state = 0},
   [182] = {.lex_state = 0},
-  [183] = {.lex_state = 0, .external_lex_state = 12},
-  [184] = {.lex_state = 0, .external_lex_state = 11},
-  [185] = {.lex_state = 0},
-  [186] = {.lex_state = 0, .external_lex_state = 12},
-  [187] = {.lex_state = 0},
-  [188] = {.lex_state = 0, .external_lex_state = 12},
+  [183] = {.lex_state = 0},
+  [184] = {.lex_state = 0},
+  [185] = {.lex_state = 0, .external_lex_state = 11},
+  [186] = {.lex_state = 0},
+  [187] = {.lex_state = 0, .external_lex_state = 12},
+  [188] = {.lex_state = 0},
   [189] = {.lex_state = 0},
+  [190] = {.lex_state = 0, .external_lex_state = 12},
+  [191] = {.lex_state = 0},
+  [192] = {.lex_state = 0},
+  [193] = {.lex_state = 0},
 };
 
 enum {
@@ -1283,6 +1510,7 @@ static const bool ts_external_scanner_states[13][EXTERNAL_TOKEN_COUNT] = {
 static const uint16_t ts_parse_table[LARGE_STATE_COUNT][SYMBOL_COUNT] = {
   [0] = {
     [ts_builtin_sym_end] = ACTIONS(1),
+    [sym_directive_name] = ACTIONS(1),
     [anon_sym_LT] = ACTIONS(1),
     [anon_sym_GT] = ACTIONS(1),
     [anon_sym_SLASH_GT] = ACTIONS(1),
@@ -1293,7 +1521,16 @@ static const uint16_t ts_parse_table[LARGE_STATE_COUNT][SYMBOL_COUNT] = {
     [anon_sym_LBRACE_LBRACE] = ACTIONS(1),
     [anon_sym_RBRACE_RBRACE] = ACTIONS(1),
     [anon_sym_COLON] = ACTIONS(1),
-    [sym_directive_name] = ACTIONS(1),
+    [sym_v_if] = ACTIONS(1),
+    [sym_v_else_if] = ACTIONS(1),
+    [sym_v_else] = ACTIONS(1),
+    [sym_v_for] = ACTIONS(1),
+    [sym_v_show] = ACTIONS(1),
+    [sym_v_model] = ACTIONS(1),
+    [sym_v_on] = ACTIONS(1),
+    [sym_v_bind] = ACTIONS(1),
+    [sym_v_slot] = ACTIONS(1),
+    [sym_v_html] = ACTIONS(1),
     [sym_directive_shorthand] = ACTIONS(1),
     [anon_sym_LBRACK] = ACTIONS(1),
     [anon_sym_RBRACK] = ACTIONS(1),
@@ -1311,17 +1548,17 @@ static const uint16_t ts_parse_table[LARGE_STATE_COUNT][SYMBOL_COUNT] = {
     [sym_comment] = ACTIONS(1),
   },
   [1] = {
-    [sym_component] = STATE(179),
-    [sym_element] = STATE(16),
-    [sym_template_element] = STATE(16),
-    [sym_script_element] = STATE(16),
-    [sym_style_element] = STATE(16),
-    [sym_start_tag] = STATE(2),
-    [sym_template_start_tag] = STATE(10),
-    [sym_script_start_tag] = STATE(133),
+    [sym_component] = STATE(183),
+    [sym_element] = STATE(75),
+    [sym_template_element] = STATE(75),
+    [sym_script_element] = STATE(75),
+    [sym_style_element] = STATE(75),
+    [sym_start_tag] = STATE(4),
+    [sym_template_start_tag] = STATE(8),
+    [sym_script_start_tag] = STATE(135),
     [sym_style_start_tag] = STATE(134),
-    [sym_self_closing_tag] = STATE(129),
-    [aux_sym_component_repeat1] = STATE(16),
+    [sym_self_closing_tag] = STATE(136),
+    [aux_sym_component_repeat1] = STATE(75),
     [ts_builtin_sym_end] = ACTIONS(3),
     [anon_sym_LT] = ACTIONS(5),
     [sym_comment] = ACTIONS(7),
@@ -1329,7 +1566,7 @@ static const uint16_t ts_parse_table[LARGE_STATE_COUNT][SYMBOL_COUNT] = {
 };
 
 static const uint16_t ts_small_parse_table[] = {
-  [0] = 13,
+  [0] = 14,
     ACTIONS(9), 1,
       anon_sym_LT,
     ACTIONS(11), 1,
@@ -1342,20 +1579,22 @@ static const uint16_t ts_small_parse_table[] = {
       sym__implicit_end_tag,
     ACTIONS(19), 1,
       sym_comment,
-    STATE(6), 1,
+    STATE(5), 1,
       sym_start_tag,
-    STATE(14), 1,
+    STATE(18), 1,
       sym_template_start_tag,
-    STATE(68), 1,
-      sym_self_closing_tag,
-    STATE(138), 1,
+    STATE(84), 1,
       sym_end_tag,
-    STATE(144), 1,
+    STATE(92), 1,
+      sym_self_closing_tag,
+    STATE(149), 1,
       sym_script_start_tag,
-    STATE(145), 1,
+    STATE(150), 1,
       sym_style_start_tag,
-    STATE(7), 9,
+    STATE(9), 2,
       sym__node,
+      aux_sym_element_repeat1,
+    STATE(80), 7,
       sym_element,
       sym_template_element,
       sym_script_element,
@@ -1363,34 +1602,35 @@ static const uint16_t ts_small_parse_table[] = {
       sym_erroneous_end_tag,
       sym_text,
       sym_interpolation,
-      aux_sym_element_repeat1,
-  [48] = 13,
+  [50] = 14,
     ACTIONS(9), 1,
       anon_sym_LT,
     ACTIONS(13), 1,
       anon_sym_LBRACE_LBRACE,
     ACTIONS(15), 1,
       sym__text_fragment,
+    ACTIONS(19), 1,
+      sym_comment,
     ACTIONS(21), 1,
       anon_sym_LT_SLASH,
     ACTIONS(23), 1,
       sym__implicit_end_tag,
-    ACTIONS(25), 1,
-      sym_comment,
-    STATE(6), 1,
+    STATE(5), 1,
       sym_start_tag,
-    STATE(14), 1,
+    STATE(18), 1,
       sym_template_start_tag,
-    STATE(68), 1,
+    STATE(92), 1,
       sym_self_closing_tag,
-    STATE(84), 1,
+    STATE(143), 1,
       sym_end_tag,
-    STATE(144), 1,
+    STATE(149), 1,
       sym_script_start_tag,
-    STATE(145), 1,
+    STATE(150), 1,
       sym_style_start_tag,
-    STATE(11), 9,
+    STATE(9), 2,
       sym__node,
+      aux_sym_element_repeat1,
+    STATE(80), 7,
       sym_element,
       sym_template_element,
       sym_script_element,
@@ -1398,34 +1638,35 @@ static const uint16_t ts_small_parse_table[] = {
       sym_erroneous_end_tag,
       sym_text,
       sym_interpolation,
-      aux_sym_element_repeat1,
-  [96] = 13,
+  [100] = 14,
     ACTIONS(9), 1,
       anon_sym_LT,
     ACTIONS(13), 1,
       anon_sym_LBRACE_LBRACE,
     ACTIONS(15), 1,
       sym__text_fragment,
-    ACTIONS(25), 1,
+    ACTIONS(19), 1,
       sym_comment,
-    ACTIONS(27), 1,
+    ACTIONS(21), 1,
       anon_sym_LT_SLASH,
-    ACTIONS(29), 1,
+    ACTIONS(25), 1,
       sym__implicit_end_tag,
-    STATE(6), 1,
+    STATE(5), 1,
       sym_start_tag,
-    STATE(14), 1,
+    STATE(18), 1,
       sym_template_start_tag,
-    STATE(55), 1,
-      sym_end_tag,
-    STATE(68), 1,
+    STATE(92), 1,
       sym_self_closing_tag,
-    STATE(144), 1,
+    STATE(133), 1,
+      sym_end_tag,
+    STATE(149), 1,
       sym_script_start_tag,
-    STATE(145), 1,
+    STATE(150), 1,
       sym_style_start_tag,
-    STATE(11), 9,
+    STATE(3), 2,
       sym__node,
+      aux_sym_element_repeat1,
+    STATE(80), 7,
       sym_element,
       sym_template_element,
       sym_script_element,
@@ -1433,34 +1674,35 @@ static const uint16_t ts_small_parse_table[] = {
       sym_erroneous_end_tag,
       sym_text,
       sym_interpolation,
-      aux_sym_element_repeat1,
-  [144] = 13,
+  [150] = 14,
     ACTIONS(9), 1,
       anon_sym_LT,
+    ACTIONS(11), 1,
+      anon_sym_LT_SLASH,
     ACTIONS(13), 1,
       anon_sym_LBRACE_LBRACE,
     ACTIONS(15), 1,
       sym__text_fragment,
-    ACTIONS(21), 1,
-      anon_sym_LT_SLASH,
-    ACTIONS(31), 1,
-      sym__implicit_end_tag,
-    ACTIONS(33), 1,
+    ACTIONS(19), 1,
       sym_comment,
-    STATE(6), 1,
+    ACTIONS(27), 1,
+      sym__implicit_end_tag,
+    STATE(5), 1,
       sym_start_tag,
-    STATE(14), 1,
+    STATE(18), 1,
       sym_template_start_tag,
-    STATE(68), 1,
+    STATE(92), 1,
       sym_self_closing_tag,
-    STATE(95), 1,
+    STATE(93), 1,
       sym_end_tag,
-    STATE(144), 1,
+    STATE(149), 1,
       sym_script_start_tag,
-    STATE(145), 1,
+    STATE(150), 1,
       sym_style_start_tag,
-    STATE(3), 9,
+    STATE(2), 2,
       sym__node,
+      aux_sym_element_repeat1,
+    STATE(80), 7,
       sym_element,
       sym_template_element,
       sym_script_element,
@@ -1468,34 +1710,35 @@ static const uint16_t ts_small_parse_table[] = {
       sym_erroneous_end_tag,
       sym_text,
       sym_interpolation,
-      aux_sym_element_repeat1,
-  [192] = 13,
+  [200] = 14,
     ACTIONS(9), 1,
       anon_sym_LT,
     ACTIONS(13), 1,
       anon_sym_LBRACE_LBRACE,
     ACTIONS(15), 1,
       sym__text_fragment,
-    ACTIONS(27), 1,
+    ACTIONS(19), 1,
+      sym_comment,
+    ACTIONS(29), 1,
       anon_sym_LT_SLASH,
-    ACTIONS(35), 1,
+    ACTIONS(31), 1,
       sym__implicit_end_tag,
-    ACTIONS(37), 1,
-      sym_comment,
-    STATE(6), 1,
+    STATE(5), 1,
       sym_start_tag,
-    STATE(14), 1,
+    STATE(18), 1,
       sym_template_start_tag,
-    STATE(67), 1,
-      sym_end_tag,
-    STATE(68), 1,
+    STATE(92), 1,
       sym_self_closing_tag,
-    STATE(144), 1,
+    STATE(105), 1,
+      sym_end_tag,
+    STATE(149), 1,
       sym_script_start_tag,
-    STATE(145), 1,
+    STATE(150), 1,
       sym_style_start_tag,
-    STATE(4), 9,
+    STATE(9), 2,
       sym__node,
+      aux_sym_element_repeat1,
+    STATE(80), 7,
       sym_element,
       sym_template_element,
       sym_script_element,
@@ -1503,34 +1746,35 @@ static const uint16_t ts_small_parse_table[] = {
       sym_erroneous_end_tag,
       sym_text,
       sym_interpolation,
-      aux_sym_element_repeat1,
-  [240] = 13,
+  [250] = 14,
     ACTIONS(9), 1,
       anon_sym_LT,
-    ACTIONS(11), 1,
-      anon_sym_LT_SLASH,
     ACTIONS(13), 1,
       anon_sym_LBRACE_LBRACE,
     ACTIONS(15), 1,
       sym__text_fragment,
-    ACTIONS(25), 1,
+    ACTIONS(19), 1,
       sym_comment,
-    ACTIONS(39), 1,
+    ACTIONS(29), 1,
+      anon_sym_LT_SLASH,
+    ACTIONS(33), 1,
       sym__implicit_end_tag,
-    STATE(6), 1,
+    STATE(5), 1,
       sym_start_tag,
-    STATE(14), 1,
+    STATE(18), 1,
       sym_template_start_tag,
-    STATE(68), 1,
+    STATE(92), 1,
       sym_self_closing_tag,
-    STATE(141), 1,
+    STATE(110), 1,
       sym_end_tag,
-    STATE(144), 1,
+    STATE(149), 1,
       sym_script_start_tag,
-    STATE(145), 1,
+    STATE(150), 1,
       sym_style_start_tag,
-    STATE(11), 9,
+    STATE(6), 2,
       sym__node,
+      aux_sym_element_repeat1,
+    STATE(80), 7,
       sym_element,
       sym_template_element,
       sym_script_element,
@@ -1538,32 +1782,33 @@ static const uint16_t ts_small_parse_table[] = {
       sym_erroneous_end_tag,
       sym_text,
       sym_interpolation,
-      aux_sym_element_repeat1,
-  [288] = 12,
-    ACTIONS(41), 1,
+  [300] = 13,
+    ACTIONS(35), 1,
       anon_sym_LT,
-    ACTIONS(43), 1,
+    ACTIONS(37), 1,
       anon_sym_LT_SLASH,
-    ACTIONS(45), 1,
+    ACTIONS(39), 1,
       anon_sym_LBRACE_LBRACE,
-    ACTIONS(47), 1,
+    ACTIONS(41), 1,
       sym__text_fragment,
-    ACTIONS(49), 1,
+    ACTIONS(43), 1,
       sym_comment,
-    STATE(5), 1,
+    STATE(7), 1,
       sym_start_tag,
-    STATE(12), 1,
+    STATE(15), 1,
       sym_template_start_tag,
-    STATE(50), 1,
-      sym_end_tag,
-    STATE(96), 1,
+    STATE(111), 1,
       sym_self_closing_tag,
-    STATE(136), 1,
-      sym_style_start_tag,
     STATE(137), 1,
+      sym_style_start_tag,
+    STATE(138), 1,
       sym_script_start_tag,
-    STATE(15), 9,
+    STATE(144), 1,
+      sym_end_tag,
+    STATE(21), 2,
       sym__node,
+      aux_sym_element_repeat1,
+    STATE(99), 7,
       sym_element,
       sym_template_element,
       sym_script_element,
@@ -1571,32 +1816,33 @@ static const uint16_t ts_small_parse_table[] = {
       sym_erroneous_end_tag,
       sym_text,
       sym_interpolation,
-      aux_sym_element_repeat1,
-  [333] = 12,
-    ACTIONS(41), 1,
-      anon_sym_LT,
+  [347] = 13,
     ACTIONS(45), 1,
+      anon_sym_LT,
+    ACTIONS(48), 1,
+      anon_sym_LT_SLASH,
+    ACTIONS(51), 1,
       anon_sym_LBRACE_LBRACE,
-    ACTIONS(47), 1,
+    ACTIONS(54), 1,
       sym__text_fragment,
-    ACTIONS(49), 1,
+    ACTIONS(57), 1,
+      sym__implicit_end_tag,
+    ACTIONS(59), 1,
       sym_comment,
-    ACTIONS(51), 1,
-      anon_sym_LT_SLASH,
     STATE(5), 1,
       sym_start_tag,
-    STATE(12), 1,
+    STATE(18), 1,
       sym_template_start_tag,
-    STATE(83), 1,
-      sym_end_tag,
-    STATE(96), 1,
+    STATE(92), 1,
       sym_self_closing_tag,
-    STATE(136), 1,
-      sym_style_start_tag,
-    STATE(137), 1,
+    STATE(149), 1,
       sym_script_start_tag,
-    STATE(15), 9,
+    STATE(150), 1,
+      sym_style_start_tag,
+    STATE(9), 2,
       sym__node,
+      aux_sym_element_repeat1,
+    STATE(80), 7,
       sym_element,
       sym_template_element,
       sym_script_element,
@@ -1604,32 +1850,176 @@ static const uint16_t ts_small_parse_table[] = {
       sym_erroneous_end_tag,
       sym_text,
       sym_interpolation,
-      aux_sym_element_repeat1,
-  [378] = 12,
-    ACTIONS(41), 1,
-      anon_sym_LT,
-    ACTIONS(45), 1,
-      anon_sym_LBRACE_LBRACE,
-    ACTIONS(47), 1,
+  [394] = 8,
+    ACTIONS(64), 1,
+      anon_sym_GT,
+    ACTIONS(66), 1,
+      anon_sym_SLASH_GT,
+    ACTIONS(68), 1,
+      sym_attribute_name,
+    ACTIONS(70), 1,
+      sym_directive_shorthand,
+    STATE(12), 1,
+      sym__directive_name,
+    STATE(11), 2,
+      sym__attribute,
+      aux_sym_start_tag_repeat1,
+    STATE(62), 2,
+      sym_attribute,
+      sym_directive_attribute,
+    ACTIONS(62), 11,
+      sym_v_if,
+      sym_v_else_if,
+      sym_v_else,
+      sym_v_for,
+      sym_v_show,
+      sym_v_model,
+      sym_v_on,
+      sym_v_bind,
+      sym_v_slot,
+      sym_v_html,
+      sym_directive_name,
+  [431] = 8,
+    ACTIONS(68), 1,
+      sym_attribute_name,
+    ACTIONS(70), 1,
+      sym_directive_shorthand,
+    ACTIONS(72), 1,
+      anon_sym_GT,
+    ACTIONS(74), 1,
+      anon_sym_SLASH_GT,
+    STATE(12), 1,
+      sym__directive_name,
+    STATE(13), 2,
+      sym__attribute,
+      aux_sym_start_tag_repeat1,
+    STATE(62), 2,
+      sym_attribute,
+      sym_directive_attribute,
+    ACTIONS(62), 11,
+      sym_v_if,
+      sym_v_else_if,
+      sym_v_else,
+      sym_v_for,
+      sym_v_show,
+      sym_v_model,
+      sym_v_on,
+      sym_v_bind,
+      sym_v_slot,
+      sym_v_html,
+      sym_directive_name,
+  [468] = 7,
+    ACTIONS(80), 1,
+      anon_sym_EQ,
+    ACTIONS(82), 1,
+      anon_sym_COLON,
+    ACTIONS(84), 1,
+      anon_sym_DOT,
+    STATE(36), 1,
+      aux_sym_directive_modifiers_repeat1,
+    STATE(45), 1,
+      sym_directive_modifiers,
+    ACTIONS(78), 2,
+      anon_sym_GT,
+      anon_sym_SLASH_GT,
+    ACTIONS(76), 13,
+      sym_attribute_name,
+      sym_v_if,
+      sym_v_else_if,
+      sym_v_else,
+      sym_v_for,
+      sym_v_show,
+      sym_v_model,
+      sym_v_on,
+      sym_v_bind,
+      sym_v_slot,
+      sym_v_html,
+      sym_directive_name,
+      sym_directive_shorthand,
+  [503] = 7,
+    ACTIONS(91), 1,
+      sym_attribute_name,
+    ACTIONS(94), 1,
+      sym_directive_shorthand,
+    STATE(12), 1,
+      sym__directive_name,
+    ACTIONS(89), 2,
+      anon_sym_GT,
+      anon_sym_SLASH_GT,
+    STATE(13), 2,
+      sym__attribute,
+      aux_sym_start_tag_repeat1,
+    STATE(62), 2,
+      sym_attribute,
+      sym_directive_attribute,
+    ACTIONS(86), 11,
+      sym_v_if,
+      sym_v_else_if,
+      sym_v_else,
+      sym_v_for,
+      sym_v_show,
+      sym_v_model,
+      sym_v_on,
+      sym_v_bind,
+      sym_v_slot,
+      sym_v_html,
+      sym_directive_name,
+  [538] = 8,
+    ACTIONS(68), 1,
+      sym_attribute_name,
+    ACTIONS(70), 1,
+      sym_directive_shorthand,
+    ACTIONS(72), 1,
+      anon_sym_GT,
+    ACTIONS(97), 1,
+      anon_sym_SLASH_GT,
+    STATE(12), 1,
+      sym__directive_name,
+    STATE(13), 2,
+      sym__attribute,
+      aux_sym_start_tag_repeat1,
+    STATE(62), 2,
+      sym_attribute,
+      sym_directive_attribute,
+    ACTIONS(62), 11,
+      sym_v_if,
+      sym_v_else_if,
+      sym_v_else,
+      sym_v_for,
+      sym_v_show,
+      sym_v_model,
+      sym_v_on,
+      sym_v_bind,
+      sym_v_slot,
+      sym_v_html,
+      sym_directive_name,
+  [575] = 13,
+    ACTIONS(35), 1,
+      anon_sym_LT,
+    ACTIONS(39), 1,
+      anon_sym_LBRACE_LBRACE,
+    ACTIONS(41), 1,
       sym__text_fragment,
-    ACTIONS(53), 1,
-      anon_sym_LT_SLASH,
-    ACTIONS(55), 1,
+    ACTIONS(43), 1,
       sym_comment,
-    STATE(5), 1,
+    ACTIONS(99), 1,
+      anon_sym_LT_SLASH,
+    STATE(7), 1,
       sym_start_tag,
-    STATE(12), 1,
+    STATE(15), 1,
       sym_template_start_tag,
-    STATE(96), 1,
+    STATE(109), 1,
+      sym_end_tag,
+    STATE(111), 1,
       sym_self_closing_tag,
-    STATE(136), 1,
-      sym_style_start_tag,
     STATE(137), 1,
+      sym_style_start_tag,
+    STATE(138), 1,
       sym_script_start_tag,
-    STATE(146), 1,
-      sym_end_tag,
-    STATE(13), 9,
+    STATE(22), 2,
       sym__node,
+      aux_sym_element_repeat1,
+    STATE(99), 7,
       sym_element,
       sym_template_element,
       sym_script_element,
@@ -1637,32 +2027,91 @@ static const uint16_t ts_small_parse_table[] = {
       sym_erroneous_end_tag,
       sym_text,
       sym_interpolation,
-      aux_sym_element_repeat1,
-  [423] = 12,
-    ACTIONS(57), 1,
+  [622] = 8,
+    ACTIONS(64), 1,
+      anon_sym_GT,
+    ACTIONS(68), 1,
+      sym_attribute_name,
+    ACTIONS(70), 1,
+      sym_directive_shorthand,
+    ACTIONS(101), 1,
+      anon_sym_SLASH_GT,
+    STATE(12), 1,
+      sym__directive_name,
+    STATE(14), 2,
+      sym__attribute,
+      aux_sym_start_tag_repeat1,
+    STATE(62), 2,
+      sym_attribute,
+      sym_directive_attribute,
+    ACTIONS(62), 11,
+      sym_v_if,
+      sym_v_else_if,
+      sym_v_else,
+      sym_v_for,
+      sym_v_show,
+      sym_v_model,
+      sym_v_on,
+      sym_v_bind,
+      sym_v_slot,
+      sym_v_html,
+      sym_directive_name,
+  [659] = 8,
+    ACTIONS(68), 1,
+      sym_attribute_name,
+    ACTIONS(70), 1,
+      sym_directive_shorthand,
+    ACTIONS(72), 1,
+      anon_sym_GT,
+    ACTIONS(103), 1,
+      anon_sym_SLASH_GT,
+    STATE(12), 1,
+      sym__directive_name,
+    STATE(13), 2,
+      sym__attribute,
+      aux_sym_start_tag_repeat1,
+    STATE(62), 2,
+      sym_attribute,
+      sym_directive_attribute,
+    ACTIONS(62), 11,
+      sym_v_if,
+      sym_v_else_if,
+      sym_v_else,
+      sym_v_for,
+      sym_v_show,
+      sym_v_model,
+      sym_v_on,
+      sym_v_bind,
+      sym_v_slot,
+      sym_v_html,
+      sym_directive_name,
+  [696] = 13,
+    ACTIONS(35), 1,
       anon_sym_LT,
-    ACTIONS(60), 1,
-      anon_sym_LT_SLASH,
-    ACTIONS(63), 1,
+    ACTIONS(39), 1,
       anon_sym_LBRACE_LBRACE,
-    ACTIONS(66), 1,
+    ACTIONS(41), 1,
       sym__text_fragment,
-    ACTIONS(69), 1,
-      sym__implicit_end_tag,
-    ACTIONS(71), 1,
+    ACTIONS(43), 1,
       sym_comment,
-    STATE(6), 1,
+    ACTIONS(105), 1,
+      anon_sym_LT_SLASH,
+    STATE(7), 1,
       sym_start_tag,
-    STATE(14), 1,
+    STATE(15), 1,
       sym_template_start_tag,
-    STATE(68), 1,
+    STATE(95), 1,
+      sym_end_tag,
+    STATE(111), 1,
       sym_self_closing_tag,
-    STATE(144), 1,
-      sym_script_start_tag,
-    STATE(145), 1,
+    STATE(137), 1,
       sym_style_start_tag,
-    STATE(11), 9,
+    STATE(138), 1,
+      sym_script_start_tag,
+    STATE(20), 2,
       sym__node,
+      aux_sym_element_repeat1,
+    STATE(99), 7,
       sym_element,
       sym_template_element,
       sym_script_element,
@@ -1670,32 +2119,62 @@ static const uint16_t ts_small_parse_table[] = {
       sym_erroneous_end_tag,
       sym_text,
       sym_interpolation,
-      aux_sym_element_repeat1,
-  [468] = 12,
-    ACTIONS(41), 1,
+  [743] = 8,
+    ACTIONS(64), 1,
+      anon_sym_GT,
+    ACTIONS(68), 1,
+      sym_attribute_name,
+    ACTIONS(70), 1,
+      sym_directive_shorthand,
+    ACTIONS(107), 1,
+      anon_sym_SLASH_GT,
+    STATE(12), 1,
+      sym__directive_name,
+    STATE(17), 2,
+      sym__attribute,
+      aux_sym_start_tag_repeat1,
+    STATE(62), 2,
+      sym_attribute,
+      sym_directive_attribute,
+    ACTIONS(62), 11,
+      sym_v_if,
+      sym_v_else_if,
+      sym_v_else,
+      sym_v_for,
+      sym_v_show,
+      sym_v_model,
+      sym_v_on,
+      sym_v_bind,
+      sym_v_slot,
+      sym_v_html,
+      sym_directive_name,
+  [780] = 13,
+    ACTIONS(35), 1,
       anon_sym_LT,
-    ACTIONS(45), 1,
+    ACTIONS(39), 1,
       anon_sym_LBRACE_LBRACE,
-    ACTIONS(47), 1,
+    ACTIONS(41), 1,
       sym__text_fragment,
-    ACTIONS(51), 1,
-      anon_sym_LT_SLASH,
-    ACTIONS(74), 1,
+    ACTIONS(43), 1,
       sym_comment,
-    STATE(5), 1,
+    ACTIONS(105), 1,
+      anon_sym_LT_SLASH,
+    STATE(7), 1,
       sym_start_tag,
-    STATE(12), 1,
+    STATE(15), 1,
       sym_template_start_tag,
-    STATE(94), 1,
+    STATE(79), 1,
       sym_end_tag,
-    STATE(96), 1,
+    STATE(111), 1,
       sym_self_closing_tag,
-    STATE(136), 1,
-      sym_style_start_tag,
     STATE(137), 1,
+      sym_style_start_tag,
+    STATE(138), 1,
       sym_script_start_tag,
-    STATE(9), 9,
+    STATE(23), 2,
       sym__node,
+      aux_sym_element_repeat1,
+    STATE(99), 7,
       sym_element,
       sym_template_element,
       sym_script_element,
@@ -1703,32 +2182,33 @@ static const uint16_t ts_small_parse_table[] = {
       sym_erroneous_end_tag,
       sym_text,
       sym_interpolation,
-      aux_sym_element_repeat1,
-  [513] = 12,
-    ACTIONS(41), 1,
+  [827] = 13,
+    ACTIONS(35), 1,
       anon_sym_LT,
-    ACTIONS(45), 1,
+    ACTIONS(37), 1,
+      anon_sym_LT_SLASH,
+    ACTIONS(39), 1,
       anon_sym_LBRACE_LBRACE,
-    ACTIONS(47), 1,
+    ACTIONS(41), 1,
       sym__text_fragment,
-    ACTIONS(49), 1,
+    ACTIONS(43), 1,
       sym_comment,
-    ACTIONS(53), 1,
-      anon_sym_LT_SLASH,
-    STATE(5), 1,
+    STATE(7), 1,
       sym_start_tag,
-    STATE(12), 1,
+    STATE(15), 1,
       sym_template_start_tag,
-    STATE(96), 1,
+    STATE(111), 1,
       sym_self_closing_tag,
-    STATE(136), 1,
-      sym_style_start_tag,
     STATE(137), 1,
+      sym_style_start_tag,
+    STATE(138), 1,
       sym_script_start_tag,
-    STATE(139), 1,
+    STATE(142), 1,
       sym_end_tag,
-    STATE(15), 9,
+    STATE(23), 2,
       sym__node,
+      aux_sym_element_repeat1,
+    STATE(99), 7,
       sym_element,
       sym_template_element,
       sym_script_element,
@@ -1736,32 +2216,33 @@ static const uint16_t ts_small_parse_table[] = {
       sym_erroneous_end_tag,
       sym_text,
       sym_interpolation,
-      aux_sym_element_repeat1,
-  [558] = 12,
-    ACTIONS(41), 1,
+  [874] = 13,
+    ACTIONS(35), 1,
       anon_sym_LT,
-    ACTIONS(43), 1,
-      anon_sym_LT_SLASH,
-    ACTIONS(45), 1,
+    ACTIONS(39), 1,
       anon_sym_LBRACE_LBRACE,
-    ACTIONS(47), 1,
+    ACTIONS(41), 1,
       sym__text_fragment,
-    ACTIONS(76), 1,
+    ACTIONS(43), 1,
       sym_comment,
-    STATE(5), 1,
+    ACTIONS(99), 1,
+      anon_sym_LT_SLASH,
+    STATE(7), 1,
       sym_start_tag,
-    STATE(12), 1,
+    STATE(15), 1,
       sym_template_start_tag,
-    STATE(63), 1,
+    STATE(103), 1,
       sym_end_tag,
-    STATE(96), 1,
+    STATE(111), 1,
       sym_self_closing_tag,
-    STATE(136), 1,
-      sym_style_start_tag,
     STATE(137), 1,
+      sym_style_start_tag,
+    STATE(138), 1,
       sym_script_start_tag,
-    STATE(8), 9,
+    STATE(23), 2,
       sym__node,
+      aux_sym_element_repeat1,
+    STATE(99), 7,
       sym_element,
       sym_template_element,
       sym_script_element,
@@ -1769,30 +2250,31 @@ static const uint16_t ts_small_parse_table[] = {
       sym_erroneous_end_tag,
       sym_text,
       sym_interpolation,
-      aux_sym_element_repeat1,
-  [603] = 11,
-    ACTIONS(78), 1,
+  [921] = 12,
+    ACTIONS(109), 1,
       anon_sym_LT,
-    ACTIONS(81), 1,
+    ACTIONS(112), 1,
       anon_sym_LT_SLASH,
-    ACTIONS(84), 1,
+    ACTIONS(115), 1,
       anon_sym_LBRACE_LBRACE,
-    ACTIONS(87), 1,
+    ACTIONS(118), 1,
       sym__text_fragment,
-    ACTIONS(90), 1,
+    ACTIONS(121), 1,
       sym_comment,
-    STATE(5), 1,
+    STATE(7), 1,
       sym_start_tag,
-    STATE(12), 1,
+    STATE(15), 1,
       sym_template_start_tag,
-    STATE(96), 1,
+    STATE(111), 1,
       sym_self_closing_tag,
-    STATE(136), 1,
-      sym_style_start_tag,
     STATE(137), 1,
+      sym_style_start_tag,
+    STATE(138), 1,
       sym_script_start_tag,
-    STATE(15), 9,
+    STATE(23), 2,
       sym__node,
+      aux_sym_element_repeat1,
+    STATE(99), 7,
       sym_element,
       sym_template_element,
       sym_script_element,
@@ -1800,535 +2282,1153 @@ static const uint16_t ts_small_parse_table[] = {
       sym_erroneous_end_tag,
       sym_text,
       sym_interpolation,
-      aux_sym_element_repeat1,
-  [645] = 9,
-    ACTIONS(5), 1,
-      anon_sym_LT,
-    ACTIONS(93), 1,
-      ts_builtin_sym_end,
-    ACTIONS(95), 1,
-      sym_comment,
-    STATE(2), 1,
-      sym_start_tag,
-    STATE(10), 1,
-      sym_template_start_tag,
-    STATE(129), 1,
-      sym_self_closing_tag,
-    STATE(133), 1,
-      sym_script_start_tag,
-    STATE(134), 1,
-      sym_style_start_tag,
-    STATE(17), 5,
-      sym_element,
-      sym_template_element,
-      sym_script_element,
-      sym_style_element,
-      aux_sym_component_repeat1,
-  [677] = 9,
-    ACTIONS(97), 1,
-      ts_builtin_sym_end,
-    ACTIONS(99), 1,
-      anon_sym_LT,
-    ACTIONS(102), 1,
-      sym_comment,
-    STATE(2), 1,
-      sym_start_tag,
-    STATE(10), 1,
-      sym_template_start_tag,
-    STATE(129), 1,
-      sym_self_closing_tag,
-    STATE(133), 1,
-      sym_script_start_tag,
-    STATE(134), 1,
-      sym_style_start_tag,
-    STATE(17), 5,
-      sym_element,
-      sym_template_element,
-      sym_script_element,
-      sym_style_element,
-      aux_sym_component_repeat1,
-  [709] = 7,
-    ACTIONS(107), 1,
+  [965] = 7,
+    ACTIONS(78), 1,
+      anon_sym_GT,
+    ACTIONS(124), 1,
       anon_sym_EQ,
-    ACTIONS(111), 1,
+    ACTIONS(126), 1,
       anon_sym_COLON,
-    ACTIONS(113), 1,
+    ACTIONS(128), 1,
       anon_sym_DOT,
-    STATE(23), 1,
+    STATE(43), 1,
       aux_sym_directive_modifiers_repeat1,
-    STATE(52), 1,
+    STATE(63), 1,
       sym_directive_modifiers,
-    ACTIONS(109), 2,
+    ACTIONS(76), 13,
       sym_attribute_name,
+      sym_v_if,
+      sym_v_else_if,
+      sym_v_else,
+      sym_v_for,
+      sym_v_show,
+      sym_v_model,
+      sym_v_on,
+      sym_v_bind,
+      sym_v_slot,
+      sym_v_html,
+      sym_directive_name,
       sym_directive_shorthand,
-    ACTIONS(105), 3,
+  [999] = 7,
+    ACTIONS(132), 1,
       anon_sym_GT,
-      anon_sym_SLASH_GT,
+    ACTIONS(134), 1,
+      sym_attribute_name,
+    ACTIONS(136), 1,
+      sym_directive_shorthand,
+    STATE(24), 1,
+      sym__directive_name,
+    STATE(27), 2,
+      sym__attribute,
+      aux_sym_start_tag_repeat1,
+    STATE(73), 2,
+      sym_attribute,
+      sym_directive_attribute,
+    ACTIONS(130), 11,
+      sym_v_if,
+      sym_v_else_if,
+      sym_v_else,
+      sym_v_for,
+      sym_v_show,
+      sym_v_model,
+      sym_v_on,
+      sym_v_bind,
+      sym_v_slot,
+      sym_v_html,
       sym_directive_name,
-  [734] = 7,
-    ACTIONS(115), 1,
-      anon_sym_EQ,
-    ACTIONS(117), 1,
-      anon_sym_COLON,
-    ACTIONS(119), 1,
+  [1033] = 6,
+    ACTIONS(84), 1,
       anon_sym_DOT,
-    STATE(47), 1,
+    ACTIONS(142), 1,
+      anon_sym_EQ,
+    STATE(36), 1,
       aux_sym_directive_modifiers_repeat1,
-    STATE(77), 1,
+    STATE(51), 1,
       sym_directive_modifiers,
-    ACTIONS(105), 2,
+    ACTIONS(140), 3,
       anon_sym_GT,
+      anon_sym_SLASH_GT,
+      sym_directive_shorthand,
+    ACTIONS(138), 12,
+      sym_attribute_name,
+      sym_v_if,
+      sym_v_else_if,
+      sym_v_else,
+      sym_v_for,
+      sym_v_show,
+      sym_v_model,
+      sym_v_on,
+      sym_v_bind,
+      sym_v_slot,
+      sym_v_html,
       sym_directive_name,
-    ACTIONS(109), 2,
+  [1065] = 7,
+    ACTIONS(89), 1,
+      anon_sym_GT,
+    ACTIONS(147), 1,
       sym_attribute_name,
+    ACTIONS(150), 1,
       sym_directive_shorthand,
-  [758] = 6,
-    ACTIONS(113), 1,
+    STATE(24), 1,
+      sym__directive_name,
+    STATE(27), 2,
+      sym__attribute,
+      aux_sym_start_tag_repeat1,
+    STATE(73), 2,
+      sym_attribute,
+      sym_directive_attribute,
+    ACTIONS(144), 11,
+      sym_v_if,
+      sym_v_else_if,
+      sym_v_else,
+      sym_v_for,
+      sym_v_show,
+      sym_v_model,
+      sym_v_on,
+      sym_v_bind,
+      sym_v_slot,
+      sym_v_html,
+      sym_directive_name,
+  [1099] = 6,
+    ACTIONS(84), 1,
       anon_sym_DOT,
-    ACTIONS(123), 1,
+    ACTIONS(157), 1,
       anon_sym_EQ,
-    ACTIONS(125), 1,
-      sym_attribute_name,
-    STATE(23), 1,
+    STATE(36), 1,
       aux_sym_directive_modifiers_repeat1,
-    STATE(69), 1,
+    STATE(47), 1,
       sym_directive_modifiers,
-    ACTIONS(121), 4,
+    ACTIONS(155), 3,
       anon_sym_GT,
       anon_sym_SLASH_GT,
-      sym_directive_name,
       sym_directive_shorthand,
-  [780] = 6,
-    ACTIONS(113), 1,
-      anon_sym_DOT,
-    ACTIONS(129), 1,
-      anon_sym_EQ,
-    ACTIONS(131), 1,
+    ACTIONS(153), 12,
       sym_attribute_name,
-    STATE(23), 1,
-      aux_sym_directive_modifiers_repeat1,
-    STATE(74), 1,
-      sym_directive_modifiers,
-    ACTIONS(127), 4,
+      sym_v_if,
+      sym_v_else_if,
+      sym_v_else,
+      sym_v_for,
+      sym_v_show,
+      sym_v_model,
+      sym_v_on,
+      sym_v_bind,
+      sym_v_slot,
+      sym_v_html,
+      sym_directive_name,
+  [1131] = 7,
+    ACTIONS(134), 1,
+      sym_attribute_name,
+    ACTIONS(136), 1,
+      sym_directive_shorthand,
+    ACTIONS(159), 1,
       anon_sym_GT,
-      anon_sym_SLASH_GT,
+    STATE(24), 1,
+      sym__directive_name,
+    STATE(33), 2,
+      sym__attribute,
+      aux_sym_start_tag_repeat1,
+    STATE(73), 2,
+      sym_attribute,
+      sym_directive_attribute,
+    ACTIONS(130), 11,
+      sym_v_if,
+      sym_v_else_if,
+      sym_v_else,
+      sym_v_for,
+      sym_v_show,
+      sym_v_model,
+      sym_v_on,
+      sym_v_bind,
+      sym_v_slot,
+      sym_v_html,
       sym_directive_name,
+  [1165] = 7,
+    ACTIONS(134), 1,
+      sym_attribute_name,
+    ACTIONS(136), 1,
       sym_directive_shorthand,
-  [802] = 6,
-    ACTIONS(133), 1,
+    ACTIONS(161), 1,
       anon_sym_GT,
-    ACTIONS(135), 1,
-      anon_sym_SLASH_GT,
-    ACTIONS(137), 1,
+    STATE(24), 1,
+      sym__directive_name,
+    STATE(25), 2,
+      sym__attribute,
+      aux_sym_start_tag_repeat1,
+    STATE(73), 2,
+      sym_attribute,
+      sym_directive_attribute,
+    ACTIONS(130), 11,
+      sym_v_if,
+      sym_v_else_if,
+      sym_v_else,
+      sym_v_for,
+      sym_v_show,
+      sym_v_model,
+      sym_v_on,
+      sym_v_bind,
+      sym_v_slot,
+      sym_v_html,
+      sym_directive_name,
+  [1199] = 7,
+    ACTIONS(134), 1,
       sym_attribute_name,
-    ACTIONS(139), 1,
+    ACTIONS(136), 1,
+      sym_directive_shorthand,
+    ACTIONS(163), 1,
+      anon_sym_GT,
+    STATE(24), 1,
+      sym__directive_name,
+    STATE(32), 2,
+      sym__attribute,
+      aux_sym_start_tag_repeat1,
+    STATE(73), 2,
+      sym_attribute,
+      sym_directive_attribute,
+    ACTIONS(130), 11,
+      sym_v_if,
+      sym_v_else_if,
+      sym_v_else,
+      sym_v_for,
+      sym_v_show,
+      sym_v_model,
+      sym_v_on,
+      sym_v_bind,
+      sym_v_slot,
+      sym_v_html,
       sym_directive_name,
-    ACTIONS(141), 1,
+  [1233] = 7,
+    ACTIONS(134), 1,
+      sym_attribute_name,
+    ACTIONS(136), 1,
       sym_directive_shorthand,
-    STATE(30), 3,
+    ACTIONS(165), 1,
+      anon_sym_GT,
+    STATE(24), 1,
+      sym__directive_name,
+    STATE(27), 2,
+      sym__attribute,
+      aux_sym_start_tag_repeat1,
+    STATE(73), 2,
       sym_attribute,
       sym_directive_attribute,
+    ACTIONS(130), 11,
+      sym_v_if,
+      sym_v_else_if,
+      sym_v_else,
+      sym_v_for,
+      sym_v_show,
+      sym_v_model,
+      sym_v_on,
+      sym_v_bind,
+      sym_v_slot,
+      sym_v_html,
+      sym_directive_name,
+  [1267] = 7,
+    ACTIONS(134), 1,
+      sym_attribute_name,
+    ACTIONS(136), 1,
+      sym_directive_shorthand,
+    ACTIONS(167), 1,
+      anon_sym_GT,
+    STATE(24), 1,
+      sym__directive_name,
+    STATE(27), 2,
+      sym__attribute,
       aux_sym_start_tag_repeat1,
-  [823] = 4,
-    ACTIONS(113), 1,
+    STATE(73), 2,
+      sym_attribute,
+      sym_directive_attribute,
+    ACTIONS(130), 11,
+      sym_v_if,
+      sym_v_else_if,
+      sym_v_else,
+      sym_v_for,
+      sym_v_show,
+      sym_v_model,
+      sym_v_on,
+      sym_v_bind,
+      sym_v_slot,
+      sym_v_html,
+      sym_directive_name,
+  [1301] = 6,
+    ACTIONS(128), 1,
       anon_sym_DOT,
-    ACTIONS(145), 1,
+    ACTIONS(169), 1,
+      anon_sym_EQ,
+    STATE(43), 1,
+      aux_sym_directive_modifiers_repeat1,
+    STATE(64), 1,
+      sym_directive_modifiers,
+    ACTIONS(155), 2,
+      anon_sym_GT,
+      sym_directive_shorthand,
+    ACTIONS(153), 12,
       sym_attribute_name,
-    STATE(25), 1,
+      sym_v_if,
+      sym_v_else_if,
+      sym_v_else,
+      sym_v_for,
+      sym_v_show,
+      sym_v_model,
+      sym_v_on,
+      sym_v_bind,
+      sym_v_slot,
+      sym_v_html,
+      sym_directive_name,
+  [1332] = 4,
+    ACTIONS(175), 1,
+      anon_sym_DOT,
+    STATE(35), 1,
       aux_sym_directive_modifiers_repeat1,
-    ACTIONS(143), 5,
+    ACTIONS(173), 4,
       anon_sym_GT,
       anon_sym_SLASH_GT,
       anon_sym_EQ,
-      sym_directive_name,
       sym_directive_shorthand,
-  [840] = 6,
-    ACTIONS(119), 1,
+    ACTIONS(171), 12,
+      sym_attribute_name,
+      sym_v_if,
+      sym_v_else_if,
+      sym_v_else,
+      sym_v_for,
+      sym_v_show,
+      sym_v_model,
+      sym_v_on,
+      sym_v_bind,
+      sym_v_slot,
+      sym_v_html,
+      sym_directive_name,
+  [1359] = 4,
+    ACTIONS(84), 1,
       anon_sym_DOT,
-    ACTIONS(125), 1,
+    STATE(35), 1,
+      aux_sym_directive_modifiers_repeat1,
+    ACTIONS(180), 4,
+      anon_sym_GT,
+      anon_sym_SLASH_GT,
+      anon_sym_EQ,
+      sym_directive_shorthand,
+    ACTIONS(178), 12,
       sym_attribute_name,
-    ACTIONS(147), 1,
+      sym_v_if,
+      sym_v_else_if,
+      sym_v_else,
+      sym_v_for,
+      sym_v_show,
+      sym_v_model,
+      sym_v_on,
+      sym_v_bind,
+      sym_v_slot,
+      sym_v_html,
+      sym_directive_name,
+  [1386] = 6,
+    ACTIONS(128), 1,
+      anon_sym_DOT,
+    ACTIONS(182), 1,
       anon_sym_EQ,
-    STATE(47), 1,
+    STATE(43), 1,
       aux_sym_directive_modifiers_repeat1,
-    STATE(101), 1,
+    STATE(55), 1,
       sym_directive_modifiers,
-    ACTIONS(121), 3,
+    ACTIONS(140), 2,
       anon_sym_GT,
-      sym_directive_name,
       sym_directive_shorthand,
-  [861] = 4,
-    ACTIONS(151), 1,
+    ACTIONS(138), 12,
       sym_attribute_name,
-    ACTIONS(153), 1,
-      anon_sym_DOT,
-    STATE(25), 1,
-      aux_sym_directive_modifiers_repeat1,
-    ACTIONS(149), 5,
+      sym_v_if,
+      sym_v_else_if,
+      sym_v_else,
+      sym_v_for,
+      sym_v_show,
+      sym_v_model,
+      sym_v_on,
+      sym_v_bind,
+      sym_v_slot,
+      sym_v_html,
+      sym_directive_name,
+  [1417] = 2,
+    ACTIONS(186), 5,
       anon_sym_GT,
       anon_sym_SLASH_GT,
       anon_sym_EQ,
-      sym_directive_name,
       sym_directive_shorthand,
-  [878] = 6,
-    ACTIONS(137), 1,
+      anon_sym_DOT,
+    ACTIONS(184), 12,
       sym_attribute_name,
-    ACTIONS(139), 1,
+      sym_v_if,
+      sym_v_else_if,
+      sym_v_else,
+      sym_v_for,
+      sym_v_show,
+      sym_v_model,
+      sym_v_on,
+      sym_v_bind,
+      sym_v_slot,
+      sym_v_html,
       sym_directive_name,
-    ACTIONS(141), 1,
-      sym_directive_shorthand,
-    ACTIONS(156), 1,
+  [1439] = 2,
+    ACTIONS(173), 5,
       anon_sym_GT,
-    ACTIONS(158), 1,
       anon_sym_SLASH_GT,
-    STATE(33), 3,
-      sym_attribute,
-      sym_directive_attribute,
-      aux_sym_start_tag_repeat1,
-  [899] = 4,
-    ACTIONS(160), 1,
-      anon_sym_LT,
-    ACTIONS(164), 1,
-      anon_sym_RBRACE_RBRACE,
-    ACTIONS(166), 1,
-      sym__interpolation_text,
-    ACTIONS(162), 5,
-      sym__text_fragment,
-      sym__implicit_end_tag,
-      sym_comment,
-      anon_sym_LT_SLASH,
-      anon_sym_LBRACE_LBRACE,
-  [916] = 6,
-    ACTIONS(133), 1,
-      anon_sym_GT,
-    ACTIONS(137), 1,
+      anon_sym_EQ,
+      sym_directive_shorthand,
+      anon_sym_DOT,
+    ACTIONS(171), 12,
       sym_attribute_name,
-    ACTIONS(139), 1,
+      sym_v_if,
+      sym_v_else_if,
+      sym_v_else,
+      sym_v_for,
+      sym_v_show,
+      sym_v_model,
+      sym_v_on,
+      sym_v_bind,
+      sym_v_slot,
+      sym_v_html,
       sym_directive_name,
-    ACTIONS(141), 1,
-      sym_directive_shorthand,
-    ACTIONS(168), 1,
-      anon_sym_SLASH_GT,
-    STATE(26), 3,
-      sym_attribute,
-      sym_directive_attribute,
-      aux_sym_start_tag_repeat1,
-  [937] = 6,
-    ACTIONS(133), 1,
+  [1461] = 2,
+    ACTIONS(190), 5,
       anon_sym_GT,
-    ACTIONS(137), 1,
+      anon_sym_SLASH_GT,
+      anon_sym_EQ,
+      sym_directive_shorthand,
+      anon_sym_DOT,
+    ACTIONS(188), 12,
       sym_attribute_name,
-    ACTIONS(139), 1,
+      sym_v_if,
+      sym_v_else_if,
+      sym_v_else,
+      sym_v_for,
+      sym_v_show,
+      sym_v_model,
+      sym_v_on,
+      sym_v_bind,
+      sym_v_slot,
+      sym_v_html,
       sym_directive_name,
-    ACTIONS(141), 1,
+  [1483] = 4,
+    ACTIONS(192), 1,
+      anon_sym_DOT,
+    STATE(41), 1,
+      aux_sym_directive_modifiers_repeat1,
+    ACTIONS(173), 3,
+      anon_sym_GT,
+      anon_sym_EQ,
       sym_directive_shorthand,
-    ACTIONS(170), 1,
-      anon_sym_SLASH_GT,
-    STATE(32), 3,
-      sym_attribute,
-      sym_directive_attribute,
-      aux_sym_start_tag_repeat1,
-  [958] = 6,
-    ACTIONS(137), 1,
+    ACTIONS(171), 12,
       sym_attribute_name,
-    ACTIONS(139), 1,
+      sym_v_if,
+      sym_v_else_if,
+      sym_v_else,
+      sym_v_for,
+      sym_v_show,
+      sym_v_model,
+      sym_v_on,
+      sym_v_bind,
+      sym_v_slot,
+      sym_v_html,
       sym_directive_name,
-    ACTIONS(141), 1,
-      sym_directive_shorthand,
-    ACTIONS(156), 1,
+  [1509] = 2,
+    ACTIONS(197), 5,
       anon_sym_GT,
-    ACTIONS(172), 1,
       anon_sym_SLASH_GT,
-    STATE(33), 3,
-      sym_attribute,
-      sym_directive_attribute,
-      aux_sym_start_tag_repeat1,
-  [979] = 6,
-    ACTIONS(119), 1,
+      anon_sym_EQ,
+      sym_directive_shorthand,
       anon_sym_DOT,
-    ACTIONS(131), 1,
+    ACTIONS(195), 12,
       sym_attribute_name,
-    ACTIONS(174), 1,
-      anon_sym_EQ,
-    STATE(47), 1,
+      sym_v_if,
+      sym_v_else_if,
+      sym_v_else,
+      sym_v_for,
+      sym_v_show,
+      sym_v_model,
+      sym_v_on,
+      sym_v_bind,
+      sym_v_slot,
+      sym_v_html,
+      sym_directive_name,
+  [1531] = 4,
+    ACTIONS(128), 1,
+      anon_sym_DOT,
+    STATE(41), 1,
       aux_sym_directive_modifiers_repeat1,
-    STATE(97), 1,
-      sym_directive_modifiers,
-    ACTIONS(127), 3,
+    ACTIONS(180), 3,
       anon_sym_GT,
-      sym_directive_name,
+      anon_sym_EQ,
       sym_directive_shorthand,
-  [1000] = 6,
-    ACTIONS(137), 1,
+    ACTIONS(178), 12,
       sym_attribute_name,
-    ACTIONS(139), 1,
+      sym_v_if,
+      sym_v_else_if,
+      sym_v_else,
+      sym_v_for,
+      sym_v_show,
+      sym_v_model,
+      sym_v_on,
+      sym_v_bind,
+      sym_v_slot,
+      sym_v_html,
       sym_directive_name,
-    ACTIONS(141), 1,
-      sym_directive_shorthand,
-    ACTIONS(156), 1,
+  [1557] = 2,
+    ACTIONS(201), 5,
       anon_sym_GT,
-    ACTIONS(176), 1,
       anon_sym_SLASH_GT,
-    STATE(33), 3,
-      sym_attribute,
-      sym_directive_attribute,
-      aux_sym_start_tag_repeat1,
-  [1021] = 5,
-    ACTIONS(180), 1,
+      anon_sym_EQ,
+      sym_directive_shorthand,
+      anon_sym_DOT,
+    ACTIONS(199), 12,
       sym_attribute_name,
-    ACTIONS(183), 1,
+      sym_v_if,
+      sym_v_else_if,
+      sym_v_else,
+      sym_v_for,
+      sym_v_show,
+      sym_v_model,
+      sym_v_on,
+      sym_v_bind,
+      sym_v_slot,
+      sym_v_html,
       sym_directive_name,
-    ACTIONS(186), 1,
-      sym_directive_shorthand,
-    ACTIONS(178), 2,
+  [1579] = 3,
+    ACTIONS(157), 1,
+      anon_sym_EQ,
+    ACTIONS(155), 3,
       anon_sym_GT,
       anon_sym_SLASH_GT,
-    STATE(33), 3,
-      sym_attribute,
-      sym_directive_attribute,
-      aux_sym_start_tag_repeat1,
-  [1040] = 5,
-    ACTIONS(189), 1,
-      anon_sym_GT,
-    ACTIONS(191), 1,
+      sym_directive_shorthand,
+    ACTIONS(153), 12,
       sym_attribute_name,
-    ACTIONS(193), 1,
+      sym_v_if,
+      sym_v_else_if,
+      sym_v_else,
+      sym_v_for,
+      sym_v_show,
+      sym_v_model,
+      sym_v_on,
+      sym_v_bind,
+      sym_v_slot,
+      sym_v_html,
       sym_directive_name,
-    ACTIONS(195), 1,
+  [1602] = 2,
+    ACTIONS(197), 4,
+      anon_sym_GT,
+      anon_sym_EQ,
       sym_directive_shorthand,
-    STATE(41), 3,
-      sym_attribute,
-      sym_directive_attribute,
-      aux_sym_start_tag_repeat1,
-  [1058] = 4,
-    ACTIONS(160), 1,
-      anon_sym_LT,
-    ACTIONS(197), 1,
-      anon_sym_RBRACE_RBRACE,
-    ACTIONS(199), 1,
-      sym__interpolation_text,
-    ACTIONS(162), 4,
-      sym__text_fragment,
-      sym_comment,
-      anon_sym_LT_SLASH,
-      anon_sym_LBRACE_LBRACE,
-  [1074] = 5,
-    ACTIONS(191), 1,
+      anon_sym_DOT,
+    ACTIONS(195), 12,
       sym_attribute_name,
-    ACTIONS(193), 1,
+      sym_v_if,
+      sym_v_else_if,
+      sym_v_else,
+      sym_v_for,
+      sym_v_show,
+      sym_v_model,
+      sym_v_on,
+      sym_v_bind,
+      sym_v_slot,
+      sym_v_html,
       sym_directive_name,
-    ACTIONS(195), 1,
-      sym_directive_shorthand,
-    ACTIONS(201), 1,
+  [1623] = 3,
+    ACTIONS(142), 1,
+      anon_sym_EQ,
+    ACTIONS(140), 3,
       anon_sym_GT,
-    STATE(41), 3,
-      sym_attribute,
-      sym_directive_attribute,
-      aux_sym_start_tag_repeat1,
-  [1092] = 5,
-    ACTIONS(191), 1,
+      anon_sym_SLASH_GT,
+      sym_directive_shorthand,
+    ACTIONS(138), 12,
       sym_attribute_name,
-    ACTIONS(193), 1,
+      sym_v_if,
+      sym_v_else_if,
+      sym_v_else,
+      sym_v_for,
+      sym_v_show,
+      sym_v_model,
+      sym_v_on,
+      sym_v_bind,
+      sym_v_slot,
+      sym_v_html,
       sym_directive_name,
-    ACTIONS(195), 1,
-      sym_directive_shorthand,
-    ACTIONS(203), 1,
+  [1646] = 2,
+    ACTIONS(173), 4,
       anon_sym_GT,
-    STATE(36), 3,
-      sym_attribute,
-      sym_directive_attribute,
-      aux_sym_start_tag_repeat1,
-  [1110] = 5,
-    ACTIONS(191), 1,
+      anon_sym_EQ,
+      sym_directive_shorthand,
+      anon_sym_DOT,
+    ACTIONS(171), 12,
       sym_attribute_name,
-    ACTIONS(193), 1,
+      sym_v_if,
+      sym_v_else_if,
+      sym_v_else,
+      sym_v_for,
+      sym_v_show,
+      sym_v_model,
+      sym_v_on,
+      sym_v_bind,
+      sym_v_slot,
+      sym_v_html,
       sym_directive_name,
-    ACTIONS(195), 1,
+  [1667] = 2,
+    ACTIONS(190), 4,
+      anon_sym_GT,
+      anon_sym_EQ,
       sym_directive_shorthand,
-    ACTIONS(205), 1,
+      anon_sym_DOT,
+    ACTIONS(188), 12,
+      sym_attribute_name,
+      sym_v_if,
+      sym_v_else_if,
+      sym_v_else,
+      sym_v_for,
+      sym_v_show,
+      sym_v_model,
+      sym_v_on,
+      sym_v_bind,
+      sym_v_slot,
+      sym_v_html,
+      sym_directive_name,
+  [1688] = 2,
+    ACTIONS(201), 4,
       anon_sym_GT,
-    STATE(41), 3,
-      sym_attribute,
-      sym_directive_attribute,
-      aux_sym_start_tag_repeat1,
-  [1128] = 4,
-    ACTIONS(151), 1,
+      anon_sym_EQ,
+      sym_directive_shorthand,
+      anon_sym_DOT,
+    ACTIONS(199), 12,
       sym_attribute_name,
+      sym_v_if,
+      sym_v_else_if,
+      sym_v_else,
+      sym_v_for,
+      sym_v_show,
+      sym_v_model,
+      sym_v_on,
+      sym_v_bind,
+      sym_v_slot,
+      sym_v_html,
+      sym_directive_name,
+  [1709] = 3,
     ACTIONS(207), 1,
-      anon_sym_DOT,
-    STATE(39), 1,
-      aux_sym_directive_modifiers_repeat1,
-    ACTIONS(149), 4,
-      anon_sym_GT,
       anon_sym_EQ,
+    ACTIONS(205), 3,
+      anon_sym_GT,
+      anon_sym_SLASH_GT,
+      sym_directive_shorthand,
+    ACTIONS(203), 12,
+      sym_attribute_name,
+      sym_v_if,
+      sym_v_else_if,
+      sym_v_else,
+      sym_v_for,
+      sym_v_show,
+      sym_v_model,
+      sym_v_on,
+      sym_v_bind,
+      sym_v_slot,
+      sym_v_html,
       sym_directive_name,
+  [1732] = 2,
+    ACTIONS(186), 4,
+      anon_sym_GT,
+      anon_sym_EQ,
       sym_directive_shorthand,
-  [1144] = 2,
-    ACTIONS(212), 1,
+      anon_sym_DOT,
+    ACTIONS(184), 12,
       sym_attribute_name,
-    ACTIONS(210), 6,
+      sym_v_if,
+      sym_v_else_if,
+      sym_v_else,
+      sym_v_for,
+      sym_v_show,
+      sym_v_model,
+      sym_v_on,
+      sym_v_bind,
+      sym_v_slot,
+      sym_v_html,
+      sym_directive_name,
+  [1753] = 3,
+    ACTIONS(213), 1,
+      anon_sym_EQ,
+    ACTIONS(211), 3,
       anon_sym_GT,
       anon_sym_SLASH_GT,
+      sym_directive_shorthand,
+    ACTIONS(209), 12,
+      sym_attribute_name,
+      sym_v_if,
+      sym_v_else_if,
+      sym_v_else,
+      sym_v_for,
+      sym_v_show,
+      sym_v_model,
+      sym_v_on,
+      sym_v_bind,
+      sym_v_slot,
+      sym_v_html,
+      sym_directive_name,
+  [1776] = 3,
+    ACTIONS(215), 1,
       anon_sym_EQ,
+    ACTIONS(211), 2,
+      anon_sym_GT,
+      sym_directive_shorthand,
+    ACTIONS(209), 12,
+      sym_attribute_name,
+      sym_v_if,
+      sym_v_else_if,
+      sym_v_else,
+      sym_v_for,
+      sym_v_show,
+      sym_v_model,
+      sym_v_on,
+      sym_v_bind,
+      sym_v_slot,
+      sym_v_html,
       sym_directive_name,
+  [1798] = 3,
+    ACTIONS(217), 1,
+      anon_sym_EQ,
+    ACTIONS(205), 2,
+      anon_sym_GT,
       sym_directive_shorthand,
-      anon_sym_DOT,
-  [1156] = 5,
-    ACTIONS(178), 1,
+    ACTIONS(203), 12,
+      sym_attribute_name,
+      sym_v_if,
+      sym_v_else_if,
+      sym_v_else,
+      sym_v_for,
+      sym_v_show,
+      sym_v_model,
+      sym_v_on,
+      sym_v_bind,
+      sym_v_slot,
+      sym_v_html,
+      sym_directive_name,
+  [1820] = 2,
+    ACTIONS(221), 3,
       anon_sym_GT,
-    ACTIONS(214), 1,
+      anon_sym_SLASH_GT,
+      sym_directive_shorthand,
+    ACTIONS(219), 12,
       sym_attribute_name,
-    ACTIONS(217), 1,
+      sym_v_if,
+      sym_v_else_if,
+      sym_v_else,
+      sym_v_for,
+      sym_v_show,
+      sym_v_model,
+      sym_v_on,
+      sym_v_bind,
+      sym_v_slot,
+      sym_v_html,
       sym_directive_name,
-    ACTIONS(220), 1,
+  [1840] = 2,
+    ACTIONS(225), 3,
+      anon_sym_GT,
+      anon_sym_SLASH_GT,
       sym_directive_shorthand,
-    STATE(41), 3,
-      sym_attribute,
-      sym_directive_attribute,
-      aux_sym_start_tag_repeat1,
-  [1174] = 2,
-    ACTIONS(225), 1,
+    ACTIONS(223), 12,
       sym_attribute_name,
-    ACTIONS(223), 6,
+      sym_v_if,
+      sym_v_else_if,
+      sym_v_else,
+      sym_v_for,
+      sym_v_show,
+      sym_v_model,
+      sym_v_on,
+      sym_v_bind,
+      sym_v_slot,
+      sym_v_html,
+      sym_directive_name,
+  [1860] = 2,
+    ACTIONS(140), 3,
       anon_sym_GT,
       anon_sym_SLASH_GT,
-      anon_sym_EQ,
+      sym_directive_shorthand,
+    ACTIONS(138), 12,
+      sym_attribute_name,
+      sym_v_if,
+      sym_v_else_if,
+      sym_v_else,
+      sym_v_for,
+      sym_v_show,
+      sym_v_model,
+      sym_v_on,
+      sym_v_bind,
+      sym_v_slot,
+      sym_v_html,
       sym_directive_name,
+  [1880] = 2,
+    ACTIONS(229), 3,
+      anon_sym_GT,
+      anon_sym_SLASH_GT,
       sym_directive_shorthand,
-      anon_sym_DOT,
-  [1186] = 2,
-    ACTIONS(229), 1,
+    ACTIONS(227), 12,
       sym_attribute_name,
-    ACTIONS(227), 6,
+      sym_v_if,
+      sym_v_else_if,
+      sym_v_else,
+      sym_v_for,
+      sym_v_show,
+      sym_v_model,
+      sym_v_on,
+      sym_v_bind,
+      sym_v_slot,
+      sym_v_html,
+      sym_directive_name,
+  [1900] = 2,
+    ACTIONS(233), 3,
       anon_sym_GT,
       anon_sym_SLASH_GT,
-      anon_sym_EQ,
+      sym_directive_shorthand,
+    ACTIONS(231), 12,
+      sym_attribute_name,
+      sym_v_if,
+      sym_v_else_if,
+      sym_v_else,
+      sym_v_for,
+      sym_v_show,
+      sym_v_model,
+      sym_v_on,
+      sym_v_bind,
+      sym_v_slot,
+      sym_v_html,
       sym_directive_name,
+  [1920] = 2,
+    ACTIONS(237), 3,
+      anon_sym_GT,
+      anon_sym_SLASH_GT,
       sym_directive_shorthand,
-      anon_sym_DOT,
-  [1198] = 2,
-    ACTIONS(233), 1,
+    ACTIONS(235), 12,
       sym_attribute_name,
-    ACTIONS(231), 6,
+      sym_v_if,
+      sym_v_else_if,
+      sym_v_else,
+      sym_v_for,
+      sym_v_show,
+      sym_v_model,
+      sym_v_on,
+      sym_v_bind,
+      sym_v_slot,
+      sym_v_html,
+      sym_directive_name,
+  [1940] = 2,
+    ACTIONS(241), 3,
       anon_sym_GT,
       anon_sym_SLASH_GT,
+      sym_directive_shorthand,
+    ACTIONS(239), 12,
+      sym_attribute_name,
+      sym_v_if,
+      sym_v_else_if,
+      sym_v_else,
+      sym_v_for,
+      sym_v_show,
+      sym_v_model,
+      sym_v_on,
+      sym_v_bind,
+      sym_v_slot,
+      sym_v_html,
+      sym_directive_name,
+  [1960] = 3,
+    ACTIONS(169), 1,
       anon_sym_EQ,
+    ACTIONS(155), 2,
+      anon_sym_GT,
+      sym_directive_shorthand,
+    ACTIONS(153), 12,
+      sym_attribute_name,
+      sym_v_if,
+      sym_v_else_if,
+      sym_v_else,
+      sym_v_for,
+      sym_v_show,
+      sym_v_model,
+      sym_v_on,
+      sym_v_bind,
+      sym_v_slot,
+      sym_v_html,
       sym_directive_name,
+  [1982] = 3,
+    ACTIONS(182), 1,
+      anon_sym_EQ,
+    ACTIONS(140), 2,
+      anon_sym_GT,
       sym_directive_shorthand,
-      anon_sym_DOT,
-  [1210] = 2,
-    ACTIONS(151), 1,
+    ACTIONS(138), 12,
       sym_attribute_name,
-    ACTIONS(149), 6,
+      sym_v_if,
+      sym_v_else_if,
+      sym_v_else,
+      sym_v_for,
+      sym_v_show,
+      sym_v_model,
+      sym_v_on,
+      sym_v_bind,
+      sym_v_slot,
+      sym_v_html,
+      sym_directive_name,
+  [2004] = 2,
+    ACTIONS(205), 3,
       anon_sym_GT,
       anon_sym_SLASH_GT,
-      anon_sym_EQ,
+      sym_directive_shorthand,
+    ACTIONS(203), 12,
+      sym_attribute_name,
+      sym_v_if,
+      sym_v_else_if,
+      sym_v_else,
+      sym_v_for,
+      sym_v_show,
+      sym_v_model,
+      sym_v_on,
+      sym_v_bind,
+      sym_v_slot,
+      sym_v_html,
       sym_directive_name,
+  [2024] = 2,
+    ACTIONS(140), 2,
+      anon_sym_GT,
       sym_directive_shorthand,
-      anon_sym_DOT,
-  [1222] = 5,
-    ACTIONS(191), 1,
+    ACTIONS(138), 12,
       sym_attribute_name,
-    ACTIONS(193), 1,
+      sym_v_if,
+      sym_v_else_if,
+      sym_v_else,
+      sym_v_for,
+      sym_v_show,
+      sym_v_model,
+      sym_v_on,
+      sym_v_bind,
+      sym_v_slot,
+      sym_v_html,
       sym_directive_name,
-    ACTIONS(195), 1,
+  [2043] = 2,
+    ACTIONS(229), 2,
+      anon_sym_GT,
       sym_directive_shorthand,
-    ACTIONS(235), 1,
+    ACTIONS(227), 12,
+      sym_attribute_name,
+      sym_v_if,
+      sym_v_else_if,
+      sym_v_else,
+      sym_v_for,
+      sym_v_show,
+      sym_v_model,
+      sym_v_on,
+      sym_v_bind,
+      sym_v_slot,
+      sym_v_html,
+      sym_directive_name,
+  [2062] = 2,
+    ACTIONS(233), 2,
       anon_sym_GT,
-    STATE(38), 3,
-      sym_attribute,
-      sym_directive_attribute,
-      aux_sym_start_tag_repeat1,
-  [1240] = 4,
-    ACTIONS(119), 1,
-      anon_sym_DOT,
-    ACTIONS(145), 1,
+      sym_directive_shorthand,
+    ACTIONS(231), 12,
       sym_attribute_name,
-    STATE(39), 1,
-      aux_sym_directive_modifiers_repeat1,
-    ACTIONS(143), 4,
+      sym_v_if,
+      sym_v_else_if,
+      sym_v_else,
+      sym_v_for,
+      sym_v_show,
+      sym_v_model,
+      sym_v_on,
+      sym_v_bind,
+      sym_v_slot,
+      sym_v_html,
+      sym_directive_name,
+  [2081] = 2,
+    ACTIONS(237), 2,
       anon_sym_GT,
-      anon_sym_EQ,
+      sym_directive_shorthand,
+    ACTIONS(235), 12,
+      sym_attribute_name,
+      sym_v_if,
+      sym_v_else_if,
+      sym_v_else,
+      sym_v_for,
+      sym_v_show,
+      sym_v_model,
+      sym_v_on,
+      sym_v_bind,
+      sym_v_slot,
+      sym_v_html,
       sym_directive_name,
+  [2100] = 2,
+    ACTIONS(221), 2,
+      anon_sym_GT,
       sym_directive_shorthand,
-  [1256] = 5,
-    ACTIONS(191), 1,
+    ACTIONS(219), 12,
       sym_attribute_name,
-    ACTIONS(193), 1,
+      sym_v_if,
+      sym_v_else_if,
+      sym_v_else,
+      sym_v_for,
+      sym_v_show,
+      sym_v_model,
+      sym_v_on,
+      sym_v_bind,
+      sym_v_slot,
+      sym_v_html,
       sym_directive_name,
-    ACTIONS(195), 1,
+  [2119] = 2,
+    ACTIONS(225), 2,
+      anon_sym_GT,
       sym_directive_shorthand,
-    ACTIONS(237), 1,
+    ACTIONS(223), 12,
+      sym_attribute_name,
+      sym_v_if,
+      sym_v_else_if,
+      sym_v_else,
+      sym_v_for,
+      sym_v_show,
+      sym_v_model,
+      sym_v_on,
+      sym_v_bind,
+      sym_v_slot,
+      sym_v_html,
+      sym_directive_name,
+  [2138] = 2,
+    ACTIONS(205), 2,
       anon_sym_GT,
-    STATE(34), 3,
-      sym_attribute,
-      sym_directive_attribute,
-      aux_sym_start_tag_repeat1,
-  [1274] = 2,
-    ACTIONS(239), 1,
+      sym_directive_shorthand,
+    ACTIONS(203), 12,
+      sym_attribute_name,
+      sym_v_if,
+      sym_v_else_if,
+      sym_v_else,
+      sym_v_for,
+      sym_v_show,
+      sym_v_model,
+      sym_v_on,
+      sym_v_bind,
+      sym_v_slot,
+      sym_v_html,
+      sym_directive_name,
+  [2157] = 2,
+    ACTIONS(241), 2,
+      anon_sym_GT,
+      sym_directive_shorthand,
+    ACTIONS(239), 12,
+      sym_attribute_name,
+      sym_v_if,
+      sym_v_else_if,
+      sym_v_else,
+      sym_v_for,
+      sym_v_show,
+      sym_v_model,
+      sym_v_on,
+      sym_v_bind,
+      sym_v_slot,
+      sym_v_html,
+      sym_directive_name,
+  [2176] = 9,
+    ACTIONS(243), 1,
+      ts_builtin_sym_end,
+    ACTIONS(245), 1,
+      anon_sym_LT,
+    ACTIONS(248), 1,
+      sym_comment,
+    STATE(4), 1,
+      sym_start_tag,
+    STATE(8), 1,
+      sym_template_start_tag,
+    STATE(134), 1,
+      sym_style_start_tag,
+    STATE(135), 1,
+      sym_script_start_tag,
+    STATE(136), 1,
+      sym_self_closing_tag,
+    STATE(74), 5,
+      sym_element,
+      sym_template_element,
+      sym_script_element,
+      sym_style_element,
+      aux_sym_component_repeat1,
+  [2208] = 9,
+    ACTIONS(5), 1,
+      anon_sym_LT,
+    ACTIONS(251), 1,
+      ts_builtin_sym_end,
+    ACTIONS(253), 1,
+      sym_comment,
+    STATE(4), 1,
+      sym_start_tag,
+    STATE(8), 1,
+      sym_template_start_tag,
+    STATE(134), 1,
+      sym_style_start_tag,
+    STATE(135), 1,
+      sym_script_start_tag,
+    STATE(136), 1,
+      sym_self_closing_tag,
+    STATE(74), 5,
+      sym_element,
+      sym_template_element,
+      sym_script_element,
+      sym_style_element,
+      aux_sym_component_repeat1,
+  [2240] = 4,
+    ACTIONS(255), 1,
       anon_sym_LT,
-    ACTIONS(241), 5,
+    ACTIONS(259), 1,
+      anon_sym_RBRACE_RBRACE,
+    ACTIONS(261), 1,
+      sym__interpolation_text,
+    ACTIONS(257), 5,
       sym__text_fragment,
       sym__implicit_end_tag,
       sym_comment,
       anon_sym_LT_SLASH,
       anon_sym_LBRACE_LBRACE,
-  [1285] = 2,
-    ACTIONS(243), 1,
+  [2257] = 4,
+    ACTIONS(255), 1,
+      anon_sym_LT,
+    ACTIONS(263), 1,
+      anon_sym_RBRACE_RBRACE,
+    ACTIONS(265), 1,
+      sym__interpolation_text,
+    ACTIONS(257), 4,
+      sym__text_fragment,
+      sym_comment,
+      anon_sym_LT_SLASH,
+      anon_sym_LBRACE_LBRACE,
+  [2273] = 2,
+    ACTIONS(267), 1,
       anon_sym_LT,
-    ACTIONS(245), 5,
+    ACTIONS(269), 5,
       sym__text_fragment,
       sym__implicit_end_tag,
       sym_comment,
       anon_sym_LT_SLASH,
       anon_sym_LBRACE_LBRACE,
-  [1296] = 2,
-    ACTIONS(247), 1,
+  [2284] = 2,
+    ACTIONS(271), 1,
       anon_sym_LT,
-    ACTIONS(249), 5,
+    ACTIONS(273), 5,
       sym__text_fragment,
       sym__implicit_end_tag,
       sym_comment,
       anon_sym_LT_SLASH,
       anon_sym_LBRACE_LBRACE,
-  [1307] = 3,
-    ACTIONS(123), 1,
-      anon_sym_EQ,
-    ACTIONS(125), 1,
-      sym_attribute_name,
-    ACTIONS(121), 4,
-      anon_sym_GT,
-      anon_sym_SLASH_GT,
-      sym_directive_name,
-      sym_directive_shorthand,
-  [1320] = 2,
-    ACTIONS(160), 1,
+  [2295] = 2,
+    ACTIONS(275), 1,
       anon_sym_LT,
-    ACTIONS(162), 5,
+    ACTIONS(277), 5,
       sym__text_fragment,
       sym__implicit_end_tag,
       sym_comment,
       anon_sym_LT_SLASH,
       anon_sym_LBRACE_LBRACE,
-  [1331] = 2,
-    ACTIONS(229), 1,
-      sym_attribute_name,
-    ACTIONS(227), 5,
-      anon_sym_GT,
-      anon_sym_EQ,
-      sym_directive_name,
-      sym_directive_shorthand,
-      anon_sym_DOT,
-  [1342] = 2,
-    ACTIONS(251), 1,
+  [2306] = 2,
+    ACTIONS(279), 1,
       anon_sym_LT,
-    ACTIONS(253), 5,
+    ACTIONS(281), 5,
       sym__text_fragment,
       sym__implicit_end_tag,
       sym_comment,
       anon_sym_LT_SLASH,
       anon_sym_LBRACE_LBRACE,
-  [1353] = 2,
+  [2317] = 2,
     ACTIONS(255), 1,
       anon_sym_LT,
     ACTIONS(257), 5,
@@ -2337,310 +3437,213 @@ static const uint16_t ts_small_parse_table[] = {
       sym_comment,
       anon_sym_LT_SLASH,
       anon_sym_LBRACE_LBRACE,
-  [1364] = 2,
-    ACTIONS(259), 1,
+  [2328] = 2,
+    ACTIONS(283), 1,
       anon_sym_LT,
-    ACTIONS(261), 5,
+    ACTIONS(285), 5,
       sym__text_fragment,
       sym__implicit_end_tag,
       sym_comment,
       anon_sym_LT_SLASH,
       anon_sym_LBRACE_LBRACE,
-  [1375] = 2,
-    ACTIONS(263), 1,
+  [2339] = 2,
+    ACTIONS(287), 1,
       anon_sym_LT,
-    ACTIONS(265), 5,
+    ACTIONS(289), 5,
       sym__text_fragment,
       sym__implicit_end_tag,
       sym_comment,
       anon_sym_LT_SLASH,
       anon_sym_LBRACE_LBRACE,
-  [1386] = 2,
-    ACTIONS(267), 1,
+  [2350] = 2,
+    ACTIONS(291), 1,
       anon_sym_LT,
-    ACTIONS(269), 5,
+    ACTIONS(293), 5,
       sym__text_fragment,
       sym__implicit_end_tag,
       sym_comment,
       anon_sym_LT_SLASH,
       anon_sym_LBRACE_LBRACE,
-  [1397] = 2,
-    ACTIONS(271), 1,
+  [2361] = 2,
+    ACTIONS(295), 1,
       anon_sym_LT,
-    ACTIONS(273), 5,
+    ACTIONS(297), 5,
       sym__text_fragment,
       sym__implicit_end_tag,
       sym_comment,
       anon_sym_LT_SLASH,
       anon_sym_LBRACE_LBRACE,
-  [1408] = 2,
-    ACTIONS(275), 1,
+  [2372] = 2,
+    ACTIONS(299), 1,
       anon_sym_LT,
-    ACTIONS(277), 5,
+    ACTIONS(301), 5,
       sym__text_fragment,
       sym__implicit_end_tag,
       sym_comment,
       anon_sym_LT_SLASH,
       anon_sym_LBRACE_LBRACE,
-  [1419] = 2,
-    ACTIONS(279), 1,
+  [2383] = 2,
+    ACTIONS(303), 1,
       anon_sym_LT,
-    ACTIONS(281), 5,
+    ACTIONS(305), 5,
       sym__text_fragment,
       sym__implicit_end_tag,
       sym_comment,
       anon_sym_LT_SLASH,
       anon_sym_LBRACE_LBRACE,
-  [1430] = 2,
-    ACTIONS(283), 1,
+  [2394] = 2,
+    ACTIONS(307), 1,
       anon_sym_LT,
-    ACTIONS(285), 5,
+    ACTIONS(309), 5,
       sym__text_fragment,
       sym__implicit_end_tag,
       sym_comment,
       anon_sym_LT_SLASH,
       anon_sym_LBRACE_LBRACE,
-  [1441] = 2,
-    ACTIONS(287), 1,
+  [2405] = 2,
+    ACTIONS(311), 1,
       anon_sym_LT,
-    ACTIONS(289), 5,
+    ACTIONS(313), 5,
+      sym__text_fragment,
+      sym__implicit_end_tag,
+      sym_comment,
+      anon_sym_LT_SLASH,
+      anon_sym_LBRACE_LBRACE,
+  [2416] = 2,
+    ACTIONS(315), 1,
+      anon_sym_LT,
+    ACTIONS(317), 5,
+      sym__text_fragment,
+      sym__implicit_end_tag,
+      sym_comment,
+      anon_sym_LT_SLASH,
+      anon_sym_LBRACE_LBRACE,
+  [2427] = 2,
+    ACTIONS(319), 1,
+      anon_sym_LT,
+    ACTIONS(321), 5,
+      sym__text_fragment,
+      sym__implicit_end_tag,
+      sym_comment,
+      anon_sym_LT_SLASH,
+      anon_sym_LBRACE_LBRACE,
+  [2438] = 2,
+    ACTIONS(323), 1,
+      anon_sym_LT,
+    ACTIONS(325), 5,
       sym__text_fragment,
       sym__implicit_end_tag,
       sym_comment,
       anon_sym_LT_SLASH,
       anon_sym_LBRACE_LBRACE,
-  [1452] = 2,
-    ACTIONS(291), 1,
+  [2449] = 2,
+    ACTIONS(327), 1,
       anon_sym_LT,
-    ACTIONS(293), 5,
+    ACTIONS(329), 5,
       sym__text_fragment,
       sym__implicit_end_tag,
       sym_comment,
       anon_sym_LT_SLASH,
       anon_sym_LBRACE_LBRACE,
-  [1463] = 2,
-    ACTIONS(233), 1,
-      sym_attribute_name,
-    ACTIONS(231), 5,
-      anon_sym_GT,
-      anon_sym_EQ,
-      sym_directive_name,
-      sym_directive_shorthand,
-      anon_sym_DOT,
-  [1474] = 2,
-    ACTIONS(295), 1,
+  [2460] = 2,
+    ACTIONS(331), 1,
       anon_sym_LT,
-    ACTIONS(297), 5,
+    ACTIONS(333), 5,
       sym__text_fragment,
       sym__implicit_end_tag,
       sym_comment,
       anon_sym_LT_SLASH,
       anon_sym_LBRACE_LBRACE,
-  [1485] = 2,
-    ACTIONS(299), 1,
+  [2471] = 2,
+    ACTIONS(335), 1,
       anon_sym_LT,
-    ACTIONS(301), 5,
+    ACTIONS(337), 5,
       sym__text_fragment,
       sym__implicit_end_tag,
       sym_comment,
       anon_sym_LT_SLASH,
       anon_sym_LBRACE_LBRACE,
-  [1496] = 3,
-    ACTIONS(129), 1,
-      anon_sym_EQ,
-    ACTIONS(131), 1,
-      sym_attribute_name,
-    ACTIONS(127), 4,
-      anon_sym_GT,
-      anon_sym_SLASH_GT,
-      sym_directive_name,
-      sym_directive_shorthand,
-  [1509] = 2,
-    ACTIONS(151), 1,
-      sym_attribute_name,
-    ACTIONS(149), 5,
-      anon_sym_GT,
-      anon_sym_EQ,
-      sym_directive_name,
-      sym_directive_shorthand,
-      anon_sym_DOT,
-  [1520] = 2,
-    ACTIONS(212), 1,
-      sym_attribute_name,
-    ACTIONS(210), 5,
-      anon_sym_GT,
-      anon_sym_EQ,
-      sym_directive_name,
-      sym_directive_shorthand,
-      anon_sym_DOT,
-  [1531] = 3,
-    ACTIONS(305), 1,
-      anon_sym_EQ,
-    ACTIONS(307), 1,
-      sym_attribute_name,
-    ACTIONS(303), 4,
-      anon_sym_GT,
-      anon_sym_SLASH_GT,
-      sym_directive_name,
-      sym_directive_shorthand,
-  [1544] = 2,
-    ACTIONS(225), 1,
-      sym_attribute_name,
-    ACTIONS(223), 5,
-      anon_sym_GT,
-      anon_sym_EQ,
-      sym_directive_name,
-      sym_directive_shorthand,
-      anon_sym_DOT,
-  [1555] = 3,
-    ACTIONS(311), 1,
-      anon_sym_EQ,
-    ACTIONS(313), 1,
-      sym_attribute_name,
-    ACTIONS(309), 4,
-      anon_sym_GT,
-      anon_sym_SLASH_GT,
-      sym_directive_name,
-      sym_directive_shorthand,
-  [1568] = 2,
-    ACTIONS(315), 1,
+  [2482] = 2,
+    ACTIONS(295), 1,
       anon_sym_LT,
-    ACTIONS(317), 5,
+    ACTIONS(297), 4,
       sym__text_fragment,
-      sym__implicit_end_tag,
       sym_comment,
       anon_sym_LT_SLASH,
       anon_sym_LBRACE_LBRACE,
-  [1579] = 2,
-    ACTIONS(255), 1,
+  [2492] = 2,
+    ACTIONS(299), 1,
       anon_sym_LT,
-    ACTIONS(257), 4,
+    ACTIONS(301), 4,
       sym__text_fragment,
       sym_comment,
       anon_sym_LT_SLASH,
       anon_sym_LBRACE_LBRACE,
-  [1589] = 3,
-    ACTIONS(125), 1,
-      sym_attribute_name,
-    ACTIONS(147), 1,
-      anon_sym_EQ,
-    ACTIONS(121), 3,
-      anon_sym_GT,
-      sym_directive_name,
-      sym_directive_shorthand,
-  [1601] = 2,
-    ACTIONS(267), 1,
+  [2502] = 2,
+    ACTIONS(275), 1,
       anon_sym_LT,
-    ACTIONS(269), 4,
+    ACTIONS(277), 4,
       sym__text_fragment,
       sym_comment,
       anon_sym_LT_SLASH,
       anon_sym_LBRACE_LBRACE,
-  [1611] = 2,
-    ACTIONS(131), 1,
-      sym_attribute_name,
-    ACTIONS(127), 4,
-      anon_sym_GT,
-      anon_sym_SLASH_GT,
-      sym_directive_name,
-      sym_directive_shorthand,
-  [1621] = 2,
-    ACTIONS(239), 1,
+  [2512] = 2,
+    ACTIONS(327), 1,
       anon_sym_LT,
-    ACTIONS(241), 4,
+    ACTIONS(329), 4,
       sym__text_fragment,
       sym_comment,
       anon_sym_LT_SLASH,
       anon_sym_LBRACE_LBRACE,
-  [1631] = 2,
-    ACTIONS(247), 1,
+  [2522] = 2,
+    ACTIONS(307), 1,
       anon_sym_LT,
-    ACTIONS(249), 4,
+    ACTIONS(309), 4,
       sym__text_fragment,
       sym_comment,
       anon_sym_LT_SLASH,
       anon_sym_LBRACE_LBRACE,
-  [1641] = 2,
-    ACTIONS(321), 1,
-      sym_attribute_name,
-    ACTIONS(319), 4,
-      anon_sym_GT,
-      anon_sym_SLASH_GT,
-      sym_directive_name,
-      sym_directive_shorthand,
-  [1651] = 2,
-    ACTIONS(243), 1,
+  [2532] = 2,
+    ACTIONS(283), 1,
       anon_sym_LT,
-    ACTIONS(245), 4,
+    ACTIONS(285), 4,
       sym__text_fragment,
       sym_comment,
       anon_sym_LT_SLASH,
       anon_sym_LBRACE_LBRACE,
-  [1661] = 2,
-    ACTIONS(251), 1,
+  [2542] = 2,
+    ACTIONS(271), 1,
       anon_sym_LT,
-    ACTIONS(253), 4,
+    ACTIONS(273), 4,
       sym__text_fragment,
       sym_comment,
       anon_sym_LT_SLASH,
       anon_sym_LBRACE_LBRACE,
-  [1671] = 2,
-    ACTIONS(271), 1,
+  [2552] = 2,
+    ACTIONS(291), 1,
       anon_sym_LT,
-    ACTIONS(273), 4,
+    ACTIONS(293), 4,
       sym__text_fragment,
       sym_comment,
       anon_sym_LT_SLASH,
       anon_sym_LBRACE_LBRACE,
-  [1681] = 2,
-    ACTIONS(313), 1,
-      sym_attribute_name,
-    ACTIONS(309), 4,
-      anon_sym_GT,
-      anon_sym_SLASH_GT,
-      sym_directive_name,
-      sym_directive_shorthand,
-  [1691] = 2,
-    ACTIONS(325), 1,
-      sym_attribute_name,
-    ACTIONS(323), 4,
-      anon_sym_GT,
-      anon_sym_SLASH_GT,
-      sym_directive_name,
-      sym_directive_shorthand,
-  [1701] = 2,
-    ACTIONS(329), 1,
-      sym_attribute_name,
-    ACTIONS(327), 4,
-      anon_sym_GT,
-      anon_sym_SLASH_GT,
-      sym_directive_name,
-      sym_directive_shorthand,
-  [1711] = 2,
-    ACTIONS(275), 1,
+  [2562] = 2,
+    ACTIONS(287), 1,
       anon_sym_LT,
-    ACTIONS(277), 4,
+    ACTIONS(289), 4,
       sym__text_fragment,
       sym_comment,
       anon_sym_LT_SLASH,
       anon_sym_LBRACE_LBRACE,
-  [1721] = 2,
-    ACTIONS(333), 1,
-      sym_attribute_name,
-    ACTIONS(331), 4,
-      anon_sym_GT,
-      anon_sym_SLASH_GT,
-      sym_directive_name,
-      sym_directive_shorthand,
-  [1731] = 2,
-    ACTIONS(160), 1,
+  [2572] = 2,
+    ACTIONS(311), 1,
       anon_sym_LT,
-    ACTIONS(162), 4,
+    ACTIONS(313), 4,
       sym__text_fragment,
       sym_comment,
       anon_sym_LT_SLASH,
       anon_sym_LBRACE_LBRACE,
-  [1741] = 2,
+  [2582] = 2,
     ACTIONS(279), 1,
       anon_sym_LT,
     ACTIONS(281), 4,
@@ -2648,1004 +3651,922 @@ static const uint16_t ts_small_parse_table[] = {
       sym_comment,
       anon_sym_LT_SLASH,
       anon_sym_LBRACE_LBRACE,
-  [1751] = 2,
-    ACTIONS(337), 1,
-      sym_attribute_name,
-    ACTIONS(335), 4,
-      anon_sym_GT,
-      anon_sym_SLASH_GT,
-      sym_directive_name,
-      sym_directive_shorthand,
-  [1761] = 2,
-    ACTIONS(283), 1,
+  [2592] = 2,
+    ACTIONS(335), 1,
       anon_sym_LT,
-    ACTIONS(285), 4,
+    ACTIONS(337), 4,
       sym__text_fragment,
       sym_comment,
       anon_sym_LT_SLASH,
       anon_sym_LBRACE_LBRACE,
-  [1771] = 2,
-    ACTIONS(295), 1,
+  [2602] = 2,
+    ACTIONS(331), 1,
       anon_sym_LT,
-    ACTIONS(297), 4,
+    ACTIONS(333), 4,
       sym__text_fragment,
       sym_comment,
       anon_sym_LT_SLASH,
       anon_sym_LBRACE_LBRACE,
-  [1781] = 2,
-    ACTIONS(299), 1,
+  [2612] = 2,
+    ACTIONS(323), 1,
       anon_sym_LT,
-    ACTIONS(301), 4,
+    ACTIONS(325), 4,
       sym__text_fragment,
       sym_comment,
       anon_sym_LT_SLASH,
       anon_sym_LBRACE_LBRACE,
-  [1791] = 3,
-    ACTIONS(313), 1,
-      sym_attribute_name,
-    ACTIONS(339), 1,
-      anon_sym_EQ,
-    ACTIONS(309), 3,
-      anon_sym_GT,
-      sym_directive_name,
-      sym_directive_shorthand,
-  [1803] = 3,
-    ACTIONS(307), 1,
-      sym_attribute_name,
-    ACTIONS(341), 1,
-      anon_sym_EQ,
-    ACTIONS(303), 3,
-      anon_sym_GT,
-      sym_directive_name,
-      sym_directive_shorthand,
-  [1815] = 2,
-    ACTIONS(343), 1,
+  [2622] = 2,
+    ACTIONS(319), 1,
       anon_sym_LT,
-    ACTIONS(345), 4,
+    ACTIONS(321), 4,
       sym__text_fragment,
       sym_comment,
       anon_sym_LT_SLASH,
       anon_sym_LBRACE_LBRACE,
-  [1825] = 2,
-    ACTIONS(263), 1,
+  [2632] = 2,
+    ACTIONS(339), 1,
       anon_sym_LT,
-    ACTIONS(265), 4,
+    ACTIONS(341), 4,
       sym__text_fragment,
       sym_comment,
       anon_sym_LT_SLASH,
       anon_sym_LBRACE_LBRACE,
-  [1835] = 3,
-    ACTIONS(131), 1,
-      sym_attribute_name,
-    ACTIONS(174), 1,
-      anon_sym_EQ,
-    ACTIONS(127), 3,
-      anon_sym_GT,
-      sym_directive_name,
-      sym_directive_shorthand,
-  [1847] = 2,
-    ACTIONS(347), 1,
+  [2642] = 2,
+    ACTIONS(255), 1,
       anon_sym_LT,
-    ACTIONS(349), 4,
+    ACTIONS(257), 4,
       sym__text_fragment,
       sym_comment,
       anon_sym_LT_SLASH,
       anon_sym_LBRACE_LBRACE,
-  [1857] = 2,
-    ACTIONS(291), 1,
+  [2652] = 2,
+    ACTIONS(267), 1,
       anon_sym_LT,
-    ACTIONS(293), 4,
+    ACTIONS(269), 4,
       sym__text_fragment,
       sym_comment,
       anon_sym_LT_SLASH,
       anon_sym_LBRACE_LBRACE,
-  [1867] = 2,
-    ACTIONS(287), 1,
+  [2662] = 2,
+    ACTIONS(343), 1,
       anon_sym_LT,
-    ACTIONS(289), 4,
+    ACTIONS(345), 4,
       sym__text_fragment,
       sym_comment,
       anon_sym_LT_SLASH,
       anon_sym_LBRACE_LBRACE,
-  [1877] = 3,
-    ACTIONS(351), 1,
-      aux_sym_directive_argument_token1,
-    ACTIONS(353), 1,
-      anon_sym_LBRACK,
-    STATE(21), 2,
-      sym_directive_argument,
-      sym_directive_dynamic_argument,
-  [1888] = 4,
-    ACTIONS(355), 1,
+  [2672] = 4,
+    ACTIONS(347), 1,
       sym_attribute_value,
-    ACTIONS(357), 1,
+    ACTIONS(349), 1,
       anon_sym_SQUOTE,
-    ACTIONS(359), 1,
+    ACTIONS(351), 1,
       anon_sym_DQUOTE,
-    STATE(124), 1,
+    STATE(61), 1,
       sym_quoted_attribute_value,
-  [1901] = 4,
-    ACTIONS(361), 1,
-      sym_attribute_value,
-    ACTIONS(363), 1,
+  [2685] = 4,
+    ACTIONS(349), 1,
       anon_sym_SQUOTE,
-    ACTIONS(365), 1,
+    ACTIONS(351), 1,
       anon_sym_DQUOTE,
-    STATE(93), 1,
+    ACTIONS(353), 1,
+      sym_attribute_value,
+    STATE(65), 1,
       sym_quoted_attribute_value,
-  [1914] = 4,
-    ACTIONS(367), 1,
+  [2698] = 4,
+    ACTIONS(355), 1,
       sym__start_tag_name,
-    ACTIONS(369), 1,
+    ACTIONS(357), 1,
       sym__template_start_tag_name,
-    ACTIONS(371), 1,
+    ACTIONS(359), 1,
       sym__script_start_tag_name,
-    ACTIONS(373), 1,
+    ACTIONS(361), 1,
       sym__style_start_tag_name,
-  [1927] = 4,
-    ACTIONS(369), 1,
+  [2711] = 4,
+    ACTIONS(357), 1,
       sym__template_start_tag_name,
-    ACTIONS(371), 1,
+    ACTIONS(359), 1,
       sym__script_start_tag_name,
-    ACTIONS(373), 1,
+    ACTIONS(361), 1,
       sym__style_start_tag_name,
-    ACTIONS(375), 1,
-      sym__start_tag_name,
-  [1940] = 4,
     ACTIONS(363), 1,
-      anon_sym_SQUOTE,
+      sym__start_tag_name,
+  [2724] = 3,
     ACTIONS(365), 1,
+      aux_sym_directive_argument_token1,
+    ACTIONS(367), 1,
+      anon_sym_LBRACK,
+    STATE(26), 2,
+      sym_directive_argument,
+      sym_directive_dynamic_argument,
+  [2735] = 4,
+    ACTIONS(349), 1,
+      anon_sym_SQUOTE,
+    ACTIONS(351), 1,
       anon_sym_DQUOTE,
-    ACTIONS(377), 1,
+    ACTIONS(369), 1,
       sym_attribute_value,
-    STATE(79), 1,
+    STATE(58), 1,
       sym_quoted_attribute_value,
-  [1953] = 4,
-    ACTIONS(357), 1,
+  [2748] = 4,
+    ACTIONS(371), 1,
+      sym_attribute_value,
+    ACTIONS(373), 1,
       anon_sym_SQUOTE,
+    ACTIONS(375), 1,
+      anon_sym_DQUOTE,
+    STATE(70), 1,
+      sym_quoted_attribute_value,
+  [2761] = 4,
+    ACTIONS(357), 1,
+      sym__template_start_tag_name,
     ACTIONS(359), 1,
+      sym__script_start_tag_name,
+    ACTIONS(361), 1,
+      sym__style_start_tag_name,
+    ACTIONS(377), 1,
+      sym__start_tag_name,
+  [2774] = 4,
+    ACTIONS(373), 1,
+      anon_sym_SQUOTE,
+    ACTIONS(375), 1,
       anon_sym_DQUOTE,
     ACTIONS(379), 1,
       sym_attribute_value,
-    STATE(128), 1,
+    STATE(67), 1,
       sym_quoted_attribute_value,
-  [1966] = 4,
-    ACTIONS(357), 1,
+  [2787] = 4,
+    ACTIONS(373), 1,
       anon_sym_SQUOTE,
-    ACTIONS(359), 1,
+    ACTIONS(375), 1,
       anon_sym_DQUOTE,
     ACTIONS(381), 1,
       sym_attribute_value,
-    STATE(125), 1,
+    STATE(72), 1,
       sym_quoted_attribute_value,
-  [1979] = 3,
+  [2800] = 4,
+    ACTIONS(373), 1,
+      anon_sym_SQUOTE,
+    ACTIONS(375), 1,
+      anon_sym_DQUOTE,
     ACTIONS(383), 1,
+      sym_attribute_value,
+    STATE(66), 1,
+      sym_quoted_attribute_value,
+  [2813] = 4,
+    ACTIONS(373), 1,
+      anon_sym_SQUOTE,
+    ACTIONS(375), 1,
+      anon_sym_DQUOTE,
+    ACTIONS(385), 1,
+      sym_attribute_value,
+    STATE(69), 1,
+      sym_quoted_attribute_value,
+  [2826] = 3,
+    ACTIONS(387), 1,
+      aux_sym_directive_argument_token1,
+    ACTIONS(389), 1,
+      anon_sym_LBRACK,
+    STATE(34), 2,
+      sym_directive_argument,
+      sym_directive_dynamic_argument,
+  [2837] = 3,
+    ACTIONS(365), 1,
       aux_sym_directive_argument_token1,
-    ACTIONS(385), 1,
+    ACTIONS(367), 1,
       anon_sym_LBRACK,
-    STATE(31), 2,
+    STATE(28), 2,
       sym_directive_argument,
       sym_directive_dynamic_argument,
-  [1990] = 4,
-    ACTIONS(357), 1,
-      anon_sym_SQUOTE,
-    ACTIONS(359), 1,
-      anon_sym_DQUOTE,
+  [2848] = 3,
     ACTIONS(387), 1,
-      sym_attribute_value,
-    STATE(116), 1,
-      sym_quoted_attribute_value,
-  [2003] = 2,
-    ACTIONS(337), 1,
-      sym_attribute_name,
-    ACTIONS(335), 3,
-      anon_sym_GT,
-      sym_directive_name,
-      sym_directive_shorthand,
-  [2012] = 2,
-    ACTIONS(131), 1,
-      sym_attribute_name,
-    ACTIONS(127), 3,
-      anon_sym_GT,
-      sym_directive_name,
-      sym_directive_shorthand,
-  [2021] = 4,
-    ACTIONS(357), 1,
-      anon_sym_SQUOTE,
-    ACTIONS(359), 1,
-      anon_sym_DQUOTE,
-    ACTIONS(389), 1,
-      sym_attribute_value,
-    STATE(115), 1,
-      sym_quoted_attribute_value,
-  [2034] = 3,
-    ACTIONS(383), 1,
       aux_sym_directive_argument_token1,
-    ACTIONS(385), 1,
+    ACTIONS(389), 1,
       anon_sym_LBRACK,
-    STATE(24), 2,
+    STATE(37), 2,
       sym_directive_argument,
       sym_directive_dynamic_argument,
-  [2045] = 4,
-    ACTIONS(363), 1,
+  [2859] = 4,
+    ACTIONS(349), 1,
       anon_sym_SQUOTE,
-    ACTIONS(365), 1,
+    ACTIONS(351), 1,
       anon_sym_DQUOTE,
     ACTIONS(391), 1,
       sym_attribute_value,
-    STATE(86), 1,
+    STATE(56), 1,
       sym_quoted_attribute_value,
-  [2058] = 4,
-    ACTIONS(363), 1,
+  [2872] = 4,
+    ACTIONS(349), 1,
       anon_sym_SQUOTE,
-    ACTIONS(365), 1,
+    ACTIONS(351), 1,
       anon_sym_DQUOTE,
     ACTIONS(393), 1,
       sym_attribute_value,
-    STATE(88), 1,
-      sym_quoted_attribute_value,
-  [2071] = 4,
-    ACTIONS(363), 1,
-      anon_sym_SQUOTE,
-    ACTIONS(365), 1,
-      anon_sym_DQUOTE,
-    ACTIONS(395), 1,
-      sym_attribute_value,
-    STATE(90), 1,
+    STATE(59), 1,
       sym_quoted_attribute_value,
-  [2084] = 4,
-    ACTIONS(369), 1,
-      sym__template_start_tag_name,
-    ACTIONS(371), 1,
-      sym__script_start_tag_name,
-    ACTIONS(373), 1,
-      sym__style_start_tag_name,
-    ACTIONS(397), 1,
-      sym__start_tag_name,
-  [2097] = 2,
-    ACTIONS(321), 1,
-      sym_attribute_name,
-    ACTIONS(319), 3,
-      anon_sym_GT,
-      sym_directive_name,
-      sym_directive_shorthand,
-  [2106] = 2,
-    ACTIONS(333), 1,
-      sym_attribute_name,
-    ACTIONS(331), 3,
-      anon_sym_GT,
-      sym_directive_name,
-      sym_directive_shorthand,
-  [2115] = 2,
-    ACTIONS(313), 1,
-      sym_attribute_name,
-    ACTIONS(309), 3,
-      anon_sym_GT,
-      sym_directive_name,
-      sym_directive_shorthand,
-  [2124] = 3,
-    ACTIONS(351), 1,
-      aux_sym_directive_argument_token1,
-    ACTIONS(353), 1,
-      anon_sym_LBRACK,
-    STATE(20), 2,
-      sym_directive_argument,
-      sym_directive_dynamic_argument,
-  [2135] = 2,
-    ACTIONS(325), 1,
-      sym_attribute_name,
-    ACTIONS(323), 3,
-      anon_sym_GT,
-      sym_directive_name,
-      sym_directive_shorthand,
-  [2144] = 2,
-    ACTIONS(329), 1,
-      sym_attribute_name,
-    ACTIONS(327), 3,
-      anon_sym_GT,
-      sym_directive_name,
-      sym_directive_shorthand,
-  [2153] = 1,
-    ACTIONS(301), 3,
-      sym_comment,
-      ts_builtin_sym_end,
-      anon_sym_LT,
-  [2159] = 1,
-    ACTIONS(241), 3,
+  [2885] = 1,
+    ACTIONS(325), 3,
       sym_comment,
       ts_builtin_sym_end,
       anon_sym_LT,
-  [2165] = 1,
-    ACTIONS(249), 3,
-      sym_comment,
-      ts_builtin_sym_end,
-      anon_sym_LT,
-  [2171] = 1,
-    ACTIONS(269), 3,
-      sym_comment,
-      ts_builtin_sym_end,
-      anon_sym_LT,
-  [2177] = 3,
-    ACTIONS(399), 1,
+  [2891] = 3,
+    ACTIONS(395), 1,
       anon_sym_LT_SLASH,
-    ACTIONS(401), 1,
+    ACTIONS(397), 1,
       sym_raw_text,
-    STATE(143), 1,
+    STATE(147), 1,
       sym_end_tag,
-  [2187] = 3,
-    ACTIONS(399), 1,
+  [2901] = 3,
+    ACTIONS(395), 1,
       anon_sym_LT_SLASH,
-    ACTIONS(403), 1,
+    ACTIONS(399), 1,
       sym_raw_text,
-    STATE(142), 1,
+    STATE(148), 1,
       sym_end_tag,
-  [2197] = 1,
-    ACTIONS(257), 3,
+  [2911] = 1,
+    ACTIONS(321), 3,
       sym_comment,
       ts_builtin_sym_end,
       anon_sym_LT,
-  [2203] = 3,
-    ACTIONS(405), 1,
+  [2917] = 3,
+    ACTIONS(401), 1,
       anon_sym_LT_SLASH,
-    ACTIONS(407), 1,
+    ACTIONS(403), 1,
       sym_raw_text,
-    STATE(89), 1,
+    STATE(107), 1,
       sym_end_tag,
-  [2213] = 3,
-    ACTIONS(405), 1,
+  [2927] = 3,
+    ACTIONS(401), 1,
       anon_sym_LT_SLASH,
-    ACTIONS(409), 1,
+    ACTIONS(405), 1,
       sym_raw_text,
-    STATE(92), 1,
+    STATE(108), 1,
       sym_end_tag,
-  [2223] = 1,
+  [2937] = 1,
+    ACTIONS(329), 3,
+      sym_comment,
+      ts_builtin_sym_end,
+      anon_sym_LT,
+  [2943] = 1,
     ACTIONS(297), 3,
       sym_comment,
       ts_builtin_sym_end,
       anon_sym_LT,
-  [2229] = 1,
-    ACTIONS(245), 3,
+  [2949] = 1,
+    ACTIONS(285), 3,
       sym_comment,
       ts_builtin_sym_end,
       anon_sym_LT,
-  [2235] = 1,
+  [2955] = 1,
     ACTIONS(273), 3,
       sym_comment,
       ts_builtin_sym_end,
       anon_sym_LT,
-  [2241] = 1,
-    ACTIONS(253), 3,
+  [2961] = 1,
+    ACTIONS(289), 3,
+      sym_comment,
+      ts_builtin_sym_end,
+      anon_sym_LT,
+  [2967] = 1,
+    ACTIONS(333), 3,
       sym_comment,
       ts_builtin_sym_end,
       anon_sym_LT,
-  [2247] = 1,
-    ACTIONS(277), 3,
+  [2973] = 1,
+    ACTIONS(309), 3,
+      sym_comment,
+      ts_builtin_sym_end,
+      anon_sym_LT,
+  [2979] = 1,
+    ACTIONS(313), 3,
       sym_comment,
       ts_builtin_sym_end,
       anon_sym_LT,
-  [2253] = 1,
+  [2985] = 1,
     ACTIONS(281), 3,
       sym_comment,
       ts_builtin_sym_end,
       anon_sym_LT,
-  [2259] = 3,
-    ACTIONS(411), 1,
+  [2991] = 1,
+    ACTIONS(337), 3,
+      sym_comment,
+      ts_builtin_sym_end,
+      anon_sym_LT,
+  [2997] = 3,
+    ACTIONS(407), 1,
       anon_sym_LT_SLASH,
-    ACTIONS(413), 1,
+    ACTIONS(409), 1,
       sym_raw_text,
-    STATE(62), 1,
+    STATE(96), 1,
       sym_end_tag,
-  [2269] = 3,
-    ACTIONS(411), 1,
+  [3007] = 3,
+    ACTIONS(407), 1,
       anon_sym_LT_SLASH,
-    ACTIONS(415), 1,
+    ACTIONS(411), 1,
       sym_raw_text,
-    STATE(61), 1,
+    STATE(81), 1,
       sym_end_tag,
-  [2279] = 1,
-    ACTIONS(285), 3,
-      sym_comment,
-      ts_builtin_sym_end,
-      anon_sym_LT,
-  [2285] = 2,
+  [3017] = 2,
+    ACTIONS(413), 1,
+      anon_sym_RBRACK,
+    ACTIONS(415), 1,
+      sym_directive_dynamic_argument_value,
+  [3024] = 2,
     ACTIONS(417), 1,
-      anon_sym_SQUOTE,
+      sym__end_tag_name,
     ACTIONS(419), 1,
-      aux_sym_quoted_attribute_value_token1,
-  [2292] = 2,
-    ACTIONS(399), 1,
+      sym_erroneous_end_tag_name,
+  [3031] = 2,
+    ACTIONS(395), 1,
       anon_sym_LT_SLASH,
-    STATE(131), 1,
+    STATE(141), 1,
+      sym_end_tag,
+  [3038] = 2,
+    ACTIONS(407), 1,
+      anon_sym_LT_SLASH,
+    STATE(83), 1,
+      sym_end_tag,
+  [3045] = 2,
+    ACTIONS(407), 1,
+      anon_sym_LT_SLASH,
+    STATE(86), 1,
       sym_end_tag,
-  [2299] = 2,
+  [3052] = 2,
     ACTIONS(421), 1,
       sym__end_tag_name,
     ACTIONS(423), 1,
       sym_erroneous_end_tag_name,
-  [2306] = 2,
-    ACTIONS(421), 1,
-      sym__end_tag_name,
+  [3059] = 2,
+    ACTIONS(419), 1,
+      sym_erroneous_end_tag_name,
     ACTIONS(425), 1,
+      sym__end_tag_name,
+  [3066] = 2,
+    ACTIONS(423), 1,
       sym_erroneous_end_tag_name,
-  [2313] = 2,
+    ACTIONS(425), 1,
+      sym__end_tag_name,
+  [3073] = 2,
     ACTIONS(427), 1,
       aux_sym_directive_argument_token1,
-    STATE(70), 1,
+    STATE(39), 1,
       sym_directive_modifier,
-  [2320] = 2,
+  [3080] = 2,
     ACTIONS(429), 1,
       anon_sym_RBRACK,
     ACTIONS(431), 1,
       sym_directive_dynamic_argument_value,
-  [2327] = 1,
-    ACTIONS(433), 2,
-      sym_raw_text,
-      anon_sym_LT_SLASH,
-  [2332] = 2,
-    ACTIONS(423), 1,
-      sym_erroneous_end_tag_name,
+  [3087] = 2,
+    ACTIONS(433), 1,
+      anon_sym_SQUOTE,
     ACTIONS(435), 1,
+      aux_sym_quoted_attribute_value_token1,
+  [3094] = 2,
+    ACTIONS(419), 1,
+      sym_erroneous_end_tag_name,
+    ACTIONS(421), 1,
       sym__end_tag_name,
-  [2339] = 1,
-    ACTIONS(437), 2,
-      sym_raw_text,
+  [3101] = 2,
+    ACTIONS(401), 1,
       anon_sym_LT_SLASH,
-  [2344] = 2,
-    ACTIONS(405), 1,
+    STATE(102), 1,
+      sym_end_tag,
+  [3108] = 2,
+    ACTIONS(437), 1,
+      aux_sym_directive_argument_token1,
+    STATE(48), 1,
+      sym_directive_modifier,
+  [3115] = 2,
+    ACTIONS(401), 1,
       anon_sym_LT_SLASH,
-    STATE(80), 1,
+    STATE(97), 1,
       sym_end_tag,
-  [2351] = 2,
+  [3122] = 2,
     ACTIONS(439), 1,
       anon_sym_SQUOTE,
     ACTIONS(441), 1,
       aux_sym_quoted_attribute_value_token1,
-  [2358] = 2,
+  [3129] = 2,
     ACTIONS(439), 1,
       anon_sym_DQUOTE,
     ACTIONS(443), 1,
       aux_sym_quoted_attribute_value_token2,
-  [2365] = 2,
-    ACTIONS(423), 1,
-      sym_erroneous_end_tag_name,
-    ACTIONS(445), 1,
-      sym__end_tag_name,
-  [2372] = 2,
-    ACTIONS(405), 1,
-      anon_sym_LT_SLASH,
-    STATE(81), 1,
-      sym_end_tag,
-  [2379] = 1,
-    ACTIONS(447), 2,
+  [3136] = 1,
+    ACTIONS(445), 2,
       sym_raw_text,
       anon_sym_LT_SLASH,
-  [2384] = 2,
-    ACTIONS(449), 1,
-      anon_sym_RBRACK,
-    ACTIONS(451), 1,
-      sym_directive_dynamic_argument_value,
-  [2391] = 2,
-    ACTIONS(417), 1,
+  [3141] = 2,
+    ACTIONS(433), 1,
       anon_sym_DQUOTE,
-    ACTIONS(453), 1,
+    ACTIONS(447), 1,
       aux_sym_quoted_attribute_value_token2,
-  [2398] = 2,
-    ACTIONS(455), 1,
-      aux_sym_directive_argument_token1,
-    STATE(45), 1,
-      sym_directive_modifier,
-  [2405] = 1,
-    ACTIONS(457), 2,
+  [3148] = 1,
+    ACTIONS(449), 2,
       sym_raw_text,
       anon_sym_LT_SLASH,
-  [2410] = 2,
-    ACTIONS(411), 1,
+  [3153] = 1,
+    ACTIONS(451), 2,
+      sym_raw_text,
       anon_sym_LT_SLASH,
-    STATE(51), 1,
-      sym_end_tag,
-  [2417] = 2,
-    ACTIONS(411), 1,
+  [3158] = 2,
+    ACTIONS(395), 1,
       anon_sym_LT_SLASH,
-    STATE(49), 1,
+    STATE(140), 1,
       sym_end_tag,
-  [2424] = 2,
-    ACTIONS(425), 1,
-      sym_erroneous_end_tag_name,
-    ACTIONS(445), 1,
+  [3165] = 2,
+    ACTIONS(417), 1,
       sym__end_tag_name,
-  [2431] = 2,
-    ACTIONS(399), 1,
+    ACTIONS(423), 1,
+      sym_erroneous_end_tag_name,
+  [3172] = 1,
+    ACTIONS(453), 2,
+      sym_raw_text,
       anon_sym_LT_SLASH,
-    STATE(130), 1,
-      sym_end_tag,
-  [2438] = 2,
-    ACTIONS(425), 1,
+  [3177] = 1,
+    ACTIONS(455), 1,
+      anon_sym_RBRACE_RBRACE,
+  [3181] = 1,
+    ACTIONS(423), 1,
       sym_erroneous_end_tag_name,
-    ACTIONS(435), 1,
+  [3185] = 1,
+    ACTIONS(417), 1,
       sym__end_tag_name,
-  [2445] = 1,
-    ACTIONS(459), 1,
-      anon_sym_SQUOTE,
-  [2449] = 1,
-    ACTIONS(459), 1,
+  [3189] = 1,
+    ACTIONS(457), 1,
       anon_sym_DQUOTE,
-  [2453] = 1,
+  [3193] = 1,
+    ACTIONS(459), 1,
+      anon_sym_GT,
+  [3197] = 1,
     ACTIONS(461), 1,
-      anon_sym_RBRACK,
-  [2457] = 1,
+      anon_sym_GT,
+  [3201] = 1,
+    ACTIONS(457), 1,
+      anon_sym_SQUOTE,
+  [3205] = 1,
     ACTIONS(463), 1,
-      anon_sym_RBRACE_RBRACE,
-  [2461] = 1,
+      anon_sym_RBRACK,
+  [3209] = 1,
     ACTIONS(465), 1,
-      anon_sym_DQUOTE,
-  [2465] = 1,
-    ACTIONS(425), 1,
-      sym_erroneous_end_tag_name,
-  [2469] = 1,
+      ts_builtin_sym_end,
+  [3213] = 1,
     ACTIONS(467), 1,
-      anon_sym_RBRACK,
-  [2473] = 1,
-    ACTIONS(469), 1,
       anon_sym_GT,
-  [2477] = 1,
+  [3217] = 1,
+    ACTIONS(419), 1,
+      sym_erroneous_end_tag_name,
+  [3221] = 1,
+    ACTIONS(469), 1,
+      anon_sym_RBRACK,
+  [3225] = 1,
+    ACTIONS(425), 1,
+      sym__end_tag_name,
+  [3229] = 1,
     ACTIONS(471), 1,
-      ts_builtin_sym_end,
-  [2481] = 1,
-    ACTIONS(473), 1,
-      anon_sym_GT,
-  [2485] = 1,
-    ACTIONS(475), 1,
       anon_sym_RBRACE_RBRACE,
-  [2489] = 1,
-    ACTIONS(477), 1,
-      anon_sym_GT,
-  [2493] = 1,
-    ACTIONS(445), 1,
-      sym__end_tag_name,
-  [2497] = 1,
-    ACTIONS(423), 1,
-      sym_erroneous_end_tag_name,
-  [2501] = 1,
-    ACTIONS(479), 1,
+  [3233] = 1,
+    ACTIONS(473), 1,
       anon_sym_GT,
-  [2505] = 1,
+  [3237] = 1,
     ACTIONS(421), 1,
       sym__end_tag_name,
-  [2509] = 1,
-    ACTIONS(481), 1,
+  [3241] = 1,
+    ACTIONS(475), 1,
       anon_sym_GT,
-  [2513] = 1,
-    ACTIONS(435), 1,
-      sym__end_tag_name,
-  [2517] = 1,
-    ACTIONS(465), 1,
+  [3245] = 1,
+    ACTIONS(477), 1,
       anon_sym_SQUOTE,
+  [3249] = 1,
+    ACTIONS(477), 1,
+      anon_sym_DQUOTE,
 };
 
 static const uint32_t ts_small_parse_table_map[] = {
   [SMALL_STATE(2)] = 0,
-  [SMALL_STATE(3)] = 48,
-  [SMALL_STATE(4)] = 96,
-  [SMALL_STATE(5)] = 144,
-  [SMALL_STATE(6)] = 192,
-  [SMALL_STATE(7)] = 240,
-  [SMALL_STATE(8)] = 288,
-  [SMALL_STATE(9)] = 333,
-  [SMALL_STATE(10)] = 378,
-  [SMALL_STATE(11)] = 423,
+  [SMALL_STATE(3)] = 50,
+  [SMALL_STATE(4)] = 100,
+  [SMALL_STATE(5)] = 150,
+  [SMALL_STATE(6)] = 200,
+  [SMALL_STATE(7)] = 250,
+  [SMALL_STATE(8)] = 300,
+  [SMALL_STATE(9)] = 347,
+  [SMALL_STATE(10)] = 394,
+  [SMALL_STATE(11)] = 431,
   [SMALL_STATE(12)] = 468,
-  [SMALL_STATE(13)] = 513,
-  [SMALL_STATE(14)] = 558,
-  [SMALL_STATE(15)] = 603,
-  [SMALL_STATE(16)] = 645,
-  [SMALL_STATE(17)] = 677,
-  [SMALL_STATE(18)] = 709,
-  [SMALL_STATE(19)] = 734,
-  [SMALL_STATE(20)] = 758,
-  [SMALL_STATE(21)] = 780,
-  [SMALL_STATE(22)] = 802,
-  [SMALL_STATE(23)] = 823,
-  [SMALL_STATE(24)] = 840,
-  [SMALL_STATE(25)] = 861,
-  [SMALL_STATE(26)] = 878,
-  [SMALL_STATE(27)] = 899,
-  [SMALL_STATE(28)] = 916,
-  [SMALL_STATE(29)] = 937,
-  [SMALL_STATE(30)] = 958,
-  [SMALL_STATE(31)] = 979,
-  [SMALL_STATE(32)] = 1000,
-  [SMALL_STATE(33)] = 1021,
-  [SMALL_STATE(34)] = 1040,
-  [SMALL_STATE(35)] = 1058,
-  [SMALL_STATE(36)] = 1074,
-  [SMALL_STATE(37)] = 1092,
-  [SMALL_STATE(38)] = 1110,
-  [SMALL_STATE(39)] = 1128,
-  [SMALL_STATE(40)] = 1144,
-  [SMALL_STATE(41)] = 1156,
-  [SMALL_STATE(42)] = 1174,
-  [SMALL_STATE(43)] = 1186,
-  [SMALL_STATE(44)] = 1198,
-  [SMALL_STATE(45)] = 1210,
-  [SMALL_STATE(46)] = 1222,
-  [SMALL_STATE(47)] = 1240,
-  [SMALL_STATE(48)] = 1256,
-  [SMALL_STATE(49)] = 1274,
-  [SMALL_STATE(50)] = 1285,
-  [SMALL_STATE(51)] = 1296,
-  [SMALL_STATE(52)] = 1307,
-  [SMALL_STATE(53)] = 1320,
-  [SMALL_STATE(54)] = 1331,
-  [SMALL_STATE(55)] = 1342,
-  [SMALL_STATE(56)] = 1353,
-  [SMALL_STATE(57)] = 1364,
-  [SMALL_STATE(58)] = 1375,
-  [SMALL_STATE(59)] = 1386,
-  [SMALL_STATE(60)] = 1397,
-  [SMALL_STATE(61)] = 1408,
-  [SMALL_STATE(62)] = 1419,
-  [SMALL_STATE(63)] = 1430,
-  [SMALL_STATE(64)] = 1441,
-  [SMALL_STATE(65)] = 1452,
-  [SMALL_STATE(66)] = 1463,
-  [SMALL_STATE(67)] = 1474,
-  [SMALL_STATE(68)] = 1485,
-  [SMALL_STATE(69)] = 1496,
-  [SMALL_STATE(70)] = 1509,
-  [SMALL_STATE(71)] = 1520,
-  [SMALL_STATE(72)] = 1531,
-  [SMALL_STATE(73)] = 1544,
-  [SMALL_STATE(74)] = 1555,
-  [SMALL_STATE(75)] = 1568,
-  [SMALL_STATE(76)] = 1579,
-  [SMALL_STATE(77)] = 1589,
-  [SMALL_STATE(78)] = 1601,
-  [SMALL_STATE(79)] = 1611,
-  [SMALL_STATE(80)] = 1621,
-  [SMALL_STATE(81)] = 1631,
-  [SMALL_STATE(82)] = 1641,
-  [SMALL_STATE(83)] = 1651,
-  [SMALL_STATE(84)] = 1661,
-  [SMALL_STATE(85)] = 1671,
-  [SMALL_STATE(86)] = 1681,
-  [SMALL_STATE(87)] = 1691,
-  [SMALL_STATE(88)] = 1701,
-  [SMALL_STATE(89)] = 1711,
-  [SMALL_STATE(90)] = 1721,
-  [SMALL_STATE(91)] = 1731,
-  [SMALL_STATE(92)] = 1741,
-  [SMALL_STATE(93)] = 1751,
-  [SMALL_STATE(94)] = 1761,
-  [SMALL_STATE(95)] = 1771,
-  [SMALL_STATE(96)] = 1781,
-  [SMALL_STATE(97)] = 1791,
-  [SMALL_STATE(98)] = 1803,
-  [SMALL_STATE(99)] = 1815,
-  [SMALL_STATE(100)] = 1825,
-  [SMALL_STATE(101)] = 1835,
-  [SMALL_STATE(102)] = 1847,
-  [SMALL_STATE(103)] = 1857,
-  [SMALL_STATE(104)] = 1867,
-  [SMALL_STATE(105)] = 1877,
-  [SMALL_STATE(106)] = 1888,
-  [SMALL_STATE(107)] = 1901,
-  [SMALL_STATE(108)] = 1914,
-  [SMALL_STATE(109)] = 1927,
-  [SMALL_STATE(110)] = 1940,
-  [SMALL_STATE(111)] = 1953,
-  [SMALL_STATE(112)] = 1966,
-  [SMALL_STATE(113)] = 1979,
-  [SMALL_STATE(114)] = 1990,
-  [SMALL_STATE(115)] = 2003,
-  [SMALL_STATE(116)] = 2012,
-  [SMALL_STATE(117)] = 2021,
-  [SMALL_STATE(118)] = 2034,
-  [SMALL_STATE(119)] = 2045,
-  [SMALL_STATE(120)] = 2058,
-  [SMALL_STATE(121)] = 2071,
-  [SMALL_STATE(122)] = 2084,
-  [SMALL_STATE(123)] = 2097,
-  [SMALL_STATE(124)] = 2106,
-  [SMALL_STATE(125)] = 2115,
-  [SMALL_STATE(126)] = 2124,
-  [SMALL_STATE(127)] = 2135,
-  [SMALL_STATE(128)] = 2144,
-  [SMALL_STATE(129)] = 2153,
-  [SMALL_STATE(130)] = 2159,
-  [SMALL_STATE(131)] = 2165,
-  [SMALL_STATE(132)] = 2171,
-  [SMALL_STATE(133)] = 2177,
-  [SMALL_STATE(134)] = 2187,
-  [SMALL_STATE(135)] = 2197,
-  [SMALL_STATE(136)] = 2203,
-  [SMALL_STATE(137)] = 2213,
-  [SMALL_STATE(138)] = 2223,
-  [SMALL_STATE(139)] = 2229,
-  [SMALL_STATE(140)] = 2235,
-  [SMALL_STATE(141)] = 2241,
-  [SMALL_STATE(142)] = 2247,
-  [SMALL_STATE(143)] = 2253,
-  [SMALL_STATE(144)] = 2259,
-  [SMALL_STATE(145)] = 2269,
-  [SMALL_STATE(146)] = 2279,
-  [SMALL_STATE(147)] = 2285,
-  [SMALL_STATE(148)] = 2292,
-  [SMALL_STATE(149)] = 2299,
-  [SMALL_STATE(150)] = 2306,
-  [SMALL_STATE(151)] = 2313,
-  [SMALL_STATE(152)] = 2320,
-  [SMALL_STATE(153)] = 2327,
-  [SMALL_STATE(154)] = 2332,
-  [SMALL_STATE(155)] = 2339,
-  [SMALL_STATE(156)] = 2344,
-  [SMALL_STATE(157)] = 2351,
-  [SMALL_STATE(158)] = 2358,
-  [SMALL_STATE(159)] = 2365,
-  [SMALL_STATE(160)] = 2372,
-  [SMALL_STATE(161)] = 2379,
-  [SMALL_STATE(162)] = 2384,
-  [SMALL_STATE(163)] = 2391,
-  [SMALL_STATE(164)] = 2398,
-  [SMALL_STATE(165)] = 2405,
-  [SMALL_STATE(166)] = 2410,
-  [SMALL_STATE(167)] = 2417,
-  [SMALL_STATE(168)] = 2424,
-  [SMALL_STATE(169)] = 2431,
-  [SMALL_STATE(170)] = 2438,
-  [SMALL_STATE(171)] = 2445,
-  [SMALL_STATE(172)] = 2449,
-  [SMALL_STATE(173)] = 2453,
-  [SMALL_STATE(174)] = 2457,
-  [SMALL_STATE(175)] = 2461,
-  [SMALL_STATE(176)] = 2465,
-  [SMALL_STATE(177)] = 2469,
-  [SMALL_STATE(178)] = 2473,
-  [SMALL_STATE(179)] = 2477,
-  [SMALL_STATE(180)] = 2481,
-  [SMALL_STATE(181)] = 2485,
-  [SMALL_STATE(182)] = 2489,
-  [SMALL_STATE(183)] = 2493,
-  [SMALL_STATE(184)] = 2497,
-  [SMALL_STATE(185)] = 2501,
-  [SMALL_STATE(186)] = 2505,
-  [SMALL_STATE(187)] = 2509,
-  [SMALL_STATE(188)] = 2513,
-  [SMALL_STATE(189)] = 2517,
+  [SMALL_STATE(13)] = 503,
+  [SMALL_STATE(14)] = 538,
+  [SMALL_STATE(15)] = 575,
+  [SMALL_STATE(16)] = 622,
+  [SMALL_STATE(17)] = 659,
+  [SMALL_STATE(18)] = 696,
+  [SMALL_STATE(19)] = 743,
+  [SMALL_STATE(20)] = 780,
+  [SMALL_STATE(21)] = 827,
+  [SMALL_STATE(22)] = 874,
+  [SMALL_STATE(23)] = 921,
+  [SMALL_STATE(24)] = 965,
+  [SMALL_STATE(25)] = 999,
+  [SMALL_STATE(26)] = 1033,
+  [SMALL_STATE(27)] = 1065,
+  [SMALL_STATE(28)] = 1099,
+  [SMALL_STATE(29)] = 1131,
+  [SMALL_STATE(30)] = 1165,
+  [SMALL_STATE(31)] = 1199,
+  [SMALL_STATE(32)] = 1233,
+  [SMALL_STATE(33)] = 1267,
+  [SMALL_STATE(34)] = 1301,
+  [SMALL_STATE(35)] = 1332,
+  [SMALL_STATE(36)] = 1359,
+  [SMALL_STATE(37)] = 1386,
+  [SMALL_STATE(38)] = 1417,
+  [SMALL_STATE(39)] = 1439,
+  [SMALL_STATE(40)] = 1461,
+  [SMALL_STATE(41)] = 1483,
+  [SMALL_STATE(42)] = 1509,
+  [SMALL_STATE(43)] = 1531,
+  [SMALL_STATE(44)] = 1557,
+  [SMALL_STATE(45)] = 1579,
+  [SMALL_STATE(46)] = 1602,
+  [SMALL_STATE(47)] = 1623,
+  [SMALL_STATE(48)] = 1646,
+  [SMALL_STATE(49)] = 1667,
+  [SMALL_STATE(50)] = 1688,
+  [SMALL_STATE(51)] = 1709,
+  [SMALL_STATE(52)] = 1732,
+  [SMALL_STATE(53)] = 1753,
+  [SMALL_STATE(54)] = 1776,
+  [SMALL_STATE(55)] = 1798,
+  [SMALL_STATE(56)] = 1820,
+  [SMALL_STATE(57)] = 1840,
+  [SMALL_STATE(58)] = 1860,
+  [SMALL_STATE(59)] = 1880,
+  [SMALL_STATE(60)] = 1900,
+  [SMALL_STATE(61)] = 1920,
+  [SMALL_STATE(62)] = 1940,
+  [SMALL_STATE(63)] = 1960,
+  [SMALL_STATE(64)] = 1982,
+  [SMALL_STATE(65)] = 2004,
+  [SMALL_STATE(66)] = 2024,
+  [SMALL_STATE(67)] = 2043,
+  [SMALL_STATE(68)] = 2062,
+  [SMALL_STATE(69)] = 2081,
+  [SMALL_STATE(70)] = 2100,
+  [SMALL_STATE(71)] = 2119,
+  [SMALL_STATE(72)] = 2138,
+  [SMALL_STATE(73)] = 2157,
+  [SMALL_STATE(74)] = 2176,
+  [SMALL_STATE(75)] = 2208,
+  [SMALL_STATE(76)] = 2240,
+  [SMALL_STATE(77)] = 2257,
+  [SMALL_STATE(78)] = 2273,
+  [SMALL_STATE(79)] = 2284,
+  [SMALL_STATE(80)] = 2295,
+  [SMALL_STATE(81)] = 2306,
+  [SMALL_STATE(82)] = 2317,
+  [SMALL_STATE(83)] = 2328,
+  [SMALL_STATE(84)] = 2339,
+  [SMALL_STATE(85)] = 2350,
+  [SMALL_STATE(86)] = 2361,
+  [SMALL_STATE(87)] = 2372,
+  [SMALL_STATE(88)] = 2383,
+  [SMALL_STATE(89)] = 2394,
+  [SMALL_STATE(90)] = 2405,
+  [SMALL_STATE(91)] = 2416,
+  [SMALL_STATE(92)] = 2427,
+  [SMALL_STATE(93)] = 2438,
+  [SMALL_STATE(94)] = 2449,
+  [SMALL_STATE(95)] = 2460,
+  [SMALL_STATE(96)] = 2471,
+  [SMALL_STATE(97)] = 2482,
+  [SMALL_STATE(98)] = 2492,
+  [SMALL_STATE(99)] = 2502,
+  [SMALL_STATE(100)] = 2512,
+  [SMALL_STATE(101)] = 2522,
+  [SMALL_STATE(102)] = 2532,
+  [SMALL_STATE(103)] = 2542,
+  [SMALL_STATE(104)] = 2552,
+  [SMALL_STATE(105)] = 2562,
+  [SMALL_STATE(106)] = 2572,
+  [SMALL_STATE(107)] = 2582,
+  [SMALL_STATE(108)] = 2592,
+  [SMALL_STATE(109)] = 2602,
+  [SMALL_STATE(110)] = 2612,
+  [SMALL_STATE(111)] = 2622,
+  [SMALL_STATE(112)] = 2632,
+  [SMALL_STATE(113)] = 2642,
+  [SMALL_STATE(114)] = 2652,
+  [SMALL_STATE(115)] = 2662,
+  [SMALL_STATE(116)] = 2672,
+  [SMALL_STATE(117)] = 2685,
+  [SMALL_STATE(118)] = 2698,
+  [SMALL_STATE(119)] = 2711,
+  [SMALL_STATE(120)] = 2724,
+  [SMALL_STATE(121)] = 2735,
+  [SMALL_STATE(122)] = 2748,
+  [SMALL_STATE(123)] = 2761,
+  [SMALL_STATE(124)] = 2774,
+  [SMALL_STATE(125)] = 2787,
+  [SMALL_STATE(126)] = 2800,
+  [SMALL_STATE(127)] = 2813,
+  [SMALL_STATE(128)] = 2826,
+  [SMALL_STATE(129)] = 2837,
+  [SMALL_STATE(130)] = 2848,
+  [SMALL_STATE(131)] = 2859,
+  [SMALL_STATE(132)] = 2872,
+  [SMALL_STATE(133)] = 2885,
+  [SMALL_STATE(134)] = 2891,
+  [SMALL_STATE(135)] = 2901,
+  [SMALL_STATE(136)] = 2911,
+  [SMALL_STATE(137)] = 2917,
+  [SMALL_STATE(138)] = 2927,
+  [SMALL_STATE(139)] = 2937,
+  [SMALL_STATE(140)] = 2943,
+  [SMALL_STATE(141)] = 2949,
+  [SMALL_STATE(142)] = 2955,
+  [SMALL_STATE(143)] = 2961,
+  [SMALL_STATE(144)] = 2967,
+  [SMALL_STATE(145)] = 2973,
+  [SMALL_STATE(146)] = 2979,
+  [SMALL_STATE(147)] = 2985,
+  [SMALL_STATE(148)] = 2991,
+  [SMALL_STATE(149)] = 2997,
+  [SMALL_STATE(150)] = 3007,
+  [SMALL_STATE(151)] = 3017,
+  [SMALL_STATE(152)] = 3024,
+  [SMALL_STATE(153)] = 3031,
+  [SMALL_STATE(154)] = 3038,
+  [SMALL_STATE(155)] = 3045,
+  [SMALL_STATE(156)] = 3052,
+  [SMALL_STATE(157)] = 3059,
+  [SMALL_STATE(158)] = 3066,
+  [SMALL_STATE(159)] = 3073,
+  [SMALL_STATE(160)] = 3080,
+  [SMALL_STATE(161)] = 3087,
+  [SMALL_STATE(162)] = 3094,
+  [SMALL_STATE(163)] = 3101,
+  [SMALL_STATE(164)] = 3108,
+  [SMALL_STATE(165)] = 3115,
+  [SMALL_STATE(166)] = 3122,
+  [SMALL_STATE(167)] = 3129,
+  [SMALL_STATE(168)] = 3136,
+  [SMALL_STATE(169)] = 3141,
+  [SMALL_STATE(170)] = 3148,
+  [SMALL_STATE(171)] = 3153,
+  [SMALL_STATE(172)] = 3158,
+  [SMALL_STATE(173)] = 3165,
+  [SMALL_STATE(174)] = 3172,
+  [SMALL_STATE(175)] = 3177,
+  [SMALL_STATE(176)] = 3181,
+  [SMALL_STATE(177)] = 3185,
+  [SMALL_STATE(178)] = 3189,
+  [SMALL_STATE(179)] = 3193,
+  [SMALL_STATE(180)] = 3197,
+  [SMALL_STATE(181)] = 3201,
+  [SMALL_STATE(182)] = 3205,
+  [SMALL_STATE(183)] = 3209,
+  [SMALL_STATE(184)] = 3213,
+  [SMALL_STATE(185)] = 3217,
+  [SMALL_STATE(186)] = 3221,
+  [SMALL_STATE(187)] = 3225,
+  [SMALL_STATE(188)] = 3229,
+  [SMALL_STATE(189)] = 3233,
+  [SMALL_STATE(190)] = 3237,
+  [SMALL_STATE(191)] = 3241,
+  [SMALL_STATE(192)] = 3245,
+  [SMALL_STATE(193)] = 3249,
 };
 
 static const TSParseActionEntry ts_parse_actions[] = {
   [0] = {.entry = {.count = 0, .reusable = false}},
   [1] = {.entry = {.count = 1, .reusable = false}}, RECOVER(),
   [3] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_component, 0),
-  [5] = {.entry = {.count = 1, .reusable = true}}, SHIFT(122),
-  [7] = {.entry = {.count = 1, .reusable = true}}, SHIFT(16),
-  [9] = {.entry = {.count = 1, .reusable = false}}, SHIFT(109),
-  [11] = {.entry = {.count = 1, .reusable = true}}, SHIFT(170),
-  [13] = {.entry = {.count = 1, .reusable = true}}, SHIFT(27),
-  [15] = {.entry = {.count = 1, .reusable = true}}, SHIFT(53),
-  [17] = {.entry = {.count = 1, .reusable = true}}, SHIFT(138),
-  [19] = {.entry = {.count = 1, .reusable = true}}, SHIFT(7),
-  [21] = {.entry = {.count = 1, .reusable = true}}, SHIFT(150),
-  [23] = {.entry = {.count = 1, .reusable = true}}, SHIFT(84),
-  [25] = {.entry = {.count = 1, .reusable = true}}, SHIFT(11),
-  [27] = {.entry = {.count = 1, .reusable = true}}, SHIFT(168),
-  [29] = {.entry = {.count = 1, .reusable = true}}, SHIFT(55),
-  [31] = {.entry = {.count = 1, .reusable = true}}, SHIFT(95),
-  [33] = {.entry = {.count = 1, .reusable = true}}, SHIFT(3),
-  [35] = {.entry = {.count = 1, .reusable = true}}, SHIFT(67),
-  [37] = {.entry = {.count = 1, .reusable = true}}, SHIFT(4),
-  [39] = {.entry = {.count = 1, .reusable = true}}, SHIFT(141),
-  [41] = {.entry = {.count = 1, .reusable = false}}, SHIFT(108),
-  [43] = {.entry = {.count = 1, .reusable = true}}, SHIFT(159),
-  [45] = {.entry = {.count = 1, .reusable = true}}, SHIFT(35),
-  [47] = {.entry = {.count = 1, .reusable = true}}, SHIFT(91),
-  [49] = {.entry = {.count = 1, .reusable = true}}, SHIFT(15),
-  [51] = {.entry = {.count = 1, .reusable = true}}, SHIFT(149),
-  [53] = {.entry = {.count = 1, .reusable = true}}, SHIFT(154),
-  [55] = {.entry = {.count = 1, .reusable = true}}, SHIFT(13),
-  [57] = {.entry = {.count = 2, .reusable = false}}, REDUCE(aux_sym_element_repeat1, 2), SHIFT_REPEAT(109),
-  [60] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_element_repeat1, 2), SHIFT_REPEAT(176),
-  [63] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_element_repeat1, 2), SHIFT_REPEAT(27),
-  [66] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_element_repeat1, 2), SHIFT_REPEAT(53),
-  [69] = {.entry = {.count = 1, .reusable = true}}, REDUCE(aux_sym_element_repeat1, 2),
-  [71] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_element_repeat1, 2), SHIFT_REPEAT(11),
-  [74] = {.entry = {.count = 1, .reusable = true}}, SHIFT(9),
-  [76] = {.entry = {.count = 1, .reusable = true}}, SHIFT(8),
-  [78] = {.entry = {.count = 2, .reusable = false}}, REDUCE(aux_sym_element_repeat1, 2), SHIFT_REPEAT(108),
-  [81] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_element_repeat1, 2), SHIFT_REPEAT(184),
-  [84] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_element_repeat1, 2), SHIFT_REPEAT(35),
-  [87] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_element_repeat1, 2), SHIFT_REPEAT(91),
-  [90] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_element_repeat1, 2), SHIFT_REPEAT(15),
-  [93] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_component, 1),
-  [95] = {.entry = {.count = 1, .reusable = true}}, SHIFT(17),
-  [97] = {.entry = {.count = 1, .reusable = true}}, REDUCE(aux_sym_component_repeat1, 2),
-  [99] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_component_repeat1, 2), SHIFT_REPEAT(122),
-  [102] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_component_repeat1, 2), SHIFT_REPEAT(17),
-  [105] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_directive_attribute, 1),
-  [107] = {.entry = {.count = 1, .reusable = true}}, SHIFT(110),
-  [109] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_directive_attribute, 1),
-  [111] = {.entry = {.count = 1, .reusable = true}}, SHIFT(105),
-  [113] = {.entry = {.count = 1, .reusable = true}}, SHIFT(164),
-  [115] = {.entry = {.count = 1, .reusable = true}}, SHIFT(114),
-  [117] = {.entry = {.count = 1, .reusable = true}}, SHIFT(113),
-  [119] = {.entry = {.count = 1, .reusable = true}}, SHIFT(151),
-  [121] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_directive_attribute, 2),
-  [123] = {.entry = {.count = 1, .reusable = true}}, SHIFT(119),
-  [125] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_directive_attribute, 2),
-  [127] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_directive_attribute, 3),
-  [129] = {.entry = {.count = 1, .reusable = true}}, SHIFT(120),
-  [131] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_directive_attribute, 3),
-  [133] = {.entry = {.count = 1, .reusable = true}}, SHIFT(75),
-  [135] = {.entry = {.count = 1, .reusable = true}}, SHIFT(85),
-  [137] = {.entry = {.count = 1, .reusable = false}}, SHIFT(72),
-  [139] = {.entry = {.count = 1, .reusable = true}}, SHIFT(18),
-  [141] = {.entry = {.count = 1, .reusable = true}}, SHIFT(126),
-  [143] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_directive_modifiers, 1),
-  [145] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_directive_modifiers, 1),
-  [147] = {.entry = {.count = 1, .reusable = true}}, SHIFT(112),
-  [149] = {.entry = {.count = 1, .reusable = true}}, REDUCE(aux_sym_directive_modifiers_repeat1, 2),
-  [151] = {.entry = {.count = 1, .reusable = false}}, REDUCE(aux_sym_directive_modifiers_repeat1, 2),
-  [153] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_directive_modifiers_repeat1, 2), SHIFT_REPEAT(164),
-  [156] = {.entry = {.count = 1, .reusable = true}}, SHIFT(57),
-  [158] = {.entry = {.count = 1, .reusable = true}}, SHIFT(56),
-  [160] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_text, 1),
-  [162] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_text, 1),
-  [164] = {.entry = {.count = 1, .reusable = true}}, SHIFT(58),
-  [166] = {.entry = {.count = 1, .reusable = true}}, SHIFT(174),
-  [168] = {.entry = {.count = 1, .reusable = true}}, SHIFT(60),
-  [170] = {.entry = {.count = 1, .reusable = true}}, SHIFT(140),
-  [172] = {.entry = {.count = 1, .reusable = true}}, SHIFT(76),
-  [174] = {.entry = {.count = 1, .reusable = true}}, SHIFT(111),
-  [176] = {.entry = {.count = 1, .reusable = true}}, SHIFT(135),
-  [178] = {.entry = {.count = 1, .reusable = true}}, REDUCE(aux_sym_start_tag_repeat1, 2),
-  [180] = {.entry = {.count = 2, .reusable = false}}, REDUCE(aux_sym_start_tag_repeat1, 2), SHIFT_REPEAT(72),
-  [183] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_start_tag_repeat1, 2), SHIFT_REPEAT(18),
-  [186] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_start_tag_repeat1, 2), SHIFT_REPEAT(126),
-  [189] = {.entry = {.count = 1, .reusable = true}}, SHIFT(99),
-  [191] = {.entry = {.count = 1, .reusable = false}}, SHIFT(98),
-  [193] = {.entry = {.count = 1, .reusable = true}}, SHIFT(19),
-  [195] = {.entry = {.count = 1, .reusable = true}}, SHIFT(118),
-  [197] = {.entry = {.count = 1, .reusable = true}}, SHIFT(100),
-  [199] = {.entry = {.count = 1, .reusable = true}}, SHIFT(181),
-  [201] = {.entry = {.count = 1, .reusable = true}}, SHIFT(161),
-  [203] = {.entry = {.count = 1, .reusable = true}}, SHIFT(165),
-  [205] = {.entry = {.count = 1, .reusable = true}}, SHIFT(155),
-  [207] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_directive_modifiers_repeat1, 2), SHIFT_REPEAT(151),
-  [210] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_directive_dynamic_argument, 2),
-  [212] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_directive_dynamic_argument, 2),
-  [214] = {.entry = {.count = 2, .reusable = false}}, REDUCE(aux_sym_start_tag_repeat1, 2), SHIFT_REPEAT(98),
-  [217] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_start_tag_repeat1, 2), SHIFT_REPEAT(19),
-  [220] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_start_tag_repeat1, 2), SHIFT_REPEAT(118),
-  [223] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_directive_dynamic_argument, 3),
-  [225] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_directive_dynamic_argument, 3),
-  [227] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_directive_argument, 1),
-  [229] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_directive_argument, 1),
-  [231] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_directive_modifier, 1),
-  [233] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_directive_modifier, 1),
-  [235] = {.entry = {.count = 1, .reusable = true}}, SHIFT(153),
-  [237] = {.entry = {.count = 1, .reusable = true}}, SHIFT(102),
-  [239] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_style_element, 3),
-  [241] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_style_element, 3),
-  [243] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_template_element, 3),
-  [245] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_template_element, 3),
-  [247] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_script_element, 3),
-  [249] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_script_element, 3),
-  [251] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_element, 3),
-  [253] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_element, 3),
-  [255] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_self_closing_tag, 4),
-  [257] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_self_closing_tag, 4),
-  [259] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_start_tag, 4),
-  [261] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_start_tag, 4),
-  [263] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_interpolation, 2),
-  [265] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_interpolation, 2),
-  [267] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_end_tag, 3),
-  [269] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_end_tag, 3),
-  [271] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_self_closing_tag, 3),
-  [273] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_self_closing_tag, 3),
-  [275] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_style_element, 2),
-  [277] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_style_element, 2),
-  [279] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_script_element, 2),
-  [281] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_script_element, 2),
-  [283] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_template_element, 2),
-  [285] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_template_element, 2),
-  [287] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_erroneous_end_tag, 3),
-  [289] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_erroneous_end_tag, 3),
-  [291] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_interpolation, 3),
-  [293] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_interpolation, 3),
-  [295] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_element, 2),
-  [297] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_element, 2),
-  [299] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_element, 1),
-  [301] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_element, 1),
-  [303] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_attribute, 1),
-  [305] = {.entry = {.count = 1, .reusable = true}}, SHIFT(107),
-  [307] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_attribute, 1),
-  [309] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_directive_attribute, 4),
-  [311] = {.entry = {.count = 1, .reusable = true}}, SHIFT(121),
-  [313] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_directive_attribute, 4),
-  [315] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_start_tag, 3),
-  [317] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_start_tag, 3),
-  [319] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_quoted_attribute_value, 2),
-  [321] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_quoted_attribute_value, 2),
-  [323] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_quoted_attribute_value, 3),
-  [325] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_quoted_attribute_value, 3),
-  [327] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_directive_attribute, 5),
-  [329] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_directive_attribute, 5),
-  [331] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_directive_attribute, 6),
-  [333] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_directive_attribute, 6),
-  [335] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_attribute, 3),
-  [337] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_attribute, 3),
-  [339] = {.entry = {.count = 1, .reusable = true}}, SHIFT(106),
-  [341] = {.entry = {.count = 1, .reusable = true}}, SHIFT(117),
+  [5] = {.entry = {.count = 1, .reusable = true}}, SHIFT(123),
+  [7] = {.entry = {.count = 1, .reusable = true}}, SHIFT(75),
+  [9] = {.entry = {.count = 1, .reusable = false}}, SHIFT(119),
+  [11] = {.entry = {.count = 1, .reusable = true}}, SHIFT(158),
+  [13] = {.entry = {.count = 1, .reusable = true}}, SHIFT(76),
+  [15] = {.entry = {.count = 1, .reusable = true}}, SHIFT(82),
+  [17] = {.entry = {.count = 1, .reusable = true}}, SHIFT(84),
+  [19] = {.entry = {.count = 1, .reusable = true}}, SHIFT(80),
+  [21] = {.entry = {.count = 1, .reusable = true}}, SHIFT(173),
+  [23] = {.entry = {.count = 1, .reusable = true}}, SHIFT(143),
+  [25] = {.entry = {.count = 1, .reusable = true}}, SHIFT(133),
+  [27] = {.entry = {.count = 1, .reusable = true}}, SHIFT(93),
+  [29] = {.entry = {.count = 1, .reusable = true}}, SHIFT(156),
+  [31] = {.entry = {.count = 1, .reusable = true}}, SHIFT(105),
+  [33] = {.entry = {.count = 1, .reusable = true}}, SHIFT(110),
+  [35] = {.entry = {.count = 1, .reusable = false}}, SHIFT(118),
+  [37] = {.entry = {.count = 1, .reusable = true}}, SHIFT(152),
+  [39] = {.entry = {.count = 1, .reusable = true}}, SHIFT(77),
+  [41] = {.entry = {.count = 1, .reusable = true}}, SHIFT(113),
+  [43] = {.entry = {.count = 1, .reusable = true}}, SHIFT(99),
+  [45] = {.entry = {.count = 2, .reusable = false}}, REDUCE(aux_sym_element_repeat1, 2), SHIFT_REPEAT(119),
+  [48] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_element_repeat1, 2), SHIFT_REPEAT(176),
+  [51] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_element_repeat1, 2), SHIFT_REPEAT(76),
+  [54] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_element_repeat1, 2), SHIFT_REPEAT(82),
+  [57] = {.entry = {.count = 1, .reusable = true}}, REDUCE(aux_sym_element_repeat1, 2),
+  [59] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_element_repeat1, 2), SHIFT_REPEAT(80),
+  [62] = {.entry = {.count = 1, .reusable = false}}, SHIFT(12),
+  [64] = {.entry = {.count = 1, .reusable = true}}, SHIFT(88),
+  [66] = {.entry = {.count = 1, .reusable = true}}, SHIFT(146),
+  [68] = {.entry = {.count = 1, .reusable = false}}, SHIFT(53),
+  [70] = {.entry = {.count = 1, .reusable = true}}, SHIFT(129),
+  [72] = {.entry = {.count = 1, .reusable = true}}, SHIFT(91),
+  [74] = {.entry = {.count = 1, .reusable = true}}, SHIFT(145),
+  [76] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_directive_attribute, 1),
+  [78] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_directive_attribute, 1),
+  [80] = {.entry = {.count = 1, .reusable = true}}, SHIFT(121),
+  [82] = {.entry = {.count = 1, .reusable = true}}, SHIFT(120),
+  [84] = {.entry = {.count = 1, .reusable = true}}, SHIFT(159),
+  [86] = {.entry = {.count = 2, .reusable = false}}, REDUCE(aux_sym_start_tag_repeat1, 2), SHIFT_REPEAT(12),
+  [89] = {.entry = {.count = 1, .reusable = true}}, REDUCE(aux_sym_start_tag_repeat1, 2),
+  [91] = {.entry = {.count = 2, .reusable = false}}, REDUCE(aux_sym_start_tag_repeat1, 2), SHIFT_REPEAT(53),
+  [94] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_start_tag_repeat1, 2), SHIFT_REPEAT(129),
+  [97] = {.entry = {.count = 1, .reusable = true}}, SHIFT(101),
+  [99] = {.entry = {.count = 1, .reusable = true}}, SHIFT(162),
+  [101] = {.entry = {.count = 1, .reusable = true}}, SHIFT(106),
+  [103] = {.entry = {.count = 1, .reusable = true}}, SHIFT(89),
+  [105] = {.entry = {.count = 1, .reusable = true}}, SHIFT(157),
+  [107] = {.entry = {.count = 1, .reusable = true}}, SHIFT(90),
+  [109] = {.entry = {.count = 2, .reusable = false}}, REDUCE(aux_sym_element_repeat1, 2), SHIFT_REPEAT(118),
+  [112] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_element_repeat1, 2), SHIFT_REPEAT(185),
+  [115] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_element_repeat1, 2), SHIFT_REPEAT(77),
+  [118] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_element_repeat1, 2), SHIFT_REPEAT(113),
+  [121] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_element_repeat1, 2), SHIFT_REPEAT(99),
+  [124] = {.entry = {.count = 1, .reusable = true}}, SHIFT(126),
+  [126] = {.entry = {.count = 1, .reusable = true}}, SHIFT(130),
+  [128] = {.entry = {.count = 1, .reusable = true}}, SHIFT(164),
+  [130] = {.entry = {.count = 1, .reusable = false}}, SHIFT(24),
+  [132] = {.entry = {.count = 1, .reusable = true}}, SHIFT(174),
+  [134] = {.entry = {.count = 1, .reusable = false}}, SHIFT(54),
+  [136] = {.entry = {.count = 1, .reusable = true}}, SHIFT(128),
+  [138] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_directive_attribute, 3),
+  [140] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_directive_attribute, 3),
+  [142] = {.entry = {.count = 1, .reusable = true}}, SHIFT(132),
+  [144] = {.entry = {.count = 2, .reusable = false}}, REDUCE(aux_sym_start_tag_repeat1, 2), SHIFT_REPEAT(24),
+  [147] = {.entry = {.count = 2, .reusable = false}}, REDUCE(aux_sym_start_tag_repeat1, 2), SHIFT_REPEAT(54),
+  [150] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_start_tag_repeat1, 2), SHIFT_REPEAT(128),
+  [153] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_directive_attribute, 2),
+  [155] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_directive_attribute, 2),
+  [157] = {.entry = {.count = 1, .reusable = true}}, SHIFT(117),
+  [159] = {.entry = {.count = 1, .reusable = true}}, SHIFT(170),
+  [161] = {.entry = {.count = 1, .reusable = true}}, SHIFT(171),
+  [163] = {.entry = {.count = 1, .reusable = true}}, SHIFT(112),
+  [165] = {.entry = {.count = 1, .reusable = true}}, SHIFT(115),
+  [167] = {.entry = {.count = 1, .reusable = true}}, SHIFT(168),
+  [169] = {.entry = {.count = 1, .reusable = true}}, SHIFT(125),
+  [171] = {.entry = {.count = 1, .reusable = false}}, REDUCE(aux_sym_directive_modifiers_repeat1, 2),
+  [173] = {.entry = {.count = 1, .reusable = true}}, REDUCE(aux_sym_directive_modifiers_repeat1, 2),
+  [175] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_directive_modifiers_repeat1, 2), SHIFT_REPEAT(159),
+  [178] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_directive_modifiers, 1),
+  [180] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_directive_modifiers, 1),
+  [182] = {.entry = {.count = 1, .reusable = true}}, SHIFT(124),
+  [184] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_directive_dynamic_argument, 2),
+  [186] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_directive_dynamic_argument, 2),
+  [188] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_directive_modifier, 1),
+  [190] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_directive_modifier, 1),
+  [192] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_directive_modifiers_repeat1, 2), SHIFT_REPEAT(164),
+  [195] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_directive_dynamic_argument, 3),
+  [197] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_directive_dynamic_argument, 3),
+  [199] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_directive_argument, 1),
+  [201] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_directive_argument, 1),
+  [203] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_directive_attribute, 4),
+  [205] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_directive_attribute, 4),
+  [207] = {.entry = {.count = 1, .reusable = true}}, SHIFT(131),
+  [209] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_attribute, 1),
+  [211] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_attribute, 1),
+  [213] = {.entry = {.count = 1, .reusable = true}}, SHIFT(116),
+  [215] = {.entry = {.count = 1, .reusable = true}}, SHIFT(127),
+  [217] = {.entry = {.count = 1, .reusable = true}}, SHIFT(122),
+  [219] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_directive_attribute, 6),
+  [221] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_directive_attribute, 6),
+  [223] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_quoted_attribute_value, 2),
+  [225] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_quoted_attribute_value, 2),
+  [227] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_directive_attribute, 5),
+  [229] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_directive_attribute, 5),
+  [231] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_quoted_attribute_value, 3),
+  [233] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_quoted_attribute_value, 3),
+  [235] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_attribute, 3),
+  [237] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_attribute, 3),
+  [239] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym__attribute, 1),
+  [241] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym__attribute, 1),
+  [243] = {.entry = {.count = 1, .reusable = true}}, REDUCE(aux_sym_component_repeat1, 2),
+  [245] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_component_repeat1, 2), SHIFT_REPEAT(123),
+  [248] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_component_repeat1, 2), SHIFT_REPEAT(74),
+  [251] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_component, 1),
+  [253] = {.entry = {.count = 1, .reusable = true}}, SHIFT(74),
+  [255] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_text, 1),
+  [257] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_text, 1),
+  [259] = {.entry = {.count = 1, .reusable = true}}, SHIFT(85),
+  [261] = {.entry = {.count = 1, .reusable = true}}, SHIFT(175),
+  [263] = {.entry = {.count = 1, .reusable = true}}, SHIFT(104),
+  [265] = {.entry = {.count = 1, .reusable = true}}, SHIFT(188),
+  [267] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_interpolation, 3),
+  [269] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_interpolation, 3),
+  [271] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_template_element, 3),
+  [273] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_template_element, 3),
+  [275] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym__node, 1),
+  [277] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym__node, 1),
+  [279] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_style_element, 2),
+  [281] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_style_element, 2),
+  [283] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_script_element, 3),
+  [285] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_script_element, 3),
+  [287] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_element, 3),
+  [289] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_element, 3),
+  [291] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_interpolation, 2),
+  [293] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_interpolation, 2),
+  [295] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_style_element, 3),
+  [297] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_style_element, 3),
+  [299] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_erroneous_end_tag, 3),
+  [301] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_erroneous_end_tag, 3),
+  [303] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_start_tag, 3),
+  [305] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_start_tag, 3),
+  [307] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_self_closing_tag, 4),
+  [309] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_self_closing_tag, 4),
+  [311] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_self_closing_tag, 3),
+  [313] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_self_closing_tag, 3),
+  [315] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_start_tag, 4),
+  [317] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_start_tag, 4),
+  [319] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_element, 1),
+  [321] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_element, 1),
+  [323] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_element, 2),
+  [325] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_element, 2),
+  [327] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_end_tag, 3),
+  [329] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_end_tag, 3),
+  [331] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_template_element, 2),
+  [333] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_template_element, 2),
+  [335] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_script_element, 2),
+  [337] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_script_element, 2),
+  [339] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_template_start_tag, 3),
+  [341] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_template_start_tag, 3),
   [343] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_template_start_tag, 4),
   [345] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_template_start_tag, 4),
-  [347] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_template_start_tag, 3),
-  [349] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_template_start_tag, 3),
-  [351] = {.entry = {.count = 1, .reusable = false}}, SHIFT(43),
-  [353] = {.entry = {.count = 1, .reusable = true}}, SHIFT(162),
-  [355] = {.entry = {.count = 1, .reusable = true}}, SHIFT(124),
-  [357] = {.entry = {.count = 1, .reusable = true}}, SHIFT(147),
-  [359] = {.entry = {.count = 1, .reusable = true}}, SHIFT(163),
-  [361] = {.entry = {.count = 1, .reusable = true}}, SHIFT(93),
-  [363] = {.entry = {.count = 1, .reusable = true}}, SHIFT(157),
-  [365] = {.entry = {.count = 1, .reusable = true}}, SHIFT(158),
-  [367] = {.entry = {.count = 1, .reusable = true}}, SHIFT(22),
-  [369] = {.entry = {.count = 1, .reusable = true}}, SHIFT(48),
-  [371] = {.entry = {.count = 1, .reusable = true}}, SHIFT(37),
-  [373] = {.entry = {.count = 1, .reusable = true}}, SHIFT(46),
-  [375] = {.entry = {.count = 1, .reusable = true}}, SHIFT(28),
-  [377] = {.entry = {.count = 1, .reusable = true}}, SHIFT(79),
-  [379] = {.entry = {.count = 1, .reusable = true}}, SHIFT(128),
-  [381] = {.entry = {.count = 1, .reusable = true}}, SHIFT(125),
-  [383] = {.entry = {.count = 1, .reusable = false}}, SHIFT(54),
-  [385] = {.entry = {.count = 1, .reusable = true}}, SHIFT(152),
-  [387] = {.entry = {.count = 1, .reusable = true}}, SHIFT(116),
-  [389] = {.entry = {.count = 1, .reusable = true}}, SHIFT(115),
-  [391] = {.entry = {.count = 1, .reusable = true}}, SHIFT(86),
-  [393] = {.entry = {.count = 1, .reusable = true}}, SHIFT(88),
-  [395] = {.entry = {.count = 1, .reusable = true}}, SHIFT(90),
-  [397] = {.entry = {.count = 1, .reusable = true}}, SHIFT(29),
-  [399] = {.entry = {.count = 1, .reusable = true}}, SHIFT(188),
-  [401] = {.entry = {.count = 1, .reusable = true}}, SHIFT(148),
-  [403] = {.entry = {.count = 1, .reusable = true}}, SHIFT(169),
-  [405] = {.entry = {.count = 1, .reusable = true}}, SHIFT(186),
-  [407] = {.entry = {.count = 1, .reusable = true}}, SHIFT(156),
-  [409] = {.entry = {.count = 1, .reusable = true}}, SHIFT(160),
-  [411] = {.entry = {.count = 1, .reusable = true}}, SHIFT(183),
-  [413] = {.entry = {.count = 1, .reusable = true}}, SHIFT(166),
-  [415] = {.entry = {.count = 1, .reusable = true}}, SHIFT(167),
-  [417] = {.entry = {.count = 1, .reusable = false}}, SHIFT(123),
+  [347] = {.entry = {.count = 1, .reusable = true}}, SHIFT(61),
+  [349] = {.entry = {.count = 1, .reusable = true}}, SHIFT(161),
+  [351] = {.entry = {.count = 1, .reusable = true}}, SHIFT(169),
+  [353] = {.entry = {.count = 1, .reusable = true}}, SHIFT(65),
+  [355] = {.entry = {.count = 1, .reusable = true}}, SHIFT(16),
+  [357] = {.entry = {.count = 1, .reusable = true}}, SHIFT(31),
+  [359] = {.entry = {.count = 1, .reusable = true}}, SHIFT(30),
+  [361] = {.entry = {.count = 1, .reusable = true}}, SHIFT(29),
+  [363] = {.entry = {.count = 1, .reusable = true}}, SHIFT(19),
+  [365] = {.entry = {.count = 1, .reusable = false}}, SHIFT(44),
+  [367] = {.entry = {.count = 1, .reusable = true}}, SHIFT(151),
+  [369] = {.entry = {.count = 1, .reusable = true}}, SHIFT(58),
+  [371] = {.entry = {.count = 1, .reusable = true}}, SHIFT(70),
+  [373] = {.entry = {.count = 1, .reusable = true}}, SHIFT(166),
+  [375] = {.entry = {.count = 1, .reusable = true}}, SHIFT(167),
+  [377] = {.entry = {.count = 1, .reusable = true}}, SHIFT(10),
+  [379] = {.entry = {.count = 1, .reusable = true}}, SHIFT(67),
+  [381] = {.entry = {.count = 1, .reusable = true}}, SHIFT(72),
+  [383] = {.entry = {.count = 1, .reusable = true}}, SHIFT(66),
+  [385] = {.entry = {.count = 1, .reusable = true}}, SHIFT(69),
+  [387] = {.entry = {.count = 1, .reusable = false}}, SHIFT(50),
+  [389] = {.entry = {.count = 1, .reusable = true}}, SHIFT(160),
+  [391] = {.entry = {.count = 1, .reusable = true}}, SHIFT(56),
+  [393] = {.entry = {.count = 1, .reusable = true}}, SHIFT(59),
+  [395] = {.entry = {.count = 1, .reusable = true}}, SHIFT(177),
+  [397] = {.entry = {.count = 1, .reusable = true}}, SHIFT(172),
+  [399] = {.entry = {.count = 1, .reusable = true}}, SHIFT(153),
+  [401] = {.entry = {.count = 1, .reusable = true}}, SHIFT(190),
+  [403] = {.entry = {.count = 1, .reusable = true}}, SHIFT(165),
+  [405] = {.entry = {.count = 1, .reusable = true}}, SHIFT(163),
+  [407] = {.entry = {.count = 1, .reusable = true}}, SHIFT(187),
+  [409] = {.entry = {.count = 1, .reusable = true}}, SHIFT(154),
+  [411] = {.entry = {.count = 1, .reusable = true}}, SHIFT(155),
+  [413] = {.entry = {.count = 1, .reusable = true}}, SHIFT(38),
+  [415] = {.entry = {.count = 1, .reusable = true}}, SHIFT(186),
+  [417] = {.entry = {.count = 1, .reusable = true}}, SHIFT(180),
   [419] = {.entry = {.count = 1, .reusable = true}}, SHIFT(189),
-  [421] = {.entry = {.count = 1, .reusable = true}}, SHIFT(180),
-  [423] = {.entry = {.count = 1, .reusable = true}}, SHIFT(182),
-  [425] = {.entry = {.count = 1, .reusable = true}}, SHIFT(178),
-  [427] = {.entry = {.count = 1, .reusable = true}}, SHIFT(66),
-  [429] = {.entry = {.count = 1, .reusable = true}}, SHIFT(71),
-  [431] = {.entry = {.count = 1, .reusable = true}}, SHIFT(173),
-  [433] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_style_start_tag, 3),
-  [435] = {.entry = {.count = 1, .reusable = true}}, SHIFT(187),
-  [437] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_style_start_tag, 4),
-  [439] = {.entry = {.count = 1, .reusable = false}}, SHIFT(82),
-  [441] = {.entry = {.count = 1, .reusable = true}}, SHIFT(171),
-  [443] = {.entry = {.count = 1, .reusable = true}}, SHIFT(172),
-  [445] = {.entry = {.count = 1, .reusable = true}}, SHIFT(185),
-  [447] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_script_start_tag, 4),
-  [449] = {.entry = {.count = 1, .reusable = true}}, SHIFT(40),
-  [451] = {.entry = {.count = 1, .reusable = true}}, SHIFT(177),
-  [453] = {.entry = {.count = 1, .reusable = true}}, SHIFT(175),
-  [455] = {.entry = {.count = 1, .reusable = true}}, SHIFT(44),
-  [457] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_script_start_tag, 3),
+  [421] = {.entry = {.count = 1, .reusable = true}}, SHIFT(184),
+  [423] = {.entry = {.count = 1, .reusable = true}}, SHIFT(179),
+  [425] = {.entry = {.count = 1, .reusable = true}}, SHIFT(191),
+  [427] = {.entry = {.count = 1, .reusable = true}}, SHIFT(40),
+  [429] = {.entry = {.count = 1, .reusable = true}}, SHIFT(52),
+  [431] = {.entry = {.count = 1, .reusable = true}}, SHIFT(182),
+  [433] = {.entry = {.count = 1, .reusable = false}}, SHIFT(57),
+  [435] = {.entry = {.count = 1, .reusable = true}}, SHIFT(192),
+  [437] = {.entry = {.count = 1, .reusable = true}}, SHIFT(49),
+  [439] = {.entry = {.count = 1, .reusable = false}}, SHIFT(71),
+  [441] = {.entry = {.count = 1, .reusable = true}}, SHIFT(181),
+  [443] = {.entry = {.count = 1, .reusable = true}}, SHIFT(178),
+  [445] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_style_start_tag, 4),
+  [447] = {.entry = {.count = 1, .reusable = true}}, SHIFT(193),
+  [449] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_style_start_tag, 3),
+  [451] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_script_start_tag, 3),
+  [453] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_script_start_tag, 4),
+  [455] = {.entry = {.count = 1, .reusable = true}}, SHIFT(78),
+  [457] = {.entry = {.count = 1, .reusable = true}}, SHIFT(68),
   [459] = {.entry = {.count = 1, .reusable = true}}, SHIFT(87),
-  [461] = {.entry = {.count = 1, .reusable = true}}, SHIFT(73),
-  [463] = {.entry = {.count = 1, .reusable = true}}, SHIFT(65),
-  [465] = {.entry = {.count = 1, .reusable = true}}, SHIFT(127),
-  [467] = {.entry = {.count = 1, .reusable = true}}, SHIFT(42),
-  [469] = {.entry = {.count = 1, .reusable = true}}, SHIFT(64),
-  [471] = {.entry = {.count = 1, .reusable = true}},  ACCEPT_INPUT(),
-  [473] = {.entry = {.count = 1, .reusable = true}}, SHIFT(78),
-  [475] = {.entry = {.count = 1, .reusable = true}}, SHIFT(103),
-  [477] = {.entry = {.count = 1, .reusable = true}}, SHIFT(104),
-  [479] = {.entry = {.count = 1, .reusable = true}}, SHIFT(59),
-  [481] = {.entry = {.count = 1, .reusable = true}}, SHIFT(132),
+  [461] = {.entry = {.count = 1, .reusable = true}}, SHIFT(139),
+  [463] = {.entry = {.count = 1, .reusable = true}}, SHIFT(46),
+  [465] = {.entry = {.count = 1, .reusable = true}},  ACCEPT_INPUT(),
+  [467] = {.entry = {.count = 1, .reusable = true}}, SHIFT(100),
+  [469] = {.entry = {.count = 1, .reusable = true}}, SHIFT(42),
+  [471] = {.entry = {.count = 1, .reusable = true}}, SHIFT(114),
+  [473] = {.entry = {.count = 1, .reusable = true}}, SHIFT(98),
+  [475] = {.entry = {.count = 1, .reusable = true}}, SHIFT(94),
+  [477] = {.entry = {.count = 1, .reusable = true}}, SHIFT(60),
 };
 
 #ifdef __cplusplus
@@ -3684,6 +4605,8 @@ extern const TSLanguage *tree_sitter_vue3(void) {
     .alias_sequences = &ts_alias_sequences[0][0],
     .lex_modes = ts_lex_modes,
     .lex_fn = ts_lex,
+    .keyword_lex_fn = ts_lex_keywords,
+    .keyword_capture_token = sym_directive_name,
     .external_scanner = {
       &ts_external_scanner_states[0][0],
       ts_external_scanner_symbol_map,
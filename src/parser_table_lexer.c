@@ -0,0 +1,46 @@
+// The vue3 language from parser.c, lexing ASCII input through the dense
+// transition table in lex_table.h instead of the generated `ts_lex` switch.
+// Compile this file in place of parser.c to select it; tokens are identical.
+
+#include <tree_sitter/parser.h>
+
+// `ts_lex(` in parser.c becomes `ts_lex_goto(`, while the bare `ts_lex` that
+// parser.c stores in `.lex_fn` names the table-driven function below.
+#define ts_lex(lexer, state) ts_lex_goto(lexer, state)
+
+static bool (ts_lex)(TSLexer *lexer, TSStateId state);
+
+#include "parser.c"
+#undef ts_lex
+
+#include "lex_table.h"
+
+static bool ts_lex(TSLexer *lexer, TSStateId state) {
+  bool result = false;
+  for (;;) {
+    if (state >= LEX_TABLE_STATE_COUNT) return result;
+
+    // The lookahead is always 0 at EOF, so `eof` only needs asking then.
+    int32_t lookahead = lexer->lookahead;
+    uint8_t byte_class;
+    if ((uint32_t)lookahead >= 128) {
+      return ts_lex_goto(lexer, state) || result;
+    } else if (lookahead == 0 && lexer->eof(lexer)) {
+      byte_class = LEX_TABLE_EOF_CLASS;
+    } else {
+      byte_class = ts_lex_table_classes[lookahead];
+    }
+
+    TSSymbol token = ts_lex_table_accept[state];
+    if (token != ts_builtin_sym_error) {
+      result = true;
+      lexer->result_symbol = token;
+      lexer->mark_end(lexer);
+    }
+
+    uint16_t action = ts_lex_table_actions[state][byte_class];
+    if (action == 0) return result;
+    lexer->advance(lexer, (action & LEX_TABLE_SKIP) != 0);
+    state = (TSStateId)((action & ~LEX_TABLE_SKIP) - 1);
+  }
+}
@@ -8,26 +8,27 @@
 extern "C" {
 #endif
 
-void *tree_sitter_vue_external_scanner_create() {
+void *tree_sitter_vue3_external_scanner_create() {
   return scanner_new();
 }
 
-void tree_sitter_vue_external_scanner_destroy(void *payload) {
+void tree_sitter_vue3_external_scanner_destroy(void *payload) {
   scanner_free((Scanner *)payload);
 }
 
-unsigned tree_sitter_vue_external_scanner_serialize(void *payload, char *buffer) {
+unsigned tree_sitter_vue3_external_scanner_serialize(void *payload, char *buffer) {
   return scanner_serialize((Scanner *)payload, buffer);
 }
 
-void tree_sitter_vue_external_scanner_deserialize(void *payload, const char *buffer, unsigned length) {
+void tree_sitter_vue3_external_scanner_deserialize(void *payload, const char *buffer, unsigned length) {
   scanner_deserialize((Scanner *)payload, buffer, length);
 }
 
-bool tree_sitter_vue_external_scanner_scan(void *payload, TSLexer *lexer, const bool *valid_symbols) {
+static bool vue_scan(Scanner *scanner, TSLexer *lexer, const bool *valid_symbols) {
   bool is_error_recovery = valid_symbols[START_TAG_NAME] && valid_symbols[RAW_TEXT];
   if (!is_error_recovery) {
     if (lexer->lookahead != '<' && (valid_symbols[TEXT_FRAGMENT] || valid_symbols[INTERPOLATION_TEXT])) {
+      SCANNER_STATS_BRANCH(scanner, TS_VUE3_SCAN_BRANCH_TEXT);
       bool has_text = false;
       for (;; has_text = true) {
         if (lexer->lookahead == 0) {
@@ -58,7 +59,15 @@ bool tree_sitter_vue_external_scanner_scan(void *payload, TSLexer *lexer, const
       }
     }
   }
-  return scanner_scan((Scanner *)payload, lexer, valid_symbols);
+  return scanner_scan(scanner, lexer, valid_symbols);
+}
+
+bool tree_sitter_vue3_external_scanner_scan(void *payload, TSLexer *lexer, const bool *valid_symbols) {
+#ifdef TREE_SITTER_VUE3_SCANNER_STATS
+  return scanner_stats_scan((Scanner *)payload, lexer, valid_symbols, vue_scan);
+#else
+  return vue_scan((Scanner *)payload, lexer, valid_symbols);
+#endif
 }
 
 #ifdef __cplusplus
@@ -0,0 +1,77 @@
+#ifndef TREE_SITTER_VUE3_SCANNER_STATS_H_
+#define TREE_SITTER_VUE3_SCANNER_STATS_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Bit i of a valid_symbols combination is set when external token i (in the
+// order of `externals` in grammar.js) is valid.
+#define TS_VUE3_EXTERNAL_TOKEN_COUNT 12
+#define TS_VUE3_VALID_SYMBOL_COMBINATIONS (1u << TS_VUE3_EXTERNAL_TOKEN_COUNT)
+
+// Bucket 0 counts empty states; bucket i counts sizes in [2^(i-1), 2^i).
+#define TS_VUE3_SERIALIZED_SIZE_BUCKETS 12
+
+typedef enum {
+  TS_VUE3_SCAN_BRANCH_NONE,
+  TS_VUE3_SCAN_BRANCH_TEXT,
+  TS_VUE3_SCAN_BRANCH_RAW_TEXT,
+  TS_VUE3_SCAN_BRANCH_COMMENT,
+  TS_VUE3_SCAN_BRANCH_IMPLICIT_END_TAG,
+  TS_VUE3_SCAN_BRANCH_START_TAG_NAME,
+  TS_VUE3_SCAN_BRANCH_END_TAG_NAME,
+  TS_VUE3_SCAN_BRANCH_SELF_CLOSING_TAG_DELIMITER,
+  TS_VUE3_SCAN_BRANCH_COUNT,
+} TSVue3ScanBranch;
+
+typedef struct {
+  uint64_t calls;
+  uint64_t accepted;
+  uint64_t chars_advanced;
+  // Calls that consumed input and then returned false, so the parser lexes
+  // the same characters again.
+  uint64_t rescans;
+} TSVue3ScanBranchStats;
+
+typedef struct {
+  uint64_t scanners;
+  uint64_t scan_calls;
+  uint64_t valid_symbols[TS_VUE3_VALID_SYMBOL_COMBINATIONS];
+  TSVue3ScanBranchStats branches[TS_VUE3_SCAN_BRANCH_COUNT];
+  uint64_t max_tag_stack_depth;
+  uint64_t serialize_calls;
+  uint64_t serialized_bytes;
+  uint64_t max_serialized_bytes;
+  uint64_t serialized_sizes[TS_VUE3_SERIALIZED_SIZE_BUCKETS];
+  uint64_t deserialize_calls;
+} TSVue3ScannerStats;
+
+// Sums the counters of every scanner created so far, live or destroyed.
+// Counters are only kept when the scanner is compiled with
+// TREE_SITTER_VUE3_SCANNER_STATS; otherwise this returns false. Call it
+// between parses: counters of a scanner that is mid-scan are not synchronized.
+bool tree_sitter_vue3_scanner_stats(TSVue3ScannerStats *stats);
+
+// Zeroes the counters of live scanners and forgets destroyed ones.
+void tree_sitter_vue3_scanner_stats_reset(void);
+
+const char *tree_sitter_vue3_scan_branch_name(TSVue3ScanBranch branch);
+
+// Tag stack entries the scanner has compared while searching its stack for a
+// matching open tag: work that does not show up as lexer advances. Copying
+// the stack in and out of the serialized state is not counted; it happens
+// once per token and is bounded by TREE_SITTER_SERIALIZATION_BUFFER_SIZE.
+// Only defined when the scanner is compiled with
+// TREE_SITTER_VUE3_SCANNER_WORK. Not synchronized, so only meaningful for a
+// single-threaded program.
+extern uint64_t tree_sitter_vue3_scanner_work;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
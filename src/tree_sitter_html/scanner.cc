@@ -6,6 +6,11 @@
 #include <string.h>
 #include <wctype.h>
 #include "tag.h"
+#include "../scanner_stats.h"
+
+#ifdef TREE_SITTER_VUE3_SCANNER_STATS
+#include <pthread.h>
+#endif
 
 enum TokenType {
   TEXT_FRAGMENT,
@@ -22,29 +27,274 @@ enum TokenType {
   COMMENT
 };
 
+// Open custom tags with one name hash. `bottom` is the index of the lowest of
+// them, which stays valid while `count` is nonzero because tags are only
+// popped from the top.
+typedef struct {
+  uint32_t hash;
+  uint32_t count;
+  size_t bottom;
+  bool used;
+} CustomTagCount;
+
+// Besides the tags, the stack counts the open tags of each type and of each
+// custom name, so that tag_stack_contains does not search the whole stack for
+// every stray end tag. `kept` is the smallest size of the stack since
+// tag_stack_keep, so the tags below it have not changed since then.
 typedef struct {
   Tag *data;
   size_t size;
   size_t capacity;
+  size_t kept;
+  uint32_t type_counts[CUSTOM];
+  CustomTagCount *custom_counts;
+  size_t custom_capacity;
+  size_t custom_used;
 } TagStack;
 
+// `state` is the last buffer that the tags were serialized to or deserialized
+// from, and `state_offsets` are where its first `state_serialized_tag_count`
+// tags start, with one more entry for the end of the last. The tags after those
+// are placeholders, unless `state_cut` says that the next one is a custom tag
+// whose name the buffer cuts off. Deserializing a buffer only rebuilds the tags
+// above those it shares with `state`, rather than counting every open tag again
+// for each token.
 typedef struct Scanner {
   TagStack tags;
+  char state[TREE_SITTER_SERIALIZATION_BUFFER_SIZE];
+  unsigned state_length;
+  uint16_t state_offsets[TREE_SITTER_SERIALIZATION_BUFFER_SIZE];
+  unsigned state_serialized_tag_count;
+  bool state_cut;
+#ifdef TREE_SITTER_VUE3_SCANNER_STATS
+  TSVue3ScannerStats stats;
+  TSVue3ScanBranch branch;
+  struct Scanner *stats_prev;
+  struct Scanner *stats_next;
+#endif
 } Scanner;
 
+#ifdef TREE_SITTER_VUE3_SCANNER_STATS
+
+#ifdef _MSC_VER
+#define SCANNER_STATS_THREAD_LOCAL __declspec(thread)
+#else
+#define SCANNER_STATS_THREAD_LOCAL __thread
+#endif
+
+#define SCANNER_STATS_BRANCH(scanner, value) ((scanner)->branch = (value))
+
+static pthread_mutex_t scanner_stats_mutex = PTHREAD_MUTEX_INITIALIZER;
+static Scanner *scanner_stats_live = NULL;
+static TSVue3ScannerStats scanner_stats_retired;
+
+static SCANNER_STATS_THREAD_LOCAL void (*scanner_stats_advance_fn)(TSLexer *, bool);
+static SCANNER_STATS_THREAD_LOCAL uint64_t scanner_stats_advanced;
+
+static void scanner_stats_merge(TSVue3ScannerStats *total, const TSVue3ScannerStats *stats) {
+  total->scanners += stats->scanners;
+  total->scan_calls += stats->scan_calls;
+  for (unsigned i = 0; i < TS_VUE3_VALID_SYMBOL_COMBINATIONS; i++) {
+    total->valid_symbols[i] += stats->valid_symbols[i];
+  }
+  for (unsigned i = 0; i < TS_VUE3_SCAN_BRANCH_COUNT; i++) {
+    total->branches[i].calls += stats->branches[i].calls;
+    total->branches[i].accepted += stats->branches[i].accepted;
+    total->branches[i].chars_advanced += stats->branches[i].chars_advanced;
+    total->branches[i].rescans += stats->branches[i].rescans;
+  }
+  if (stats->max_tag_stack_depth > total->max_tag_stack_depth) {
+    total->max_tag_stack_depth = stats->max_tag_stack_depth;
+  }
+  total->serialize_calls += stats->serialize_calls;
+  total->serialized_bytes += stats->serialized_bytes;
+  if (stats->max_serialized_bytes > total->max_serialized_bytes) {
+    total->max_serialized_bytes = stats->max_serialized_bytes;
+  }
+  for (unsigned i = 0; i < TS_VUE3_SERIALIZED_SIZE_BUCKETS; i++) {
+    total->serialized_sizes[i] += stats->serialized_sizes[i];
+  }
+  total->deserialize_calls += stats->deserialize_calls;
+}
+
+static void scanner_stats_register(Scanner *scanner) {
+  scanner->stats.scanners = 1;
+  pthread_mutex_lock(&scanner_stats_mutex);
+  scanner->stats_next = scanner_stats_live;
+  if (scanner_stats_live) scanner_stats_live->stats_prev = scanner;
+  scanner_stats_live = scanner;
+  pthread_mutex_unlock(&scanner_stats_mutex);
+}
+
+static void scanner_stats_retire(Scanner *scanner) {
+  pthread_mutex_lock(&scanner_stats_mutex);
+  scanner_stats_merge(&scanner_stats_retired, &scanner->stats);
+  if (scanner->stats_prev) scanner->stats_prev->stats_next = scanner->stats_next;
+  if (scanner->stats_next) scanner->stats_next->stats_prev = scanner->stats_prev;
+  if (scanner_stats_live == scanner) scanner_stats_live = scanner->stats_next;
+  pthread_mutex_unlock(&scanner_stats_mutex);
+}
+
+static void scanner_stats_tag_depth(Scanner *scanner) {
+  if (scanner->tags.size > scanner->stats.max_tag_stack_depth) {
+    scanner->stats.max_tag_stack_depth = scanner->tags.size;
+  }
+}
+
+static void scanner_stats_serialized(Scanner *scanner, unsigned length) {
+  unsigned bucket = 0;
+  while (bucket + 1 < TS_VUE3_SERIALIZED_SIZE_BUCKETS && (length >> bucket) != 0) {
+    bucket++;
+  }
+  scanner->stats.serialize_calls++;
+  scanner->stats.serialized_bytes += length;
+  if (length > scanner->stats.max_serialized_bytes) {
+    scanner->stats.max_serialized_bytes = length;
+  }
+  scanner->stats.serialized_sizes[bucket]++;
+}
+
+static void scanner_stats_advance(TSLexer *lexer, bool skip) {
+  scanner_stats_advanced++;
+  scanner_stats_advance_fn(lexer, skip);
+}
+
+// Runs `scan` with the lexer's advance callback swapped for a counting one
+// and files the call under whichever branch the scan took.
+static bool scanner_stats_scan(
+  Scanner *scanner,
+  TSLexer *lexer,
+  const bool *valid_symbols,
+  bool (*scan)(Scanner *, TSLexer *, const bool *)
+) {
+  unsigned combination = 0;
+  for (unsigned i = 0; i < TS_VUE3_EXTERNAL_TOKEN_COUNT; i++) {
+    if (valid_symbols[i]) combination |= 1u << i;
+  }
+
+  void (*advance)(TSLexer *, bool) = lexer->advance;
+  scanner_stats_advance_fn = advance;
+  scanner_stats_advanced = 0;
+  lexer->advance = scanner_stats_advance;
+  scanner->branch = TS_VUE3_SCAN_BRANCH_NONE;
+
+  bool result = scan(scanner, lexer, valid_symbols);
+
+  lexer->advance = advance;
+  TSVue3ScanBranchStats *branch = &scanner->stats.branches[scanner->branch];
+  scanner->stats.scan_calls++;
+  scanner->stats.valid_symbols[combination]++;
+  branch->calls++;
+  branch->chars_advanced += scanner_stats_advanced;
+  if (result) {
+    branch->accepted++;
+  } else if (scanner_stats_advanced > 0) {
+    branch->rescans++;
+  }
+  scanner_stats_tag_depth(scanner);
+  return result;
+}
+
+#else
+
+#define SCANNER_STATS_BRANCH(scanner, value) ((void)0)
+
+#endif
+
+#ifdef TREE_SITTER_VUE3_SCANNER_WORK
+uint64_t tree_sitter_vue3_scanner_work = 0;
+#define SCANNER_WORK(count) (tree_sitter_vue3_scanner_work += (count))
+#else
+#define SCANNER_WORK(count) ((void)0)
+#endif
+
 static void tag_stack_init(TagStack *stack) {
   if (!stack) return;
-  stack->data = NULL;
-  stack->size = 0;
-  stack->capacity = 0;
+  memset(stack, 0, sizeof(*stack));
 }
 
 static void tag_stack_free(TagStack *stack) {
   if (!stack) return;
   free(stack->data);
-  stack->data = NULL;
+  free(stack->custom_counts);
+  memset(stack, 0, sizeof(*stack));
+}
+
+static uint32_t tag_name_hash(const Tag *tag) {
+  uint32_t hash = 2166136261u;
+  for (unsigned i = 0; i < tag->custom_tag_name_length; i++) {
+    hash = (hash ^ (uint8_t)tag->custom_tag_name[i]) * 16777619u;
+  }
+  return hash;
+}
+
+// Finds the slot for `hash`, or the empty slot where it would go. The table
+// is open addressed with linear probing and at most half full.
+static CustomTagCount *tag_stack_custom_slot(const TagStack *stack, uint32_t hash) {
+  if (!stack->custom_capacity) return NULL;
+  size_t mask = stack->custom_capacity - 1;
+  for (size_t i = hash & mask;; i = (i + 1) & mask) {
+    CustomTagCount *slot = &stack->custom_counts[i];
+    if (!slot->used || slot->hash == hash) return slot;
+  }
+}
+
+static bool tag_stack_grow_custom_counts(TagStack *stack) {
+  size_t old_capacity = stack->custom_capacity;
+  CustomTagCount *old_counts = stack->custom_counts;
+  size_t capacity = old_capacity ? old_capacity * 2 : 16;
+  CustomTagCount *counts = (CustomTagCount *)calloc(capacity, sizeof(CustomTagCount));
+  if (!counts) return false;
+
+  stack->custom_counts = counts;
+  stack->custom_capacity = capacity;
+  for (size_t i = 0; i < old_capacity; i++) {
+    if (old_counts[i].used) *tag_stack_custom_slot(stack, old_counts[i].hash) = old_counts[i];
+  }
+  free(old_counts);
+  return true;
+}
+
+// Counts the tag at `index` as open.
+static bool tag_stack_count(TagStack *stack, size_t index) {
+  const Tag *tag = &stack->data[index];
+  if (tag->type != CUSTOM) {
+    stack->type_counts[tag->type]++;
+    return true;
+  }
+
+  uint32_t hash = tag_name_hash(tag);
+  CustomTagCount *slot = tag_stack_custom_slot(stack, hash);
+  if (!slot || !slot->used) {
+    if (2 * (stack->custom_used + 1) > stack->custom_capacity) {
+      if (!tag_stack_grow_custom_counts(stack)) return false;
+      slot = tag_stack_custom_slot(stack, hash);
+    }
+    slot->hash = hash;
+    slot->used = true;
+    stack->custom_used++;
+  }
+  if (slot->count++ == 0) slot->bottom = index;
+  return true;
+}
+
+// Counts the tag at `index` as closed.
+static void tag_stack_uncount(TagStack *stack, size_t index) {
+  const Tag *tag = &stack->data[index];
+  if (tag->type != CUSTOM) {
+    stack->type_counts[tag->type]--;
+    return;
+  }
+  CustomTagCount *slot = tag_stack_custom_slot(stack, tag_name_hash(tag));
+  if (slot && slot->used && slot->count) slot->count--;
+}
+
+static void tag_stack_clear(TagStack *stack) {
   stack->size = 0;
-  stack->capacity = 0;
+  stack->kept = 0;
+  memset(stack->type_counts, 0, sizeof(stack->type_counts));
+  if (stack->custom_counts) memset(stack->custom_counts, 0, stack->custom_capacity * sizeof(CustomTagCount));
+  stack->custom_used = 0;
 }
 
 static bool tag_stack_reserve(TagStack *stack, size_t capacity) {
@@ -66,27 +316,15 @@ static bool tag_stack_reserve(TagStack *stack, size_t capacity) {
   return true;
 }
 
-static bool tag_stack_resize(TagStack *stack, size_t size) {
-  if (!tag_stack_reserve(stack, size)) {
-    return false;
-  }
-
-  if (size > stack->size) {
-    for (size_t i = stack->size; i < size; i++) {
-      tag_reset(&stack->data[i]);
-    }
-  }
-
-  stack->size = size;
-  return true;
-}
-
 static bool tag_stack_push(TagStack *stack, const Tag *tag) {
   if (!stack || !tag) return false;
   if (!tag_stack_reserve(stack, stack->size + 1)) {
     return false;
   }
   stack->data[stack->size] = *tag;
+  if (!tag_stack_count(stack, stack->size)) {
+    return false;
+  }
   stack->size += 1;
   return true;
 }
@@ -94,6 +332,12 @@ static bool tag_stack_push(TagStack *stack, const Tag *tag) {
 static void tag_stack_pop(TagStack *stack) {
   if (!stack || stack->size == 0) return;
   stack->size -= 1;
+  if (stack->kept > stack->size) stack->kept = stack->size;
+  tag_stack_uncount(stack, stack->size);
+}
+
+static void tag_stack_keep(TagStack *stack, size_t count) {
+  stack->kept = count < stack->size ? count : stack->size;
 }
 
 static Tag *tag_stack_top(TagStack *stack) {
@@ -107,7 +351,18 @@ static bool tag_stack_empty(const TagStack *stack) {
 
 static bool tag_stack_contains(const TagStack *stack, const Tag *tag) {
   if (!stack || !tag) return false;
-  for (size_t i = 0; i < stack->size; i++) {
+  SCANNER_WORK(1);
+  if (tag->type != CUSTOM) {
+    return stack->type_counts[tag->type] > 0;
+  }
+
+  const CustomTagCount *slot = tag_stack_custom_slot(stack, tag_name_hash(tag));
+  if (!slot || !slot->used || slot->count == 0) return false;
+  if (tag_names_equal(&stack->data[slot->bottom], tag)) return true;
+
+  // Another open name has the same hash, so look for this one.
+  for (size_t i = slot->bottom + 1; i < stack->size; i++) {
+    SCANNER_WORK(1);
     if (tag_equals(&stack->data[i], tag)) {
       return true;
     }
@@ -121,11 +376,17 @@ static Scanner *scanner_new(void) {
     return NULL;
   }
   tag_stack_init(&scanner->tags);
+#ifdef TREE_SITTER_VUE3_SCANNER_STATS
+  scanner_stats_register(scanner);
+#endif
   return scanner;
 }
 
 static void scanner_free(Scanner *scanner) {
   if (!scanner) return;
+#ifdef TREE_SITTER_VUE3_SCANNER_STATS
+  scanner_stats_retire(scanner);
+#endif
   tag_stack_free(&scanner->tags);
   free(scanner);
 }
@@ -155,6 +416,7 @@ static unsigned scanner_serialize(Scanner *scanner, char *buffer) {
       if (offset + 2 + name_length >= TREE_SITTER_SERIALIZATION_BUFFER_SIZE) {
         break;
       }
+      scanner->state_offsets[serialized_tag_count] = (uint16_t)offset;
       buffer[offset++] = (char)tag->type;
       buffer[offset++] = (char)name_length;
       memcpy(&buffer[offset], tag->custom_tag_name, name_length);
@@ -163,71 +425,201 @@ static unsigned scanner_serialize(Scanner *scanner, char *buffer) {
       if (offset + 1 >= TREE_SITTER_SERIALIZATION_BUFFER_SIZE) {
         break;
       }
+      scanner->state_offsets[serialized_tag_count] = (uint16_t)offset;
       buffer[offset++] = (char)tag->type;
     }
   }
 
   memcpy(&buffer[0], &serialized_tag_count, sizeof(serialized_tag_count));
+  // Tags past a truncated buffer deserialize to placeholders. The stack only
+  // holds placeholders there if the last buffer had them from the same point.
+  size_t kept = serialized_tag_count;
+  if (
+    scanner->state_length && !scanner->state_cut && scanner->state_serialized_tag_count <= serialized_tag_count &&
+    scanner->tags.kept > kept
+  ) {
+    kept = scanner->tags.kept;
+  }
+  memcpy(scanner->state, buffer, offset);
+  scanner->state_length = offset;
+  scanner->state_offsets[serialized_tag_count] = (uint16_t)offset;
+  scanner->state_serialized_tag_count = serialized_tag_count;
+  scanner->state_cut = false;
+  tag_stack_keep(&scanner->tags, kept);
+#ifdef TREE_SITTER_VUE3_SCANNER_STATS
+  scanner_stats_serialized(scanner, offset);
+#endif
   return offset;
 }
 
-static void scanner_deserialize(Scanner *scanner, const char *buffer, unsigned length) {
-  if (!scanner) return;
-  scanner->tags.size = 0;
-  if (!buffer || length == 0) {
-    return;
+// Decodes the tag at `index` from a buffer written by scanner_serialize, and
+// returns whether the buffer held all of it. Tags that the buffer left out, and
+// every tag after a malformed or cut off one, become placeholders.
+static bool scanner_decode_tag(
+  const char *buffer,
+  unsigned length,
+  unsigned serialized_tag_count,
+  unsigned index,
+  unsigned *offset,
+  bool *truncated,
+  Tag *tag
+) {
+  if (*truncated || index >= serialized_tag_count || *offset >= length) {
+    *truncated = true;
+    tag_reset(tag);
+    return false;
   }
 
-  unsigned offset = 0;
+  tag->type = (TagType)buffer[(*offset)++];
+  if (tag->type > CUSTOM || (tag->type == CUSTOM && *offset >= length)) {
+    *truncated = true;
+    tag_reset(tag);
+    return false;
+  }
+  if (tag->type != CUSTOM) {
+    tag->custom_tag_name_length = 0;
+    tag->custom_tag_name[0] = '\0';
+    return true;
+  }
+
+  uint16_t name_length = (uint8_t)buffer[(*offset)++];
+  if (name_length > TREE_SITTER_HTML_MAX_CUSTOM_TAG_NAME_LENGTH) {
+    name_length = TREE_SITTER_HTML_MAX_CUSTOM_TAG_NAME_LENGTH;
+  }
+  bool complete = (unsigned)name_length <= length - *offset;
+  if (!complete) {
+    *truncated = true;
+    name_length = (uint16_t)(length - *offset);
+  }
+  memcpy(tag->custom_tag_name, &buffer[*offset], name_length);
+  tag->custom_tag_name[name_length] = '\0';
+  tag->custom_tag_name_length = (uint8_t)name_length;
+  *offset += name_length;
+  return complete;
+}
+
+static void scanner_deserialize(Scanner *scanner, const char *buffer, unsigned length) {
+  if (!scanner) return;
+#ifdef TREE_SITTER_VUE3_SCANNER_STATS
+  scanner->stats.deserialize_calls++;
+#endif
   uint16_t serialized_tag_count = 0;
   uint16_t tag_count = 0;
-
-  if (length < sizeof(serialized_tag_count) + sizeof(tag_count)) {
+  if (!buffer || length < sizeof(serialized_tag_count) + sizeof(tag_count)) {
+    tag_stack_clear(&scanner->tags);
+    scanner->state_length = 0;
     return;
   }
 
+  unsigned offset = 0;
   memcpy(&serialized_tag_count, &buffer[offset], sizeof(serialized_tag_count));
   offset += sizeof(serialized_tag_count);
-
   memcpy(&tag_count, &buffer[offset], sizeof(tag_count));
   offset += sizeof(tag_count);
 
-  if (!tag_stack_resize(&scanner->tags, tag_count)) {
-    scanner->tags.size = 0;
+  // Closed custom tags keep their slots until the stack is cleared.
+  if (scanner->tags.custom_used > 2 * (size_t)tag_count + 16) {
+    tag_stack_clear(&scanner->tags);
+  }
+
+  // Find how many bottom tags this buffer shares with the last one. Those
+  // whose bytes match decode the same way, and the stack still holds them up
+  // to the first tag popped since.
+  size_t shared = 0;
+  bool truncated = false;
+  if (scanner->state_length >= offset) {
+    unsigned common = offset;
+    unsigned common_limit = length < scanner->state_length ? length : scanner->state_length;
+    if (memcmp(&buffer[offset], &scanner->state[offset], common_limit - offset) == 0) {
+      common = common_limit;
+    } else {
+      while (buffer[common] == scanner->state[common]) common++;
+    }
+
+    // The number of tags that end within the common bytes.
+    size_t low = 0, high = scanner->state_serialized_tag_count;
+    while (low < high) {
+      size_t mid = (low + high + 1) / 2;
+      if (scanner->state_offsets[mid] <= common) {
+        low = mid;
+      } else {
+        high = mid - 1;
+      }
+    }
+    shared = low < serialized_tag_count ? low : serialized_tag_count;
+
+    // If both buffers end in the same way, only placeholders follow.
+    uint16_t state_serialized_tag_count = 0;
+    uint16_t state_tag_count = 0;
+    memcpy(&state_serialized_tag_count, &scanner->state[0], sizeof(state_serialized_tag_count));
+    memcpy(&state_tag_count, &scanner->state[sizeof(serialized_tag_count)], sizeof(state_tag_count));
+    if (shared == scanner->state_serialized_tag_count && shared < state_tag_count && shared < tag_count) {
+      unsigned next_offset = scanner->state_offsets[shared];
+      unsigned state_offset = next_offset;
+      bool state_truncated = false;
+      Tag tag, state_tag;
+      scanner_decode_tag(buffer, length, serialized_tag_count, (unsigned)shared, &next_offset, &truncated, &tag);
+      scanner_decode_tag(
+        scanner->state, scanner->state_length, state_serialized_tag_count, (unsigned)shared, &state_offset,
+        &state_truncated, &state_tag
+      );
+      if (truncated && state_truncated && tag_equals(&tag, &state_tag)) {
+        shared = tag_count < state_tag_count ? tag_count : state_tag_count;
+      } else {
+        truncated = false;
+      }
+    }
+
+    if (shared > scanner->tags.kept) {
+      shared = scanner->tags.kept;
+    }
+    if (shared <= scanner->state_serialized_tag_count) {
+      truncated = false;
+      offset = scanner->state_offsets[shared];
+    }
+  }
+
+  while (scanner->tags.size > shared) {
+    tag_stack_pop(&scanner->tags);
+  }
+  if (!tag_stack_reserve(&scanner->tags, tag_count)) {
+    tag_stack_clear(&scanner->tags);
+    scanner->state_length = 0;
     return;
   }
 
-  for (unsigned j = 0; j < serialized_tag_count && j < scanner->tags.size; j++) {
-    if (offset >= length) {
-      break;
+  bool cached = length <= sizeof(scanner->state);
+  unsigned state_serialized_tag_count = truncated ? scanner->state_serialized_tag_count : (unsigned)shared;
+  bool state_cut = truncated && scanner->state_cut;
+  if (cached && !truncated) scanner->state_offsets[shared] = (uint16_t)offset;
+  for (unsigned j = (unsigned)shared; j < tag_count; j++) {
+    bool was_truncated = truncated;
+    bool complete =
+      scanner_decode_tag(buffer, length, serialized_tag_count, j, &offset, &truncated, &scanner->tags.data[j]);
+    if (cached && complete) {
+      state_serialized_tag_count = j + 1;
+      scanner->state_offsets[j + 1] = (uint16_t)offset;
     }
-    Tag *tag = &scanner->tags.data[j];
-    tag->type = (TagType)buffer[offset++];
-    if (tag->type == CUSTOM) {
-      if (offset >= length) {
-        tag_reset(tag);
-        break;
-      }
-      uint16_t name_length = (uint8_t)buffer[offset++];
-      if (name_length > TREE_SITTER_HTML_MAX_CUSTOM_TAG_NAME_LENGTH) {
-        name_length = TREE_SITTER_HTML_MAX_CUSTOM_TAG_NAME_LENGTH;
-      }
-      if ((unsigned)name_length > length - offset) {
-        name_length = (uint16_t)(length - offset);
-      }
-      memcpy(tag->custom_tag_name, &buffer[offset], name_length);
-      tag->custom_tag_name[name_length] = '\0';
-      tag->custom_tag_name_length = (uint8_t)name_length;
-      offset += name_length;
-    } else {
-      tag->custom_tag_name_length = 0;
-      tag->custom_tag_name[0] = '\0';
+    if (!complete && !was_truncated) {
+      state_cut = scanner->tags.data[j].type == CUSTOM;
     }
+    if (!tag_stack_count(&scanner->tags, j)) {
+      tag_stack_clear(&scanner->tags);
+      scanner->state_length = 0;
+      return;
+    }
+    scanner->tags.size = j + 1;
   }
 
-  for (size_t j = serialized_tag_count; j < scanner->tags.size; j++) {
-    tag_reset(&scanner->tags.data[j]);
+  if (!cached) {
+    scanner->state_length = 0;
+    return;
   }
+  memcpy(scanner->state, buffer, length);
+  scanner->state_length = length;
+  scanner->state_serialized_tag_count = state_serialized_tag_count;
+  scanner->state_cut = state_cut;
+  tag_stack_keep(&scanner->tags, tag_count);
 }
 
 static bool scan_tag_name(TSLexer *lexer, char *buffer, uint8_t *length) {
@@ -429,6 +821,7 @@ static bool scanner_scan(Scanner *scanner, TSLexer *lexer, const bool *valid_sym
   }
 
   if (valid_symbols[RAW_TEXT] && !valid_symbols[START_TAG_NAME] && !valid_symbols[END_TAG_NAME]) {
+    SCANNER_STATS_BRANCH(scanner, TS_VUE3_SCAN_BRANCH_RAW_TEXT);
     return scan_raw_text(scanner, lexer);
   }
 
@@ -438,23 +831,27 @@ static bool scanner_scan(Scanner *scanner, TSLexer *lexer, const bool *valid_sym
       lexer->advance(lexer, false);
 
       if (lexer->lookahead == '!') {
+        SCANNER_STATS_BRANCH(scanner, TS_VUE3_SCAN_BRANCH_COMMENT);
         lexer->advance(lexer, false);
         return scan_comment(lexer);
       }
 
       if (valid_symbols[IMPLICIT_END_TAG]) {
+        SCANNER_STATS_BRANCH(scanner, TS_VUE3_SCAN_BRANCH_IMPLICIT_END_TAG);
         return scan_implicit_end_tag(scanner, lexer);
       }
       break;
 
     case '\0':
       if (valid_symbols[IMPLICIT_END_TAG]) {
+        SCANNER_STATS_BRANCH(scanner, TS_VUE3_SCAN_BRANCH_IMPLICIT_END_TAG);
         return scan_implicit_end_tag(scanner, lexer);
       }
       break;
 
     case '/':
       if (valid_symbols[SELF_CLOSING_TAG_DELIMITER]) {
+        SCANNER_STATS_BRANCH(scanner, TS_VUE3_SCAN_BRANCH_SELF_CLOSING_TAG_DELIMITER);
         return scan_self_closing_tag_delimiter(scanner, lexer);
       }
       break;
@@ -462,8 +859,10 @@ static bool scanner_scan(Scanner *scanner, TSLexer *lexer, const bool *valid_sym
     default:
       if ((valid_symbols[START_TAG_NAME] || valid_symbols[END_TAG_NAME]) && !valid_symbols[RAW_TEXT]) {
         if (valid_symbols[START_TAG_NAME]) {
+          SCANNER_STATS_BRANCH(scanner, TS_VUE3_SCAN_BRANCH_START_TAG_NAME);
           return scan_start_tag_name(scanner, lexer);
         }
+        SCANNER_STATS_BRANCH(scanner, TS_VUE3_SCAN_BRANCH_END_TAG_NAME);
         return scan_end_tag_name(scanner, lexer);
       }
       break;
@@ -496,6 +895,50 @@ void tree_sitter_html_external_scanner_destroy(void *payload) {
   scanner_free((Scanner *)payload);
 }
 
+bool tree_sitter_vue3_scanner_stats(TSVue3ScannerStats *stats) {
+#ifdef TREE_SITTER_VUE3_SCANNER_STATS
+  if (!stats) return true;
+  memset(stats, 0, sizeof(*stats));
+  pthread_mutex_lock(&scanner_stats_mutex);
+  scanner_stats_merge(stats, &scanner_stats_retired);
+  for (Scanner *scanner = scanner_stats_live; scanner; scanner = scanner->stats_next) {
+    scanner_stats_merge(stats, &scanner->stats);
+  }
+  pthread_mutex_unlock(&scanner_stats_mutex);
+  return true;
+#else
+  (void)stats;
+  return false;
+#endif
+}
+
+void tree_sitter_vue3_scanner_stats_reset(void) {
+#ifdef TREE_SITTER_VUE3_SCANNER_STATS
+  pthread_mutex_lock(&scanner_stats_mutex);
+  memset(&scanner_stats_retired, 0, sizeof(scanner_stats_retired));
+  for (Scanner *scanner = scanner_stats_live; scanner; scanner = scanner->stats_next) {
+    memset(&scanner->stats, 0, sizeof(scanner->stats));
+    scanner->stats.scanners = 1;
+  }
+  pthread_mutex_unlock(&scanner_stats_mutex);
+#endif
+}
+
+const char *tree_sitter_vue3_scan_branch_name(TSVue3ScanBranch branch) {
+  static const char *const BRANCH_NAMES[TS_VUE3_SCAN_BRANCH_COUNT] = {
+    "none",
+    "text",
+    "raw_text",
+    "comment",
+    "implicit_end_tag",
+    "start_tag_name",
+    "end_tag_name",
+    "self_closing_tag_delimiter",
+  };
+  if ((unsigned)branch >= TS_VUE3_SCAN_BRANCH_COUNT) return NULL;
+  return BRANCH_NAMES[branch];
+}
+
 #ifdef __cplusplus
 }
 #endif
\ No newline at end of file